@@ -0,0 +1,84 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <numeric>
+
+#include "MF/BufferPool.hpp"
+#include "benchmarks_data.hpp"
+
+using namespace MF::Bytes;
+using MF::Benchmarks::doNotOptimize;
+using MF::Benchmarks::measure;
+
+/// The factory as it was before the BufferPool: two allocations per buffer.
+class BufferWithUniquePointer : public Buffer {
+   public:
+    explicit BufferWithUniquePointer(std::size_t size)
+        : buffer(std::make_unique<byte[]>(size)), size(size) {
+    }
+
+    void* get() const override {
+        return buffer.get();
+    }
+
+    std::size_t getSize() const override {
+        return size;
+    }
+
+   private:
+    const std::unique_ptr<byte[]> buffer;
+    const std::size_t size;
+};
+
+MF_BENCHMARK_GROUP(BufferPool) {
+    const std::size_t iterations = 2000000;
+
+    for (const std::size_t size : {64, 1500, 16 * 1024}) {
+        const std::string suffix = " (" + std::to_string(size) + " bytes)";
+
+        measure("make_shared + make_unique" + suffix, iterations, [size]() {
+            auto buffer = std::make_shared<BufferWithUniquePointer>(size);
+            doNotOptimize(buffer->get());
+        });
+        measure("makeBufferWithSize" + suffix, iterations, [size]() {
+            auto buffer = makeBufferWithSize(size);
+            doNotOptimize(buffer->get());
+        });
+        measure("BufferPool::makeBuffer" + suffix, iterations, [size]() {
+            auto buffer = BufferPool::makeBuffer(size);
+            doNotOptimize(buffer->get());
+        });
+    }
+}
+
+MF_BENCHMARK_GROUP(BufferSpan) {
+    const std::size_t size = 64 * 1024;
+    const std::size_t iterations = 2000;
+    auto buffer = makeBufferWithSize(size);
+    std::iota(buffer->begin(), buffer->end(), byte(0));
+
+    measure(
+        "Sum through Buffer::getAt",
+        iterations,
+        [&buffer]() {
+            unsigned long sum = 0;
+            for (std::size_t i = 0; i < buffer->getSize(); i++) {
+                sum += buffer->getAt<byte>(i);
+            }
+            doNotOptimize(sum);
+        },
+        size);
+    measure(
+        "Sum through BufferSpan",
+        iterations,
+        [&buffer]() {
+            const BufferSpan span = buffer->getSpan();
+            unsigned long sum = 0;
+            for (std::size_t i = 0; i < span.size(); i++) {
+                sum += span[i];
+            }
+            doNotOptimize(sum);
+        },
+        size);
+}
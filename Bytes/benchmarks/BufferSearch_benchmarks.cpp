@@ -0,0 +1,63 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <algorithm>
+
+#include "MF/BufferSearch.hpp"
+#include "benchmarks_data.hpp"
+
+using namespace MF::Bytes;
+using MF::Benchmarks::doNotOptimize;
+using MF::Benchmarks::measure;
+
+MF_BENCHMARK_GROUP(BufferSearch) {
+    const std::size_t size = 64 * 1024;
+    const std::size_t iterations = 5000;
+
+    // Text-like content, with the searched values only at the end.
+    auto buffer = makeBufferWithSize(size);
+    for (std::size_t i = 0; i < size; i++) {
+        buffer->getAt<byte>(i) = static_cast<byte>('a' + i % 26);
+    }
+    const std::string pattern = "\r\nEND";
+    std::copy(pattern.begin(), pattern.end(), buffer->end() - pattern.size());
+    const ByteSet delimiters = {'\r', '\n', '\0', '|'};
+
+    measure(
+        "std::find",
+        iterations,
+        [&]() { doNotOptimize(std::find(buffer->cbegin(), buffer->cend(), '\r')); },
+        size);
+    measure("Buffer::find(byte)", iterations, [&]() { doNotOptimize(buffer->find('\r')); }, size);
+    measure(
+        "std::find_if (4 bytes)",
+        iterations,
+        [&]() {
+            doNotOptimize(std::find_if(buffer->cbegin(), buffer->cend(), [](byte value) {
+                return value == '\r' || value == '\n' || value == '\0' || value == '|';
+            }));
+        },
+        size);
+    measure(
+        "Buffer::findAny (4 bytes)",
+        iterations,
+        [&]() { doNotOptimize(buffer->findAny(delimiters)); },
+        size);
+    measure(
+        "std::search",
+        iterations,
+        [&]() {
+            doNotOptimize(
+                std::search(buffer->cbegin(), buffer->cend(), pattern.begin(), pattern.end()));
+        },
+        size);
+    measure(
+        "Buffer::find(pattern)", iterations, [&]() { doNotOptimize(buffer->find(pattern)); }, size);
+    measure(
+        "std::count",
+        iterations,
+        [&]() { doNotOptimize(std::count(buffer->cbegin(), buffer->cend(), 'e')); },
+        size);
+    measure("Buffer::count", iterations, [&]() { doNotOptimize(buffer->count('e')); }, size);
+}
@@ -0,0 +1,49 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include "MF/Checksums.hpp"
+#include "benchmarks_data.hpp"
+
+using namespace MF::Bytes;
+using MF::Benchmarks::doNotOptimize;
+using MF::Benchmarks::measure;
+
+/// The byte-at-a-time table loop that each team used to ship.
+static std::uint32_t computeCrc32ByteByByte(const byte* input, std::size_t size) {
+    static const auto table = []() {
+        std::vector<std::uint32_t> result(256);
+        for (std::uint32_t i = 0; i < 256; i++) {
+            std::uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++) {
+                crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320U : 0);
+            }
+            result[i] = crc;
+        }
+        return result;
+    }();
+
+    std::uint32_t crc = 0xFFFFFFFFU;
+    for (std::size_t i = 0; i < size; i++) {
+        crc = (crc >> 8) ^ table[(crc ^ input[i]) & 0xFF];
+    }
+    return ~crc;
+}
+
+MF_BENCHMARK_GROUP(Checksums) {
+    const std::size_t size = 64 * 1024;
+    const std::size_t iterations = 5000;
+    auto input = makeBufferWithSize(size);
+    for (std::size_t i = 0; i < size; i++) {
+        input->getAt<byte>(i) = static_cast<byte>(i * 131 + 7);
+    }
+
+    measure(
+        "CRC-32 byte by byte",
+        iterations,
+        [&]() { doNotOptimize(computeCrc32ByteByByte(input->cbegin(), size)); },
+        size);
+    measure("computeCrc32", iterations, [&]() { doNotOptimize(computeCrc32(*input)); }, size);
+    measure("computeCrc32c", iterations, [&]() { doNotOptimize(computeCrc32c(*input)); }, size);
+    measure("computeHash64", iterations, [&]() { doNotOptimize(computeHash64(*input)); }, size);
+}
@@ -0,0 +1,68 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <fstream>
+#include <iterator>
+
+#include "MF/Compression.hpp"
+#include "benchmarks_data.hpp"
+
+using namespace MF::Bytes;
+using MF::Benchmarks::doNotOptimize;
+using MF::Benchmarks::measure;
+
+static std::shared_ptr<Buffer> readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    const std::vector<char> content(
+        (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    auto result = makeBufferWithSize(content.size());
+    std::copy(content.begin(), content.end(), result->begin());
+    return result;
+}
+
+static void benchmarkFile(const std::string& name, const std::string& path) {
+    const auto input = readFile(path);
+    const std::size_t size = input->getSize();
+    if (size == 0) {
+        std::printf("%s: cannot read %s\n", name.c_str(), path.c_str());
+        return;
+    }
+    const std::size_t iterations = std::max<std::size_t>(10, (256 << 20) / size);
+
+    const auto compressed = compress(*input);
+    std::printf(
+        "%s: %zu -> %zu bytes (ratio %.2f)\n", name.c_str(), size, compressed->getSize(),
+        static_cast<double>(size) / static_cast<double>(compressed->getSize()));
+
+    measure(
+        name + " compress", iterations, [&]() { doNotOptimize(compress(*input)); }, size);
+    measure(
+        name + " decompress",
+        iterations,
+        [&]() { doNotOptimize(decompress(*compressed)); },
+        size);
+
+    // Without the frame: no checksum and no output allocation.
+    std::vector<byte> block(getCompressedBlockBound(size));
+    const std::size_t blockSize =
+        compressBlock(input->get(), size, block.data(), block.size());
+    std::vector<byte> output(size);
+    measure(
+        name + " compressBlock",
+        iterations,
+        [&]() { doNotOptimize(compressBlock(input->get(), size, block.data(), block.size())); },
+        size);
+    measure(
+        name + " decompressBlock",
+        iterations,
+        [&]() {
+            doNotOptimize(decompressBlock(block.data(), blockSize, output.data(), size));
+        },
+        size);
+}
+
+MF_BENCHMARK_GROUP(Compression) {
+    benchmarkFile("Binary file", MF_BYTES_BENCHMARKS_BINARY_FILE);
+    benchmarkFile("Text file", MF_BYTES_BENCHMARKS_TEXT_FILE);
+}
@@ -0,0 +1,88 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <random>
+
+#include "MF/IntegerCodecs.hpp"
+#include "benchmarks_data.hpp"
+
+using namespace MF::Bytes;
+using MF::Benchmarks::doNotOptimize;
+using MF::Benchmarks::measure;
+
+/// The usual one value at a time loop.
+static void bitUnpackOneByOne(
+    const byte* input, std::size_t count, unsigned int bitWidth, std::uint32_t* output) {
+    for (std::size_t i = 0; i < count; i++) {
+        std::uint32_t value = 0;
+        for (unsigned int bit = 0; bit < bitWidth; bit++) {
+            const std::size_t bitIndex = i * bitWidth + bit;
+            value |= static_cast<std::uint32_t>((input[bitIndex / 8] >> (bitIndex % 8)) & 1)
+                     << bit;
+        }
+        output[i] = value;
+    }
+}
+
+MF_BENCHMARK_GROUP(IntegerCodecs) {
+    // The throughputs are in decoded bytes (4 per value): 1000 MB/s is 250 M values/s.
+    const std::size_t count = 64 * 1024;
+    const std::size_t iterations = 2000;
+    const std::size_t decodedSize = count * sizeof(std::uint32_t);
+
+    std::mt19937 generator(1);
+    std::vector<std::uint32_t> values(count);
+    for (auto& value : values) {
+        value = generator() % 1000;
+    }
+    std::vector<std::uint32_t> output(count);
+
+    const unsigned int bitWidth = getRequiredBitWidth(values.data(), count);
+    std::vector<byte> packed(getBitPackedSize(count, bitWidth));
+    measure(
+        "bitPack (10 bits)",
+        iterations,
+        [&]() { doNotOptimize(bitPack(values.data(), count, bitWidth, packed.data())); },
+        decodedSize);
+    measure(
+        "bitUnpack one by one (10 bits)",
+        iterations / 10,
+        [&]() { bitUnpackOneByOne(packed.data(), count, bitWidth, output.data()); },
+        decodedSize);
+    measure(
+        "bitUnpack (10 bits)",
+        iterations,
+        [&]() {
+            doNotOptimize(
+                bitUnpack(packed.data(), packed.size(), count, bitWidth, output.data()));
+        },
+        decodedSize);
+
+    std::vector<byte> encoded(getStreamVByteMaxEncodedSize(count));
+    std::size_t encodedSize = 0;
+    measure(
+        "streamVByteEncode",
+        iterations,
+        [&]() { encodedSize = streamVByteEncode(values.data(), count, encoded.data()); },
+        decodedSize);
+    measure(
+        "streamVByteDecode",
+        iterations,
+        [&]() {
+            doNotOptimize(
+                streamVByteDecode(encoded.data(), encodedSize, count, output.data()));
+        },
+        decodedSize);
+
+    measure(
+        "encodeDeltaZigZag",
+        iterations,
+        [&]() { encodeDeltaZigZag(values.data(), count, output.data()); },
+        decodedSize);
+    measure(
+        "decodeDeltaZigZag",
+        iterations,
+        [&]() { decodeDeltaZigZag(values.data(), count, output.data()); },
+        decodedSize);
+}
@@ -0,0 +1,78 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include "MF/TextEncodings.hpp"
+#include "benchmarks_data.hpp"
+
+using namespace MF::Bytes;
+using MF::Benchmarks::doNotOptimize;
+using MF::Benchmarks::measure;
+
+/// The byte-at-a-time loop that the SIMD kernels replace.
+static void hexEncodeByteByByte(const byte* input, std::size_t inputSize, char* output) {
+    static const char* const digits = "0123456789abcdef";
+    for (std::size_t i = 0; i < inputSize; i++) {
+        output[2 * i] = digits[input[i] >> 4];
+        output[2 * i + 1] = digits[input[i] & 0x0F];
+    }
+}
+
+static std::shared_ptr<Buffer> makeInput(std::size_t size) {
+    auto buffer = makeBufferWithSize(size);
+    for (std::size_t i = 0; i < size; i++) {
+        buffer->getAt<byte>(i) = static_cast<byte>(i * 131 + 7);
+    }
+    return buffer;
+}
+
+MF_BENCHMARK_GROUP(TextEncodings) {
+    const std::size_t size = 64 * 1024;
+    const std::size_t iterations = 2000;
+    const auto input = makeInput(size);
+
+    std::string base64(getBase64EncodedSize(size), '\0');
+    std::string hex(getHexEncodedSize(size), '\0');
+    std::vector<byte> decoded(size);
+
+    measure(
+        "base64Encode",
+        iterations,
+        [&]() {
+            base64Encode(input->get(), size, &base64[0]);
+            doNotOptimize(base64);
+        },
+        size);
+    measure(
+        "base64Decode",
+        iterations,
+        [&]() {
+            base64Decode(base64.data(), base64.size(), decoded.data());
+            doNotOptimize(decoded);
+        },
+        size);
+    measure(
+        "hexEncode byte by byte",
+        iterations,
+        [&]() {
+            hexEncodeByteByByte(input->cbegin(), size, &hex[0]);
+            doNotOptimize(hex);
+        },
+        size);
+    measure(
+        "hexEncode",
+        iterations,
+        [&]() {
+            hexEncode(input->get(), size, &hex[0]);
+            doNotOptimize(hex);
+        },
+        size);
+    measure(
+        "hexDecode",
+        iterations,
+        [&]() {
+            hexDecode(hex.data(), hex.size(), decoded.data());
+            doNotOptimize(decoded);
+        },
+        size);
+}
@@ -0,0 +1,98 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_BUFFERCHAIN_HPP
+#define MFRANCESCHI_CPPLIBRARIES_BUFFERCHAIN_HPP
+
+#include <deque>
+
+#include "MF/Bytes.hpp"
+
+#if MF_UNIX
+#    include <sys/uio.h>
+#endif
+
+namespace MF
+{
+    namespace Bytes
+    {
+        /**
+         * Sequence of bytes made of several buffers, one after the other (a "rope").
+         * Adding, splitting or consuming bytes never copies them: partially used buffers are
+         * replaced by slices. Only "flatten" and "copyTo" copy the bytes.
+         *
+         * On Unix, the chain can be written in one "writev" call (see "getIovecs" and "writeTo").
+         */
+        class BufferChain {
+           public:
+            using Buffers_t = std::deque<std::shared_ptr<Buffer>>;
+
+            BufferChain() = default;
+
+            /// Empty buffers are ignored.
+            void append(std::shared_ptr<Buffer> buffer);
+            void append(const BufferChain& other);
+
+            /// Empty buffers are ignored.
+            void prepend(std::shared_ptr<Buffer> buffer);
+            void prepend(const BufferChain& other);
+
+            /// Total number of bytes.
+            std::size_t getSize() const {
+                return size;
+            }
+
+            bool isEmpty() const {
+                return size == 0;
+            }
+
+            const Buffers_t& getBuffers() const {
+                return buffers;
+            }
+
+            void clear();
+
+            /**
+             * Removes the first "length" bytes.
+             * @throws std::out_of_range if "length" is bigger than the size of the chain.
+             */
+            void consume(std::size_t length);
+
+            /**
+             * Removes the first "length" bytes and returns them as a new chain.
+             * @throws std::out_of_range if "length" is bigger than the size of the chain.
+             */
+            BufferChain split(std::size_t length);
+
+            /// Copies all the bytes into "output", which must be "getSize()" bytes long.
+            void copyTo(void* output) const;
+
+            /**
+             * Returns all the bytes in one contiguous buffer.
+             * It is a copy, except when the chain is made of exactly one buffer.
+             */
+            std::shared_ptr<Buffer> flatten() const;
+
+#if MF_UNIX
+            /// One "iovec" per buffer, for writev, pwritev, sendmsg...
+            std::vector<struct iovec> getIovecs() const;
+
+            /**
+             * Writes and consumes the whole chain, with as few "writev" calls as possible.
+             * @throws MF::SystemErrors::SystemError if writing fails; the bytes already written
+             * are consumed.
+             */
+            void writeTo(int fileDescriptor);
+#endif
+
+           private:
+            void throwForInvalidLength(std::size_t length) const;
+
+            Buffers_t buffers;
+            std::size_t size = 0;
+        };
+    } // namespace Bytes
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_BUFFERCHAIN_HPP
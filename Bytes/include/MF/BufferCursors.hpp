@@ -0,0 +1,265 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_BUFFERCURSORS_HPP
+#define MFRANCESCHI_CPPLIBRARIES_BUFFERCURSORS_HPP
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "MF/Bytes.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        namespace detail
+        {
+            template <typename T>
+            struct CursorValue {
+                static_assert(
+                    std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                    "Values must be arithmetic types or enums.");
+                static_assert(
+                    sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                    "Values must be 1, 2, 4 or 8 bytes long.");
+
+                using UInt = typename UnsignedOfSize<sizeof(T)>::type;
+
+                static T load(const byte* input, Endianness endianness) {
+                    UInt raw;
+                    std::memcpy(&raw, input, sizeof(raw));
+                    if (endianness != getCurrentEndianness()) {
+                        raw = swapBytesInline(raw);
+                    }
+                    T value;
+                    std::memcpy(&value, &raw, sizeof(raw));
+                    return value;
+                }
+
+                static void store(T value, byte* output, Endianness endianness) {
+                    UInt raw;
+                    std::memcpy(&raw, &value, sizeof(raw));
+                    if (endianness != getCurrentEndianness()) {
+                        raw = swapBytesInline(raw);
+                    }
+                    std::memcpy(output, &raw, sizeof(raw));
+                }
+            };
+
+            constexpr std::uint64_t encodeZigZag(std::int64_t value) {
+                return (static_cast<std::uint64_t>(value) << 1) ^
+                       static_cast<std::uint64_t>(value >> 63);
+            }
+
+            constexpr std::int64_t decodeZigZag(std::uint64_t value) {
+                return static_cast<std::int64_t>(value >> 1) ^
+                       -static_cast<std::int64_t>(value & 1);
+            }
+
+            /// Maximum length of a LEB128 encoded 64-bits integer.
+            constexpr std::size_t MAX_VARINT_LENGTH = 10;
+        } // namespace detail
+
+        /**
+         * Reads structured data from a buffer, moving forward at each read.
+         *
+         * Each "read" checks that the value fits in the remaining bytes.
+         * To check only once for a batch of reads, call "require" then the "readUnchecked" calls.
+         * Errors throw std::out_of_range (not enough bytes) or std::invalid_argument (bad varint).
+         */
+        class BufferReader {
+           public:
+            /// Keeps the buffer alive.
+            explicit BufferReader(
+                std::shared_ptr<Buffer> buffer, Endianness endianness = getCurrentEndianness());
+
+            /// Does NOT keep the memory alive.
+            explicit BufferReader(
+                BufferSpan span, Endianness endianness = getCurrentEndianness());
+
+            std::size_t getPosition() const {
+                return position;
+            }
+
+            std::size_t getRemaining() const {
+                return span.size() - position;
+            }
+
+            bool isAtEnd() const {
+                return position == span.size();
+            }
+
+            Endianness getEndianness() const {
+                return endianness;
+            }
+
+            /// @throws std::out_of_range if fewer than "nbBytes" bytes remain.
+            void require(std::size_t nbBytes) const {
+                if (nbBytes > getRemaining()) {
+                    throwForMissingBytes(nbBytes);
+                }
+            }
+
+            void skip(std::size_t nbBytes) {
+                require(nbBytes);
+                position += nbBytes;
+            }
+
+            // ----- FIXED-SIZE VALUES
+
+            template <typename T>
+            T read() {
+                return read<T>(endianness);
+            }
+
+            template <typename T>
+            T read(Endianness valueEndianness) {
+                require(sizeof(T));
+                return readUnchecked<T>(valueEndianness);
+            }
+
+            /// The caller must have called "require" before.
+            template <typename T>
+            T readUnchecked() {
+                return readUnchecked<T>(endianness);
+            }
+
+            template <typename T>
+            T readUnchecked(Endianness valueEndianness) {
+                const T value =
+                    detail::CursorValue<T>::load(span.data() + position, valueEndianness);
+                position += sizeof(T);
+                return value;
+            }
+
+            /// Copies the next "nbBytes" bytes into "output".
+            void readBytes(void* output, std::size_t nbBytes);
+
+            // ----- VARIABLE-SIZE VALUES
+
+            /// LEB128 unsigned integer.
+            std::uint64_t readVarUInt();
+
+            /// LEB128 of the zigzag encoding of a signed integer.
+            std::int64_t readVarInt() {
+                return detail::decodeZigZag(readVarUInt());
+            }
+
+            /**
+             * Reads a varint length, then returns a view on that many bytes, without copy.
+             * The view is valid as long as the memory of the reader is.
+             */
+            BufferSpan readLengthPrefixedSpan();
+
+            /// Same as "readLengthPrefixedSpan", copied into a string.
+            std::string readLengthPrefixedString();
+
+           private:
+            [[noreturn]] void throwForMissingBytes(std::size_t nbBytes) const;
+
+            std::shared_ptr<Buffer> owner;
+            BufferSpan span;
+            std::size_t position = 0;
+            Endianness endianness;
+        };
+
+        /**
+         * Writes structured data into a buffer from the BufferPool, which grows geometrically.
+         * Call "finish" to get the written bytes, without copy.
+         */
+        class BufferWriter {
+           public:
+            explicit BufferWriter(
+                Endianness endianness = getCurrentEndianness(), std::size_t initialCapacity = 256);
+
+            /// Number of bytes written.
+            std::size_t getSize() const {
+                return position;
+            }
+
+            std::size_t getCapacity() const {
+                return span.size();
+            }
+
+            Endianness getEndianness() const {
+                return endianness;
+            }
+
+            /// Makes sure that "nbBytes" more bytes can be written without growing.
+            void reserve(std::size_t nbBytes) {
+                if (nbBytes > span.size() - position) {
+                    grow(nbBytes);
+                }
+            }
+
+            // ----- FIXED-SIZE VALUES
+
+            template <typename T>
+            void write(T value) {
+                write<T>(value, endianness);
+            }
+
+            template <typename T>
+            void write(T value, Endianness valueEndianness) {
+                reserve(sizeof(T));
+                writeUnchecked<T>(value, valueEndianness);
+            }
+
+            /// The caller must have called "reserve" before.
+            template <typename T>
+            void writeUnchecked(T value) {
+                writeUnchecked<T>(value, endianness);
+            }
+
+            template <typename T>
+            void writeUnchecked(T value, Endianness valueEndianness) {
+                detail::CursorValue<T>::store(value, span.data() + position, valueEndianness);
+                position += sizeof(T);
+            }
+
+            void writeBytes(const void* input, std::size_t nbBytes);
+
+            // ----- VARIABLE-SIZE VALUES
+
+            /// LEB128 unsigned integer.
+            void writeVarUInt(std::uint64_t value);
+
+            /// LEB128 of the zigzag encoding of a signed integer.
+            void writeVarInt(std::int64_t value) {
+                writeVarUInt(detail::encodeZigZag(value));
+            }
+
+            /// Varint length followed by the bytes.
+            void writeLengthPrefixed(const void* input, std::size_t nbBytes);
+
+            void writeLengthPrefixed(const std::string& input) {
+                writeLengthPrefixed(input.data(), input.size());
+            }
+
+            /// View on the written bytes. It is invalidated when the writer grows.
+            BufferSpan getWrittenSpan() const {
+                return BufferSpan(span.data(), position);
+            }
+
+            /**
+             * Returns the written bytes (a slice of the internal buffer, no copy).
+             * The writer then starts again from an empty buffer.
+             */
+            std::shared_ptr<Buffer> finish();
+
+           private:
+            void grow(std::size_t nbBytes);
+
+            std::shared_ptr<Buffer> storage;
+            BufferSpan span;
+            std::size_t position = 0;
+            Endianness endianness;
+            std::size_t initialCapacity;
+        };
+    } // namespace Bytes
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_BUFFERCURSORS_HPP
@@ -0,0 +1,41 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_BUFFERPOOL_HPP
+#define MFRANCESCHI_CPPLIBRARIES_BUFFERPOOL_HPP
+
+#include "MF/Bytes.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        /**
+         * Recycles the memory of buffers, to avoid hitting the system allocator for each buffer.
+         *
+         * The Buffer object, its shared_ptr control block and its memory are allocated in one
+         * block. Blocks are grouped by size classes (powers of 2) and, when the last shared_ptr
+         * is released, they go back to a free list of the releasing thread. There is no lock.
+         */
+        namespace BufferPool
+        {
+            /// Bigger blocks are not pooled: they directly come from (and go back to) "new".
+            constexpr std::size_t MAX_POOLED_BLOCK_SIZE = 64 * 1024;
+
+            /**
+             * Constructs a new buffer which memory is self-managed.
+             * Its memory is NOT initialized. Use "makeBufferWithSize" to get zeros.
+             */
+            std::shared_ptr<Buffer> makeBuffer(std::size_t size);
+
+            /// Number of free blocks kept by the calling thread.
+            std::size_t getThreadCachedBlocksCount();
+
+            /// Gives all the free blocks kept by the calling thread back to the system.
+            void releaseThreadCache();
+        } // namespace BufferPool
+    } // namespace Bytes
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_BUFFERPOOL_HPP
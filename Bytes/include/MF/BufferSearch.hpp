@@ -0,0 +1,111 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_BUFFERSEARCH_HPP
+#define MFRANCESCHI_CPPLIBRARIES_BUFFERSEARCH_HPP
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "MF/Bytes.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        /**
+         * Set of byte values, for "findAny".
+         * Build it once, then reuse it: it holds the lookup tables of the SIMD search.
+         */
+        class ByteSet {
+           public:
+            ByteSet() = default;
+
+            ByteSet(std::initializer_list<byte> values);
+
+            /// The bytes of "values" (binary safe).
+            explicit ByteSet(const std::string& values);
+
+            void add(byte value) {
+                bitmaps[value >> 7][value & 0x0F] |= static_cast<byte>(1U << ((value >> 4) & 7));
+            }
+
+            bool contains(byte value) const {
+                return ((bitmaps[value >> 7][value & 0x0F] >> ((value >> 4) & 7)) & 1) != 0;
+            }
+
+            /**
+             * Lookup tables of the SIMD search, indexed by [value >> 7][value & 0x0F].
+             * Bit (value >> 4) & 7 is set when "value" is in the set.
+             */
+            const byte* getBitmaps(std::size_t half) const {
+                return bitmaps[half];
+            }
+
+           private:
+            alignas(16) byte bitmaps[2][16] = {};
+        };
+
+        // ----- RAW MEMORY ----- //
+        // Use AVX2 or SSE2 (SSSE3 for findAnyByte) when the CPU supports it.
+        // They return the index of the first match, or NOT_FOUND.
+
+        std::size_t findByte(const void* data, std::size_t size, byte value);
+
+        std::size_t findAnyByte(const void* data, std::size_t size, const ByteSet& values);
+
+        /**
+         * Candidates are the positions where both the first and the last bytes of the pattern
+         * match, so that the full comparison is rarely done.
+         * An empty pattern is found at index 0.
+         */
+        std::size_t findPattern(
+            const void* data, std::size_t size, const void* pattern, std::size_t patternSize);
+
+        std::size_t countByte(const void* data, std::size_t size, byte value);
+
+        // ----- SEVERAL PATTERNS ----- //
+
+        /// Result of PatternSet::find.
+        struct PatternMatch {
+            std::size_t position = NOT_FOUND;
+            /// Index of the matching pattern in PatternSet::getPatterns.
+            std::size_t patternIndex = 0;
+        };
+
+        /**
+         * Several patterns searched at once, for example the delimiters of a framed stream.
+         * The candidates are found with the SIMD search of the first bytes of all the patterns,
+         * then checked. When several patterns match at the same position, the first one of the
+         * list wins.
+         */
+        class PatternSet {
+           public:
+            /// @throws std::invalid_argument if there is no pattern, or an empty one.
+            explicit PatternSet(std::vector<std::string> patterns);
+
+            const std::vector<std::string>& getPatterns() const {
+                return patterns;
+            }
+
+            PatternMatch find(const void* data, std::size_t size) const;
+
+            PatternMatch find(const Buffer& buffer, std::size_t from = 0) const;
+
+           private:
+            std::vector<std::string> patterns;
+            ByteSet firstBytes;
+        };
+
+        /**
+         * Splits the buffer around each delimiter, as slices (no copy). The delimiters are not
+         * in the slices. Example: "a,b," split by "," gives "a", "b" and "".
+         */
+        std::vector<std::shared_ptr<Buffer>> split(
+            const std::shared_ptr<Buffer>& buffer, const PatternSet& delimiters);
+    } // namespace Bytes
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_BUFFERSEARCH_HPP
@@ -1,7 +1,15 @@
 
 
+#ifndef MFRANCESCHI_CPPLIBRARIES_BYTES_HPP
+#define MFRANCESCHI_CPPLIBRARIES_BYTES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #ifdef BIG_ENDIAN
@@ -20,7 +28,13 @@ namespace MF
     {
         using byte = unsigned char;
 
-        class Buffer {
+        class BufferSpan;
+        class ByteSet;
+
+        /// Returned by the searches when nothing is found.
+        constexpr std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+
+        class Buffer : public std::enable_shared_from_this<Buffer> {
             typedef byte* iterator;
             typedef const byte* const_iterator;
 
@@ -31,27 +45,124 @@ namespace MF
             template <typename Type>
             Type* getWithCast() const;
 
+            /// @throws std::out_of_range if the element does not fit in the buffer.
             template <typename Type>
             Type& getAt(std::size_t index);
 
             virtual std::size_t getSize() const = 0;
 
+            /**
+             * Whether this buffer allocated its bytes itself, so that they are writable and only
+             * reachable through it. False by default: a slice shares the bytes of its parent,
+             * a file may be mapped read-only, a raw pointer is owned by someone else...
+             */
+            virtual bool ownsWritableBytes() const {
+                return false;
+            }
+
+            /**
+             * Constructs a buffer on the range [offset, offset + length) of this one, without copy.
+             * The slice keeps this buffer alive, through "shared_from_this". The range is only
+             * checked here.
+             * Precondition: this buffer is owned by a std::shared_ptr, as the ones of all the
+             * factories are. On a buffer which is not (a subclass on the stack or in a
+             * std::unique_ptr), the behaviour is undefined.
+             * @throws std::out_of_range if the range does not fit in this buffer.
+             */
+            std::shared_ptr<Buffer> slice(std::size_t offset, std::size_t length);
+
             iterator begin();
             const_iterator cbegin() const;
             iterator end();
             const_iterator cend() const;
 
+            /// Non-virtual view on this buffer, for hot loops. See BufferSpan.
+            BufferSpan getSpan() const;
+
+            // ----- SEARCH (SIMD, see MF/BufferSearch.hpp)
+            // The searches start at "from", and return an index in this buffer, or NOT_FOUND.
+
+            std::size_t find(byte value, std::size_t from = 0) const;
+
+            std::size_t findAny(const ByteSet& values, std::size_t from = 0) const;
+
+            /// The pattern is binary safe. For raw memory, see "findPattern".
+            std::size_t find(const std::string& pattern, std::size_t from = 0) const;
+
+            /// Number of occurrences of "value".
+            std::size_t count(byte value) const;
+
            protected:
             Buffer() = default;
 
            private:
-            void throwForInvalidIndex(std::size_t index);
+            void throwForInvalidIndex(std::size_t index, std::size_t elementSize);
 
            public:
             // TODO: NoCopy, NoMove
             virtual ~Buffer() = default;
         };
 
+        /**
+         * Lightweight handle on contiguous bytes: a pointer and a size, without any virtual call.
+         * Get it once from a Buffer, then use it in hot loops.
+         * It does NOT own the memory, so the buffer must outlive it.
+         */
+        class BufferSpan {
+           public:
+            BufferSpan() = default;
+
+            BufferSpan(void* data, std::size_t size)
+                : _data(static_cast<byte*>(data)), _size(size) {
+            }
+
+            byte* data() const {
+                return _data;
+            }
+
+            std::size_t size() const {
+                return _size;
+            }
+
+            bool empty() const {
+                return _size == 0;
+            }
+
+            byte* begin() const {
+                return _data;
+            }
+
+            byte* end() const {
+                return _data + _size;
+            }
+
+            /// No bounds check.
+            byte& operator[](std::size_t index) const {
+                return _data[index];
+            }
+
+            template <typename Type>
+            Type* getWithCast() const {
+                return reinterpret_cast<Type*>(_data);
+            }
+
+            /// @throws std::out_of_range if the element does not fit in the span.
+            template <typename Type>
+            Type& getAt(std::size_t index) const {
+                if (index >= _size / sizeof(Type)) {
+                    throw std::out_of_range(
+                        "Index out of bounds: " + std::to_string(index) +
+                        " is >= the number of elements, which is " +
+                        std::to_string(_size / sizeof(Type)) + ".");
+                }
+                return getWithCast<Type>()[index];
+            }
+
+           private:
+            byte* _data = nullptr;
+            std::size_t _size = 0;
+        };
+
         /**
          * Constructs a new buffer.
          * YOU are responsible of the memory.
@@ -59,11 +170,32 @@ namespace MF
         std::shared_ptr<Buffer> makeBuffer(void* buffer, std::size_t size);
 
         /**
-         * Constructs a new buffer which memory is self-managed.
-         * It uses a unique_ptr under the hood.
+         * Constructs a new buffer which memory is self-managed, filled with zeros.
+         * The buffer and its memory are allocated in one block from the BufferPool.
          */
         std::shared_ptr<Buffer> makeBufferWithSize(std::size_t size);
 
+        /**
+         * Constructs a new buffer which memory is self-managed, filled with zeros, and which
+         * address is a multiple of "alignment" (SIMD loads, cache lines, O_DIRECT...).
+         * @throws std::invalid_argument if "alignment" is not a power of 2.
+         */
+        std::shared_ptr<Buffer> makeAlignedBuffer(std::size_t size, std::size_t alignment);
+
+        /// Size of the huge pages used by "makeHugePageBuffer" (the default one on x86-64).
+        constexpr std::size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+        /**
+         * Constructs a new buffer which memory is self-managed, filled with zeros, and backed by
+         * huge pages, to save TLB misses on big tables. Its memory is rounded up to, and aligned
+         * on, HUGE_PAGE_SIZE.
+         * On Linux, it uses the reserved huge pages (MAP_HUGETLB) when there are enough of them,
+         * otherwise it asks for transparent huge pages (madvise), which the kernel may ignore.
+         * Elsewhere, it is an aligned buffer with normal pages.
+         * @throws MF::SystemErrors::SystemError if the memory cannot be mapped.
+         */
+        std::shared_ptr<Buffer> makeHugePageBuffer(std::size_t size);
+
         enum class Endianness { BIG_ENDIAN, LITTLE_ENDIAN };
 
         constexpr Endianness getCurrentEndianness();
@@ -75,6 +207,51 @@ namespace MF
         std::uint64_t swapBytes(std::uint64_t value);
         std::shared_ptr<Buffer> swapBytes(const std::shared_ptr<Buffer>& originalBuffer);
 
+        /**
+         * Swaps the bytes of each of the "count" elements of "input" and writes them into
+         * "output". Both can be the same array, but they must not partially overlap.
+         * Uses AVX2 or SSSE3 when the CPU supports it.
+         */
+        void swapBytes(const std::uint16_t* input, std::uint16_t* output, std::size_t count);
+        void swapBytes(const std::uint32_t* input, std::uint32_t* output, std::size_t count);
+        void swapBytes(const std::uint64_t* input, std::uint64_t* output, std::size_t count);
+
+        namespace detail
+        {
+            /// The kernels of the array swaps, to test each of them whatever the running CPU.
+            enum class SwapKernel { SCALAR, SSSE3, AVX2 };
+
+            /// Whether "kernel" is compiled for this platform and supported by the running CPU.
+            bool isSwapKernelSupported(SwapKernel kernel);
+
+            /// Same as "swapBytes", but with "kernel" instead of the best supported one.
+            void swapBytesWithKernel(
+                SwapKernel kernel, const std::uint16_t* input, std::uint16_t* output,
+                std::size_t count);
+            void swapBytesWithKernel(
+                SwapKernel kernel, const std::uint32_t* input, std::uint32_t* output,
+                std::size_t count);
+            void swapBytesWithKernel(
+                SwapKernel kernel, const std::uint64_t* input, std::uint64_t* output,
+                std::size_t count);
+        } // namespace detail
+
+        /// Same as above, for any arithmetic type of 1, 2, 4 or 8 bytes (int32_t, double...).
+        template <typename T>
+        void swapBytesOfArray(const T* input, T* output, std::size_t count);
+
+        /**
+         * Swaps the bytes of each element of type T in the buffer.
+         * @throws std::invalid_argument if the buffer size is not a multiple of sizeof(T).
+         */
+        template <typename T>
+        void swapBytesInPlace(Buffer& buffer);
+
+        /**
+         * Converts values from an endianness to another.
+         * "readArray" converts "count" elements from "input" into "output"; both can be the same
+         * array. When both endiannesses are the same, it is a memcpy (or nothing at all).
+         */
         template <Endianness Source_Endianness, Endianness Target_Endianness>
         struct DataConverter {
             static std::uint8_t read(std::uint8_t value);
@@ -82,8 +259,68 @@ namespace MF
             static std::uint32_t read(std::uint32_t value);
             static std::uint64_t read(std::uint64_t value);
             static std::shared_ptr<Buffer> read(const std::shared_ptr<Buffer>& value);
+
+            template <typename T>
+            static void readArray(const T* input, T* output, std::size_t count);
         };
 
+        namespace detail
+        {
+            template <typename T>
+            void copyArray(const T* input, T* output, std::size_t count) {
+                static_assert(
+                    std::is_trivially_copyable<T>::value, "T must be trivially copyable.");
+                if (input != output && count != 0) {
+                    std::memcpy(output, input, count * sizeof(T));
+                }
+            }
+
+            template <std::size_t Size>
+            struct UnsignedOfSize;
+
+            template <>
+            struct UnsignedOfSize<1> {
+                using type = std::uint8_t;
+            };
+
+            template <>
+            struct UnsignedOfSize<2> {
+                using type = std::uint16_t;
+            };
+
+            template <>
+            struct UnsignedOfSize<4> {
+                using type = std::uint32_t;
+            };
+
+            template <>
+            struct UnsignedOfSize<8> {
+                using type = std::uint64_t;
+            };
+
+            // Header-only versions of "swapBytes", written with shifts so that they can be
+            // inlined and any compiler recognizes a single "bswap".
+            constexpr std::uint8_t swapBytesInline(std::uint8_t value) {
+                return value;
+            }
+
+            constexpr std::uint16_t swapBytesInline(std::uint16_t value) {
+                return static_cast<std::uint16_t>((value >> 8) | (value << 8));
+            }
+
+            constexpr std::uint32_t swapBytesInline(std::uint32_t value) {
+                return ((value & 0x000000FFU) << 24) | ((value & 0x0000FF00U) << 8) |
+                       ((value & 0x00FF0000U) >> 8) | ((value & 0xFF000000U) >> 24);
+            }
+
+            constexpr std::uint64_t swapBytesInline(std::uint64_t value) {
+                return (static_cast<std::uint64_t>(
+                            swapBytesInline(static_cast<std::uint32_t>(value)))
+                        << 32) |
+                       swapBytesInline(static_cast<std::uint32_t>(value >> 32));
+            }
+        } // namespace detail
+
         template <>
         struct DataConverter<Endianness::LITTLE_ENDIAN, Endianness::LITTLE_ENDIAN> {
             static std::uint8_t read(std::uint8_t value) {
@@ -105,6 +342,11 @@ namespace MF
             static std::shared_ptr<Buffer> read(const std::shared_ptr<Buffer>& value) {
                 return value;
             }
+
+            template <typename T>
+            static void readArray(const T* input, T* output, std::size_t count) {
+                detail::copyArray(input, output, count);
+            }
         };
 
         template <>
@@ -128,6 +370,11 @@ namespace MF
             static std::shared_ptr<Buffer> read(const std::shared_ptr<Buffer>& value) {
                 return value;
             }
+
+            template <typename T>
+            static void readArray(const T* input, T* output, std::size_t count) {
+                detail::copyArray(input, output, count);
+            }
         };
 
         template <>
@@ -151,6 +398,11 @@ namespace MF
             static std::shared_ptr<Buffer> read(const std::shared_ptr<Buffer>& value) {
                 return swapBytes(value);
             }
+
+            template <typename T>
+            static void readArray(const T* input, T* output, std::size_t count) {
+                swapBytesOfArray(input, output, count);
+            }
         };
 
         template <>
@@ -174,8 +426,87 @@ namespace MF
             static std::shared_ptr<Buffer> read(const std::shared_ptr<Buffer>& value) {
                 return swapBytes(value);
             }
+
+            template <typename T>
+            static void readArray(const T* input, T* output, std::size_t count) {
+                swapBytesOfArray(input, output, count);
+            }
         };
 
+        namespace detail
+        {
+            template <typename T>
+            void swapBytesOfArray(
+                const T* input,
+                T* output,
+                std::size_t count,
+                std::integral_constant<std::size_t, 1>) {
+                copyArray(input, output, count);
+            }
+
+            template <typename T>
+            void swapBytesOfArray(
+                const T* input,
+                T* output,
+                std::size_t count,
+                std::integral_constant<std::size_t, 2>) {
+                swapBytes(
+                    reinterpret_cast<const std::uint16_t*>(input),
+                    reinterpret_cast<std::uint16_t*>(output),
+                    count);
+            }
+
+            template <typename T>
+            void swapBytesOfArray(
+                const T* input,
+                T* output,
+                std::size_t count,
+                std::integral_constant<std::size_t, 4>) {
+                swapBytes(
+                    reinterpret_cast<const std::uint32_t*>(input),
+                    reinterpret_cast<std::uint32_t*>(output),
+                    count);
+            }
+
+            template <typename T>
+            void swapBytesOfArray(
+                const T* input,
+                T* output,
+                std::size_t count,
+                std::integral_constant<std::size_t, 8>) {
+                swapBytes(
+                    reinterpret_cast<const std::uint64_t*>(input),
+                    reinterpret_cast<std::uint64_t*>(output),
+                    count);
+            }
+        } // namespace detail
+
+        template <typename T>
+        void swapBytesOfArray(const T* input, T* output, std::size_t count) {
+            static_assert(std::is_arithmetic<T>::value, "T must be an arithmetic type.");
+            static_assert(
+                sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                "T must be 1, 2, 4 or 8 bytes long.");
+            detail::swapBytesOfArray(
+                input, output, count, std::integral_constant<std::size_t, sizeof(T)>());
+        }
+
+        template <typename T>
+        void swapBytesInPlace(Buffer& buffer) {
+            if (buffer.getSize() % sizeof(T) != 0) {
+                throw std::invalid_argument(
+                    "The buffer size (" + std::to_string(buffer.getSize()) +
+                    ") is not a multiple of the element size (" + std::to_string(sizeof(T)) +
+                    ").");
+            }
+            T* const elements = buffer.getWithCast<T>();
+            swapBytesOfArray<T>(elements, elements, buffer.getSize() / sizeof(T));
+        }
+
+        inline BufferSpan Buffer::getSpan() const {
+            return BufferSpan(get(), getSize());
+        }
+
         template <typename Type>
         Type* Buffer::getWithCast() const {
             return reinterpret_cast<Type*>(get());
@@ -183,7 +514,7 @@ namespace MF
 
         template <typename Type>
         Type& Buffer::getAt(std::size_t index) {
-            throwForInvalidIndex(index);
+            throwForInvalidIndex(index, sizeof(Type));
             return getWithCast<Type>()[index];
         }
 
@@ -200,3 +531,5 @@ namespace MF
         }
     } // namespace Bytes
 } // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_BYTES_HPP
@@ -0,0 +1,134 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_CHECKSUMS_HPP
+#define MFRANCESCHI_CPPLIBRARIES_CHECKSUMS_HPP
+
+#include <cstdint>
+
+#include "MF/Bytes.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        /**
+         * Streaming checksums: call "update" for each chunk of data (for example, each read of
+         * a file), then "finalize". "finalize" does not change the state, so that more data can
+         * be added afterwards.
+         *
+         * Usage:
+         * @code
+         * Crc32c crc;
+         * crc.update(firstChunk, firstSize);
+         * crc.update(*secondChunkBuffer);
+         * const std::uint32_t checksum = crc.finalize();
+         * @endcode
+         */
+
+        /// CRC-32C (Castagnoli), as in iSCSI, ext4 or SCTP. Uses the SSE4.2 "crc32" instruction.
+        class Crc32c {
+           public:
+            void update(const void* data, std::size_t size);
+
+            void update(const Buffer& buffer) {
+                update(buffer.get(), buffer.getSize());
+            }
+
+            std::uint32_t finalize() const {
+                return ~state;
+            }
+
+            void reset() {
+                state = 0xFFFFFFFFU;
+            }
+
+           private:
+            std::uint32_t state = 0xFFFFFFFFU;
+        };
+
+        /// CRC-32 (IEEE 802.3), as in zlib, gzip or PNG. Uses PCLMUL folding.
+        class Crc32 {
+           public:
+            void update(const void* data, std::size_t size);
+
+            void update(const Buffer& buffer) {
+                update(buffer.get(), buffer.getSize());
+            }
+
+            std::uint32_t finalize() const {
+                return ~state;
+            }
+
+            void reset() {
+                state = 0xFFFFFFFFU;
+            }
+
+           private:
+            std::uint32_t state = 0xFFFFFFFFU;
+        };
+
+        /**
+         * Fast non-cryptographic 64-bits hash, for hash tables, deduplication or corruption
+         * detection. It is XXH64, so the values match the other implementations of XXH64.
+         */
+        class Hash64 {
+           public:
+            explicit Hash64(std::uint64_t seed = 0);
+
+            void update(const void* data, std::size_t size);
+
+            void update(const Buffer& buffer) {
+                update(buffer.get(), buffer.getSize());
+            }
+
+            std::uint64_t finalize() const;
+
+            void reset();
+
+           private:
+            std::uint64_t seed;
+            std::uint64_t accumulators[4];
+            std::uint64_t totalSize;
+            /// The bytes which do not fill a whole stripe yet.
+            byte pending[32];
+            std::size_t pendingSize;
+        };
+
+        // ----- ONE-SHOT ----- //
+
+        inline std::uint32_t computeCrc32c(const void* data, std::size_t size) {
+            Crc32c crc;
+            crc.update(data, size);
+            return crc.finalize();
+        }
+
+        inline std::uint32_t computeCrc32c(const Buffer& buffer) {
+            return computeCrc32c(buffer.get(), buffer.getSize());
+        }
+
+        inline std::uint32_t computeCrc32(const void* data, std::size_t size) {
+            Crc32 crc;
+            crc.update(data, size);
+            return crc.finalize();
+        }
+
+        inline std::uint32_t computeCrc32(const Buffer& buffer) {
+            return computeCrc32(buffer.get(), buffer.getSize());
+        }
+
+        inline std::uint64_t computeHash64(
+            const void* data, std::size_t size, std::uint64_t seed = 0) {
+            Hash64 hash(seed);
+            hash.update(data, size);
+            return hash.finalize();
+        }
+
+        inline std::uint64_t computeHash64(const Buffer& buffer, std::uint64_t seed = 0) {
+            return computeHash64(buffer.get(), buffer.getSize(), seed);
+        }
+    } // namespace Bytes
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_CHECKSUMS_HPP
@@ -0,0 +1,166 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_COMPRESSION_HPP
+#define MFRANCESCHI_CPPLIBRARIES_COMPRESSION_HPP
+
+#include <vector>
+
+#include "MF/BufferChain.hpp"
+#include "MF/Bytes.hpp"
+#include "MF/Checksums.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        // ----- BLOCKS ----- //
+        // Fast LZ77 compression, in the LZ4 block format: sequences of literals and matches
+        // (offsets up to 64 KiB), decoded with wide copies. There is no entropy coding: it
+        // trades some ratio for speed.
+
+        /// The maximal size of a compressed block (for incompressible input).
+        std::size_t getCompressedBlockBound(std::size_t inputSize);
+
+        /**
+         * Compresses the input into "output", and returns the number of bytes written.
+         * @throws std::invalid_argument if "outputCapacity" is smaller than
+         * getCompressedBlockBound(inputSize).
+         */
+        std::size_t compressBlock(
+            const void* input, std::size_t inputSize, void* output, std::size_t outputCapacity);
+
+        /**
+         * Decompresses a whole block into "output", and returns the number of bytes written.
+         * It never reads or writes out of the given ranges, even on malicious input.
+         * @throws std::invalid_argument if the block is corrupted, or if it does not fit in
+         * "outputCapacity".
+         */
+        std::size_t decompressBlock(
+            const void* input, std::size_t inputSize, void* output, std::size_t outputCapacity);
+
+        // ----- FRAMES ----- //
+        // A frame is made of:
+        // - a header: the magic "MFLZ", flags, the block size, and maybe the content size;
+        // - the blocks, each with a 4 bytes header (its size, and whether it is compressed or
+        //   stored as is when compression does not help);
+        // - an end mark, then the CRC-32C of the content.
+        // Decompression throws std::invalid_argument on corrupted frames.
+
+        constexpr std::size_t MIN_COMPRESSION_BLOCK_SIZE = 1024;
+        constexpr std::size_t DEFAULT_COMPRESSION_BLOCK_SIZE = 256 * 1024;
+        constexpr std::size_t MAX_COMPRESSION_BLOCK_SIZE = 4 * 1024 * 1024;
+
+        /// For frames which content size was not given to the compressor.
+        constexpr std::size_t UNKNOWN_CONTENT_SIZE = static_cast<std::size_t>(-1);
+
+        /// Compresses the buffer into one frame, which header holds the content size.
+        std::shared_ptr<Buffer> compress(
+            const Buffer& input, std::size_t blockSize = DEFAULT_COMPRESSION_BLOCK_SIZE);
+
+        /// Decompresses one whole frame.
+        std::shared_ptr<Buffer> decompress(const Buffer& input);
+
+        /**
+         * Streaming compression: the content is given by chunks of any size, and the
+         * compressed bytes are appended to "getOutput" block by block.
+         * Usage: @code update(...); update(...); ... finish();
+         */
+        class FrameCompressor {
+           public:
+            /**
+             * When "contentSize" is known, it is written in the header, and "finish" checks it.
+             * @throws std::invalid_argument if "blockSize" is not a power of 2 in
+             * [MIN_COMPRESSION_BLOCK_SIZE, MAX_COMPRESSION_BLOCK_SIZE].
+             */
+            explicit FrameCompressor(
+                std::size_t blockSize = DEFAULT_COMPRESSION_BLOCK_SIZE,
+                std::size_t contentSize = UNKNOWN_CONTENT_SIZE);
+
+            /// @throws std::logic_error if the frame is finished.
+            void update(const void* data, std::size_t size);
+
+            void update(const Buffer& buffer) {
+                update(buffer.get(), buffer.getSize());
+            }
+
+            /**
+             * Compresses the last block, and ends the frame.
+             * @throws std::logic_error if the frame is already finished, or if the content size
+             * does not match the one given to the constructor.
+             */
+            void finish();
+
+            /// The compressed bytes not consumed yet by the caller.
+            BufferChain& getOutput() {
+                return output;
+            }
+
+           private:
+            void compressBlockToOutput(const byte* data, std::size_t size);
+
+            const std::size_t blockSize;
+            const std::size_t expectedContentSize;
+            std::size_t contentSize = 0;
+            std::vector<byte> pendingBlock;
+            std::vector<byte> compressedBlock;
+            Crc32c checksum;
+            BufferChain output;
+            bool finished = false;
+        };
+
+        /**
+         * Streaming decompression: the frame is given by chunks of any size, and the content is
+         * appended to "getOutput" block by block.
+         */
+        class FrameDecompressor {
+           public:
+            /**
+             * @throws std::invalid_argument if the frame is corrupted, or if there are bytes
+             * after its end.
+             */
+            void update(const void* data, std::size_t size);
+
+            void update(const Buffer& buffer) {
+                update(buffer.get(), buffer.getSize());
+            }
+
+            bool isFinished() const {
+                return state == State::FINISHED;
+            }
+
+            /// @throws std::invalid_argument if the frame is not complete.
+            void finish() const;
+
+            /// The one written in the header, or UNKNOWN_CONTENT_SIZE.
+            std::size_t getContentSize() const {
+                return expectedContentSize;
+            }
+
+            /// The decompressed bytes not consumed yet by the caller.
+            BufferChain& getOutput() {
+                return output;
+            }
+
+           private:
+            enum class State { HEADER, CONTENT_SIZE, BLOCK_HEADER, BLOCK, CHECKSUM, FINISHED };
+
+            /// Handles the "neededSize" bytes of the current state.
+            void process(const byte* data);
+
+            State state = State::HEADER;
+            std::size_t neededSize = 6;
+            std::size_t blockSize = 0;
+            bool isBlockCompressed = false;
+            std::size_t expectedContentSize = UNKNOWN_CONTENT_SIZE;
+            std::size_t contentSize = 0;
+            std::size_t frameIndex = 0;
+            std::vector<byte> pending;
+            Crc32c checksum;
+            BufferChain output;
+        };
+    } // namespace Bytes
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_COMPRESSION_HPP
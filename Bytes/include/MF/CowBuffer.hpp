@@ -0,0 +1,91 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_COWBUFFER_HPP
+#define MFRANCESCHI_CPPLIBRARIES_COWBUFFER_HPP
+
+#include "MF/Bytes.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        /**
+         * Copy-on-write handle on a buffer: copies of the handle share the bytes, and the first
+         * write through a handle clones them, only if they are still shared.
+         * Pass it by value to consumers instead of copying defensively: only the ones which
+         * actually modify the bytes pay for a copy.
+         *
+         * The bytes are shared as long as any other owner exists: other handles, and also
+         * shared_ptr given by "getShared" or slices of the buffer.
+         * The buffers which do not own their bytes (slices, files, raw pointers) are always
+         * cloned on the first write, even when this handle is their only owner.
+         * Like shared_ptr, one handle must not be used by several threads at once, but the
+         * handles sharing the same bytes can be used by different threads.
+         */
+        class CowBuffer {
+           public:
+            /// @throws std::invalid_argument if "buffer" is nullptr.
+            explicit CowBuffer(std::shared_ptr<Buffer> buffer);
+
+            std::size_t getSize() const {
+                return storage->getSize();
+            }
+
+            // ----- READ: never copies
+
+            const byte* get() const {
+                return storage->getWithCast<byte>();
+            }
+
+            const byte* cbegin() const {
+                return get();
+            }
+
+            const byte* cend() const {
+                return get() + getSize();
+            }
+
+            /// @throws std::out_of_range if the element does not fit in the buffer.
+            template <typename Type>
+            const Type& getAt(std::size_t index) const {
+                return BufferSpan(storage->get(), getSize()).getAt<Type>(index);
+            }
+
+            /// The buffer is shared until this shared_ptr (and its copies) are released.
+            const std::shared_ptr<Buffer>& getShared() const {
+                return storage;
+            }
+
+            bool isShared() const {
+                return storage.use_count() > 1;
+            }
+
+            // ----- WRITE: clones the bytes if they are shared
+
+            /// The span is invalidated by the next copy of this handle.
+            BufferSpan getWritableSpan() {
+                makeUnique();
+                return BufferSpan(storage->get(), getSize());
+            }
+
+            /// @throws std::out_of_range if the element does not fit in the buffer.
+            template <typename Type>
+            Type& getWritableAt(std::size_t index) {
+                return getWritableSpan().getAt<Type>(index);
+            }
+
+            /// Clones the bytes if they are shared, so that this handle is their only owner.
+            void makeUnique();
+
+            /// Total number of clones made by all the handles, to check for useless copies.
+            static std::size_t getCopiesCount();
+
+           private:
+            std::shared_ptr<Buffer> storage;
+        };
+    } // namespace Bytes
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_COWBUFFER_HPP
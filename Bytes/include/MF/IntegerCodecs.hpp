@@ -0,0 +1,110 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_INTEGERCODECS_HPP
+#define MFRANCESCHI_CPPLIBRARIES_INTEGERCODECS_HPP
+
+#include <cstdint>
+
+#include "MF/Bytes.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        // Codecs for arrays of small integers (IDs, deltas, enum codes...).
+        // The "raw" versions work on arrays, and return the number of bytes written or read.
+        // The Buffer versions work on buffers of native std::uint32_t, and their results come
+        // from the BufferPool. Errors throw std::invalid_argument.
+
+        // ----- BIT PACKING ----- //
+        // Each value takes exactly "bitWidth" bits, lowest bits first, little-endian bytes.
+        // Unpacking uses AVX2 when the CPU supports it (bit widths up to 25).
+
+        /// Smallest bit width which fits all the values (0 when they are all 0).
+        unsigned int getRequiredBitWidth(const std::uint32_t* values, std::size_t count);
+
+        unsigned int getRequiredBitWidth(const std::uint64_t* values, std::size_t count);
+
+        constexpr std::size_t getBitPackedSize(std::size_t count, unsigned int bitWidth) {
+            return (count * bitWidth + 7) / 8;
+        }
+
+        /// @throws std::invalid_argument if a value does not fit in "bitWidth" bits.
+        std::size_t bitPack(
+            const std::uint32_t* values, std::size_t count, unsigned int bitWidth, void* output);
+
+        std::size_t bitPack(
+            const std::uint64_t* values, std::size_t count, unsigned int bitWidth, void* output);
+
+        /// @throws std::invalid_argument if the input is too short for "count" values.
+        std::size_t bitUnpack(
+            const void* input,
+            std::size_t inputSize,
+            std::size_t count,
+            unsigned int bitWidth,
+            std::uint32_t* output);
+
+        std::size_t bitUnpack(
+            const void* input,
+            std::size_t inputSize,
+            std::size_t count,
+            unsigned int bitWidth,
+            std::uint64_t* output);
+
+        /// Packs with the required bit width, which must be stored elsewhere.
+        std::shared_ptr<Buffer> bitPack(const Buffer& values, unsigned int bitWidth);
+
+        std::shared_ptr<Buffer> bitUnpack(
+            const Buffer& input, std::size_t count, unsigned int bitWidth);
+
+        // ----- DELTA + ZIGZAG ----- //
+        // Replaces each value by the zigzag encoding of its difference with the previous one
+        // (the first one with 0), so that sorted or slowly varying values become small, and
+        // can then be bit packed or StreamVByte encoded. The differences wrap around.
+        // "output" may be equal to "values".
+
+        void encodeDeltaZigZag(
+            const std::uint32_t* values, std::size_t count, std::uint32_t* output);
+
+        void encodeDeltaZigZag(
+            const std::uint64_t* values, std::size_t count, std::uint64_t* output);
+
+        /// Uses SSE2 prefix sums when the CPU supports it.
+        void decodeDeltaZigZag(
+            const std::uint32_t* values, std::size_t count, std::uint32_t* output);
+
+        void decodeDeltaZigZag(
+            const std::uint64_t* values, std::size_t count, std::uint64_t* output);
+
+        /// In place.
+        void encodeDeltaZigZag(Buffer& values);
+
+        /// In place.
+        void decodeDeltaZigZag(Buffer& values);
+
+        // ----- STREAMVBYTE ----- //
+        // Each value takes 1 to 4 bytes. The 2 bits lengths of the values are grouped in control
+        // bytes, before all the data bytes, so that the decoder handles 4 values at once with one
+        // table lookup and one shuffle (Lemire, Kurz and Rupp).
+        // Decoding uses SSSE3 when the CPU supports it.
+
+        constexpr std::size_t getStreamVByteMaxEncodedSize(std::size_t count) {
+            return (count + 3) / 4 + 4 * count;
+        }
+
+        /// "output" must have getStreamVByteMaxEncodedSize(count) bytes, even if less are used.
+        std::size_t streamVByteEncode(const std::uint32_t* values, std::size_t count, void* output);
+
+        /// @throws std::invalid_argument if the input is too short for "count" values.
+        std::size_t streamVByteDecode(
+            const void* input, std::size_t inputSize, std::size_t count, std::uint32_t* output);
+
+        std::shared_ptr<Buffer> streamVByteEncode(const Buffer& values);
+
+        std::shared_ptr<Buffer> streamVByteDecode(const Buffer& input, std::size_t count);
+    } // namespace Bytes
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_INTEGERCODECS_HPP
@@ -0,0 +1,112 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_RINGBUFFER_HPP
+#define MFRANCESCHI_CPPLIBRARIES_RINGBUFFER_HPP
+
+#include <atomic>
+
+#include "MF/Bytes.hpp"
+
+#if MF_UNIX
+
+namespace MF
+{
+    namespace Bytes
+    {
+        /**
+         * Lock-free queue of bytes between ONE producer thread and ONE consumer thread.
+         *
+         * Its memory is mapped twice, back to back, so that the readable bytes and the writable
+         * bytes are always contiguous, even when they wrap around the end: they can be given to
+         * "read", "write", a parser... without copy.
+         *
+         * Producer: "getWritableSpan", write into it, then "commit".
+         * Consumer: "getReadableSpan", read from it, then "consume".
+         * Each side only publishes its index when it commits or consumes, so batching the bytes
+         * costs one atomic store per batch.
+         *
+         * Unix only.
+         */
+        class RingBuffer {
+           public:
+            /**
+             * The capacity is rounded up to a power of 2 multiple of the page size.
+             * @throws MF::SystemErrors::SystemError if the memory cannot be mapped.
+             */
+            explicit RingBuffer(std::size_t minCapacity);
+
+            ~RingBuffer();
+
+            RingBuffer(const RingBuffer&) = delete;
+            RingBuffer& operator=(const RingBuffer&) = delete;
+
+            std::size_t getCapacity() const {
+                return capacity;
+            }
+
+            // ----- PRODUCER
+
+            /**
+             * Contiguous free bytes, maybe empty when the ring is full.
+             * The consumer index is only reloaded when fewer than "minSize" bytes are known to
+             * be free.
+             */
+            BufferSpan getWritableSpan(std::size_t minSize = 1);
+
+            /**
+             * Makes the first "nbBytes" bytes of the writable span readable.
+             * @throws std::out_of_range if more than the free bytes.
+             */
+            void commit(std::size_t nbBytes);
+
+            /// Writes all the bytes, or nothing if there is not enough room.
+            bool tryWrite(const void* data, std::size_t size);
+
+            // ----- CONSUMER
+
+            /**
+             * Contiguous readable bytes, maybe empty when the ring is empty.
+             * The producer index is only reloaded when fewer than "minSize" bytes are known to
+             * be readable.
+             */
+            BufferSpan getReadableSpan(std::size_t minSize = 1);
+
+            /**
+             * Frees the first "nbBytes" bytes of the readable span.
+             * @throws std::out_of_range if more than the readable bytes.
+             */
+            void consume(std::size_t nbBytes);
+
+            /// Copies (then consumes) up to "maxSize" bytes and returns their number.
+            std::size_t tryRead(void* output, std::size_t maxSize);
+
+           private:
+            static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+            /**
+             * The index of one side (a total of bytes, never wrapped) and its copy of the index
+             * of the other side. It is written by its side only. The object is not aligned on a
+             * cache line, so each side is padded to two lines: the fields of the two sides are
+             * then always at least a line apart, and never share one.
+             */
+            struct Side {
+                std::atomic<std::size_t> index{0};
+                std::size_t otherIndex = 0;
+                char padding[2 * CACHE_LINE_SIZE - sizeof(std::atomic<std::size_t>) -
+                             sizeof(std::size_t)];
+            };
+
+            byte* memory;
+            std::size_t capacity;
+            char padding[CACHE_LINE_SIZE];
+            Side producer;
+            Side consumer;
+        };
+    } // namespace Bytes
+} // namespace MF
+
+#endif
+
+#endif // MFRANCESCHI_CPPLIBRARIES_RINGBUFFER_HPP
@@ -0,0 +1,302 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_STRUCTCODEC_HPP
+#define MFRANCESCHI_CPPLIBRARIES_STRUCTCODEC_HPP
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "MF/Bytes.hpp"
+
+/**
+ * Describes the member "member" of "Struct", stored with the given endianness.
+ * Usage: @code MF_BYTES_FIELD(Header, magic, Endianness::BIG_ENDIAN)
+ */
+#define MF_BYTES_FIELD(Struct, member, endianness)                                      \
+    ::MF::Bytes::StructField<                                                           \
+        Struct, decltype(Struct::member), &Struct::member, ::MF::Bytes::endianness>
+
+namespace MF
+{
+    namespace Bytes
+    {
+        /**
+         * Encodes and decodes a native struct to and from a packed byte layout.
+         * The layout is described once, as a list of fields (see MF_BYTES_FIELD) and paddings,
+         * which are stored one after the other, with no alignment. Everything is resolved at
+         * compile time, so that encoding or decoding a record compiles to a few loads, "bswap"s
+         * and stores.
+         *
+         * Supported field types: arithmetic types and enums of 1, 2, 4 or 8 bytes, and C arrays
+         * of those.
+         *
+         * Usage:
+         * @code
+         * struct Header { std::uint32_t magic; char name[4]; std::uint64_t length; };
+         * using HeaderCodec = StructCodec<
+         *     Header,
+         *     MF_BYTES_FIELD(Header, magic, Endianness::BIG_ENDIAN),
+         *     MF_BYTES_FIELD(Header, name, Endianness::BIG_ENDIAN),
+         *     StructPadding<4>,
+         *     MF_BYTES_FIELD(Header, length, Endianness::LITTLE_ENDIAN)>;
+         * static_assert(HeaderCodec::packedSize == 20, "Unexpected header size.");
+         * static_assert(HeaderCodec::offsetOf<3>() == 12, "Unexpected offset of 'length'.");
+         * @endcode
+         */
+        template <typename Struct, typename... Fields>
+        struct StructCodec;
+
+        template <typename Struct, typename T, T Struct::*Member, Endianness Field_Endianness>
+        struct StructField;
+
+        /// Reserved bytes: skipped while decoding, written as zeros while encoding.
+        template <std::size_t Size>
+        struct StructPadding;
+
+        namespace detail
+        {
+            /// Converts from or to the native endianness (it is the same operation).
+            template <Endianness Other_Endianness, typename UInt>
+            constexpr UInt convertEndianness(UInt value) {
+                return (Other_Endianness == getCurrentEndianness()) ? value
+                                                                    : swapBytesInline(value);
+            }
+
+            template <typename T>
+            struct ValueCodec {
+                static_assert(
+                    std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                    "Fields must be arithmetic types, enums, or arrays of them.");
+                static_assert(
+                    sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                    "Fields must be 1, 2, 4 or 8 bytes long.");
+
+                using UInt = typename UnsignedOfSize<sizeof(T)>::type;
+
+                static constexpr std::size_t packedSize = sizeof(T);
+
+                template <Endianness Field_Endianness>
+                static void decode(const byte* input, T& value) {
+                    UInt raw;
+                    std::memcpy(&raw, input, sizeof(raw));
+                    raw = convertEndianness<Field_Endianness>(raw);
+                    std::memcpy(&value, &raw, sizeof(raw));
+                }
+
+                template <Endianness Field_Endianness>
+                static void encode(const T& value, byte* output) {
+                    UInt raw;
+                    std::memcpy(&raw, &value, sizeof(raw));
+                    raw = convertEndianness<Field_Endianness>(raw);
+                    std::memcpy(output, &raw, sizeof(raw));
+                }
+            };
+
+            template <typename T, std::size_t N>
+            struct ValueCodec<T[N]> {
+                static constexpr std::size_t packedSize = N * ValueCodec<T>::packedSize;
+
+                template <Endianness Field_Endianness>
+                static void decode(const byte* input, T (&value)[N]) {
+                    for (std::size_t i = 0; i < N; i++) {
+                        ValueCodec<T>::template decode<Field_Endianness>(
+                            input + i * ValueCodec<T>::packedSize, value[i]);
+                    }
+                }
+
+                template <Endianness Field_Endianness>
+                static void encode(const T (&value)[N], byte* output) {
+                    for (std::size_t i = 0; i < N; i++) {
+                        ValueCodec<T>::template encode<Field_Endianness>(
+                            value[i], output + i * ValueCodec<T>::packedSize);
+                    }
+                }
+            };
+
+            /// Fields laid out one after the other, the first one being at "Offset".
+            template <std::size_t Offset, typename... Fields>
+            struct FieldList;
+
+            template <std::size_t Offset>
+            struct FieldList<Offset> {
+                static constexpr std::size_t endOffset = Offset;
+
+                template <typename Struct>
+                static void decode(const byte*, Struct&) {
+                }
+
+                template <typename Struct>
+                static void encode(const Struct&, byte*) {
+                }
+            };
+
+            template <std::size_t Offset, typename First, typename... Rest>
+            struct FieldList<Offset, First, Rest...> {
+                using Next = FieldList<Offset + First::packedSize, Rest...>;
+
+                static constexpr std::size_t endOffset = Next::endOffset;
+
+                template <typename Struct>
+                static void decode(const byte* input, Struct& output) {
+                    First::decode(input + Offset, output);
+                    Next::decode(input, output);
+                }
+
+                template <typename Struct>
+                static void encode(const Struct& input, byte* output) {
+                    First::encode(input, output + Offset);
+                    Next::encode(input, output);
+                }
+            };
+
+            template <std::size_t Index, std::size_t Offset, typename... Fields>
+            struct FieldOffset;
+
+            template <std::size_t Offset, typename First, typename... Rest>
+            struct FieldOffset<0, Offset, First, Rest...> {
+                static constexpr std::size_t value = Offset;
+            };
+
+            template <std::size_t Index, std::size_t Offset, typename First, typename... Rest>
+            struct FieldOffset<Index, Offset, First, Rest...> {
+                static constexpr std::size_t value =
+                    FieldOffset<Index - 1, Offset + First::packedSize, Rest...>::value;
+            };
+
+            inline void throwForInvalidRange(
+                std::size_t offset, std::size_t size, std::size_t bufferSize) {
+                if (offset > bufferSize || size > bufferSize - offset) {
+                    throw std::out_of_range(
+                        "Range out of bounds: [" + std::to_string(offset) + ", " +
+                        std::to_string(offset) + " + " + std::to_string(size) +
+                        ") does not fit in the buffer, which size is " +
+                        std::to_string(bufferSize) + ".");
+                }
+            }
+        } // namespace detail
+
+        template <typename Struct, typename T, T Struct::*Member, Endianness Field_Endianness>
+        struct StructField {
+            static constexpr std::size_t packedSize = detail::ValueCodec<T>::packedSize;
+
+            static void decode(const byte* input, Struct& output) {
+                detail::ValueCodec<T>::template decode<Field_Endianness>(input, output.*Member);
+            }
+
+            static void encode(const Struct& input, byte* output) {
+                detail::ValueCodec<T>::template encode<Field_Endianness>(input.*Member, output);
+            }
+        };
+
+        template <std::size_t Size>
+        struct StructPadding {
+            static constexpr std::size_t packedSize = Size;
+
+            template <typename Struct>
+            static void decode(const byte*, Struct&) {
+            }
+
+            template <typename Struct>
+            static void encode(const Struct&, byte* output) {
+                std::memset(output, 0, Size);
+            }
+        };
+
+        template <typename Struct, typename... Fields>
+        struct StructCodec {
+           private:
+            using Fields_t = detail::FieldList<0, Fields...>;
+
+           public:
+            static_assert(sizeof...(Fields) > 0, "A codec needs at least one field.");
+            static_assert(
+                std::is_default_constructible<Struct>::value,
+                "The struct must be default constructible.");
+
+            /// Number of bytes of one encoded record.
+            static constexpr std::size_t packedSize = Fields_t::endOffset;
+
+            /// Offset of the Index-th field (paddings included) in an encoded record.
+            template <std::size_t Index>
+            static constexpr std::size_t offsetOf() {
+                static_assert(Index < sizeof...(Fields), "Index out of bounds.");
+                return detail::FieldOffset<Index, 0, Fields...>::value;
+            }
+
+            // ----- ONE RECORD
+
+            /// Reads "packedSize" bytes from "input".
+            static void decode(const byte* input, Struct& output) {
+                Fields_t::decode(input, output);
+            }
+
+            static Struct decode(const byte* input) {
+                Struct result{};
+                Fields_t::decode(input, result);
+                return result;
+            }
+
+            /// Writes "packedSize" bytes into "output".
+            static void encode(const Struct& input, byte* output) {
+                Fields_t::encode(input, output);
+            }
+
+            /// @throws std::out_of_range if the record does not fit in the buffer.
+            static Struct decode(const Buffer& buffer, std::size_t offset = 0) {
+                detail::throwForInvalidRange(offset, packedSize, buffer.getSize());
+                return decode(buffer.cbegin() + offset);
+            }
+
+            /// @throws std::out_of_range if the record does not fit in the buffer.
+            static void encode(const Struct& input, Buffer& buffer, std::size_t offset = 0) {
+                detail::throwForInvalidRange(offset, packedSize, buffer.getSize());
+                encode(input, buffer.begin() + offset);
+            }
+
+            // ----- ARRAYS OF RECORDS
+
+            /// Reads "count * packedSize" bytes from "input".
+            static void decodeArray(const byte* input, Struct* output, std::size_t count) {
+                for (std::size_t i = 0; i < count; i++) {
+                    Fields_t::decode(input + i * packedSize, output[i]);
+                }
+            }
+
+            /// Writes "count * packedSize" bytes into "output".
+            static void encodeArray(const Struct* input, byte* output, std::size_t count) {
+                for (std::size_t i = 0; i < count; i++) {
+                    Fields_t::encode(input[i], output + i * packedSize);
+                }
+            }
+
+            /// @throws std::out_of_range if the records do not fit in the buffer.
+            static void decodeArray(
+                const Buffer& buffer, std::size_t offset, Struct* output, std::size_t count) {
+                throwForInvalidArray(buffer, offset, count);
+                decodeArray(buffer.cbegin() + offset, output, count);
+            }
+
+            /// @throws std::out_of_range if the records do not fit in the buffer.
+            static void encodeArray(
+                const Struct* input, std::size_t count, Buffer& buffer, std::size_t offset) {
+                throwForInvalidArray(buffer, offset, count);
+                encodeArray(input, buffer.begin() + offset, count);
+            }
+
+           private:
+            static void throwForInvalidArray(
+                const Buffer& buffer, std::size_t offset, std::size_t count) {
+                if (count > static_cast<std::size_t>(-1) / packedSize) {
+                    throw std::out_of_range("Too many records: " + std::to_string(count) + ".");
+                }
+                detail::throwForInvalidRange(offset, count * packedSize, buffer.getSize());
+            }
+        };
+    } // namespace Bytes
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_STRUCTCODEC_HPP
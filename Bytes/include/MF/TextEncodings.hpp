@@ -0,0 +1,77 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_TEXTENCODINGS_HPP
+#define MFRANCESCHI_CPPLIBRARIES_TEXTENCODINGS_HPP
+
+#include <string>
+
+#include "MF/Bytes.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        /**
+         * Base64 alphabets of RFC 4648.
+         * STANDARD uses '+' and '/' and pads with '='.
+         * URL_SAFE uses '-' and '_' and does not pad.
+         */
+        enum class Base64Alphabet { STANDARD, URL_SAFE };
+
+        // ----- BASE64 ----- //
+        // The "raw" versions write into "output", which must be big enough (see the "get...Size"
+        // functions), and return the number of bytes or chars written.
+        // Decoding accepts input with or without padding, and throws std::invalid_argument
+        // when the input is not valid base64 (bad char, bad padding, bad length, non-zero unused
+        // bits in the last char...).
+        // Uses AVX2 or SSSE3 when the CPU supports it.
+
+        std::size_t getBase64EncodedSize(
+            std::size_t inputSize, Base64Alphabet alphabet = Base64Alphabet::STANDARD);
+
+        /// Exact decoded size. @throws std::invalid_argument if the length is invalid.
+        std::size_t getBase64DecodedSize(const char* input, std::size_t inputSize);
+
+        std::size_t base64Encode(
+            const void* input,
+            std::size_t inputSize,
+            char* output,
+            Base64Alphabet alphabet = Base64Alphabet::STANDARD);
+
+        std::string base64Encode(
+            const Buffer& input, Base64Alphabet alphabet = Base64Alphabet::STANDARD);
+
+        std::size_t base64Decode(
+            const char* input,
+            std::size_t inputSize,
+            void* output,
+            Base64Alphabet alphabet = Base64Alphabet::STANDARD);
+
+        /// The result comes from the BufferPool.
+        std::shared_ptr<Buffer> base64Decode(
+            const std::string& input, Base64Alphabet alphabet = Base64Alphabet::STANDARD);
+
+        // ----- HEXADECIMAL ----- //
+        // Encoding writes lower case digits, decoding accepts both cases.
+
+        inline std::size_t getHexEncodedSize(std::size_t inputSize) {
+            return inputSize * 2;
+        }
+
+        /// @throws std::invalid_argument if the length is odd.
+        std::size_t getHexDecodedSize(std::size_t inputSize);
+
+        std::size_t hexEncode(const void* input, std::size_t inputSize, char* output);
+
+        std::string hexEncode(const Buffer& input);
+
+        std::size_t hexDecode(const char* input, std::size_t inputSize, void* output);
+
+        /// The result comes from the BufferPool.
+        std::shared_ptr<Buffer> hexDecode(const std::string& input);
+    } // namespace Bytes
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_TEXTENCODINGS_HPP
@@ -5,9 +5,12 @@
 #include "MF/Bytes.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <stdexcept>
 
+#include "MF/BufferPool.hpp"
+
 #if MF_WINDOWS
 #    include <intrin.h>
 
@@ -19,11 +22,13 @@ namespace MF
     namespace Bytes
     {
 
-        void Buffer::throwForInvalidIndex(std::size_t index) {
-            if (index >= getSize()) {
+        void Buffer::throwForInvalidIndex(std::size_t index, std::size_t elementSize) {
+            const std::size_t nbElements = getSize() / elementSize;
+            if (index >= nbElements) {
                 std::ostringstream oss;
-                oss << "Index out of bounds: " << index << " is >= the buffer size, which is "
-                    << getSize() << ".";
+                oss << "Index out of bounds: " << index
+                    << " is >= the number of elements in the buffer, which is " << nbElements
+                    << ".";
                 throw std::out_of_range(oss.str());
             }
         }
@@ -70,14 +75,18 @@ namespace MF
             return std::make_shared<BufferWithRawPointer>(buffer, size);
         }
 
-        class BufferWithUniquePointer : public Buffer {
+        /// Buffer on a range of another buffer, which it keeps alive.
+        class SliceBuffer : public Buffer {
            public:
-            BufferWithUniquePointer(std::size_t size)
-                : buffer(std::make_unique<byte[]>(size)), size(size) {
+            SliceBuffer(std::shared_ptr<Buffer> parent, std::size_t offset, std::size_t size)
+                : Buffer(),
+                  parent(std::move(parent)),
+                  buffer(this->parent->getWithCast<byte>() + offset),
+                  size(size) {
             }
 
             void* get() const override {
-                return buffer.get();
+                return buffer;
             }
 
             std::size_t getSize() const override {
@@ -85,12 +94,26 @@ namespace MF
             }
 
            private:
-            const std::unique_ptr<byte[]> buffer;
+            const std::shared_ptr<Buffer> parent;
+            byte* const buffer;
             const std::size_t size;
         };
 
+        std::shared_ptr<Buffer> Buffer::slice(std::size_t offset, std::size_t length) {
+            const std::size_t size = getSize();
+            if (offset > size || length > size - offset) {
+                std::ostringstream oss;
+                oss << "Range out of bounds: [" << offset << ", " << offset << " + " << length
+                    << ") does not fit in the buffer, which size is " << size << ".";
+                throw std::out_of_range(oss.str());
+            }
+            return std::make_shared<SliceBuffer>(shared_from_this(), offset, length);
+        }
+
         std::shared_ptr<Buffer> makeBufferWithSize(std::size_t size) {
-            return std::make_shared<BufferWithUniquePointer>(size);
+            auto buffer = BufferPool::makeBuffer(size);
+            std::memset(buffer->get(), 0, size);
+            return buffer;
         }
 
         std::uint16_t swapBytes(std::uint16_t value) {
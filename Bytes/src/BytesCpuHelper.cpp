@@ -0,0 +1,86 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include "BytesCpuHelper.hpp"
+
+#if MF_BYTES_SIMD
+#    if defined(_MSC_VER)
+#        include <intrin.h>
+#    else
+#        include <cpuid.h>
+#    endif
+#endif
+
+namespace MF
+{
+    namespace Bytes
+    {
+#if MF_BYTES_SIMD
+        struct CpuidRegisters {
+            unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        };
+
+        static CpuidRegisters callCpuid(unsigned int leaf, unsigned int subleaf) {
+            CpuidRegisters result;
+#    if defined(_MSC_VER)
+            int registers[4] = {0};
+            __cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subleaf));
+            result.eax = static_cast<unsigned int>(registers[0]);
+            result.ebx = static_cast<unsigned int>(registers[1]);
+            result.ecx = static_cast<unsigned int>(registers[2]);
+            result.edx = static_cast<unsigned int>(registers[3]);
+#    else
+            __cpuid_count(leaf, subleaf, result.eax, result.ebx, result.ecx, result.edx);
+#    endif
+            return result;
+        }
+
+        /// Returns the XCR0 register, which tells which registers the OS saves.
+        static unsigned long long readXcr0() {
+#    if defined(_MSC_VER)
+            return _xgetbv(0);
+#    else
+            unsigned int eax = 0, edx = 0;
+            __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<unsigned long long>(edx) << 32) | eax;
+#    endif
+        }
+
+        static CpuFeatures detectCpuFeatures() {
+            CpuFeatures features;
+
+            const unsigned int maxLeaf = callCpuid(0, 0).eax;
+            if (maxLeaf < 1) {
+                return features;
+            }
+
+            const CpuidRegisters leaf1 = callCpuid(1, 0);
+            features.sse2 = (leaf1.edx & (1U << 26)) != 0;
+            features.ssse3 = (leaf1.ecx & (1U << 9)) != 0;
+            features.sse41 = (leaf1.ecx & (1U << 19)) != 0;
+            features.sse42 = (leaf1.ecx & (1U << 20)) != 0;
+            features.pclmul = (leaf1.ecx & (1U << 1)) != 0;
+
+            const bool osUsesXsave = (leaf1.ecx & (1U << 27)) != 0;
+            const bool cpuHasAvx = (leaf1.ecx & (1U << 28)) != 0;
+            // The OS must save both the XMM and YMM registers.
+            const bool osSavesYmm = osUsesXsave && (readXcr0() & 0x6) == 0x6;
+            if (maxLeaf >= 7 && cpuHasAvx && osSavesYmm) {
+                features.avx2 = (callCpuid(7, 0).ebx & (1U << 5)) != 0;
+            }
+
+            return features;
+        }
+#else
+        static CpuFeatures detectCpuFeatures() {
+            return CpuFeatures();
+        }
+#endif
+
+        const CpuFeatures& getCpuFeatures() {
+            static const CpuFeatures features = detectCpuFeatures();
+            return features;
+        }
+    } // namespace Bytes
+} // namespace MF
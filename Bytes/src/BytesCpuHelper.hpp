@@ -0,0 +1,61 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_BYTESCPUHELPER_HPP
+#define MFRANCESCHI_CPPLIBRARIES_BYTESCPUHELPER_HPP
+
+// MF_BYTES_SIMD is true when the x86 SIMD kernels can be compiled.
+// They are always compiled (whatever the -m flags), then chosen at runtime.
+#if (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)) && \
+    (defined(__GNUC__) || defined(_MSC_VER))
+#    define MF_BYTES_SIMD 1
+#    include <immintrin.h>
+#else
+#    define MF_BYTES_SIMD 0
+#endif
+
+// Allows using the intrinsics of an instruction set in one function only.
+// MSVC does not need it.
+#if MF_BYTES_SIMD && defined(__GNUC__)
+#    define MF_BYTES_TARGET(features) __attribute__((target(features)))
+#else
+#    define MF_BYTES_TARGET(features)
+#endif
+
+#include <cstdint>
+#if defined(_MSC_VER)
+#    include <intrin.h>
+#endif
+
+namespace MF
+{
+    namespace Bytes
+    {
+        /// Instruction sets available on the running CPU (and enabled by the OS).
+        struct CpuFeatures {
+            bool sse2 = false;
+            bool ssse3 = false;
+            bool sse41 = false;
+            bool sse42 = false;
+            bool pclmul = false;
+            bool avx2 = false;
+        };
+
+        /// Detected once, then cached.
+        const CpuFeatures& getCpuFeatures();
+
+        /// Index of the lowest set bit, for the masks of "movemask". "value" must not be 0.
+        inline unsigned int countTrailingZeros(std::uint32_t value) {
+#if defined(_MSC_VER)
+            unsigned long index = 0;
+            _BitScanForward(&index, value);
+            return static_cast<unsigned int>(index);
+#else
+            return static_cast<unsigned int>(__builtin_ctz(value));
+#endif
+        }
+    } // namespace Bytes
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_BYTESCPUHELPER_HPP
@@ -0,0 +1,173 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include "MF/Bytes.hpp"
+
+#if MF_WINDOWS
+#    include <malloc.h>
+#endif
+
+#if MF_UNIX
+#    include <cerrno>
+
+#    include <sys/mman.h>
+
+#    include "MF/SystemErrors.hpp"
+#endif
+
+namespace MF
+{
+    namespace Bytes
+    {
+        static std::size_t roundUp(std::size_t value, std::size_t multiple) {
+            if (value > static_cast<std::size_t>(-1) - (multiple - 1)) {
+                throw std::bad_alloc();
+            }
+            return (value + multiple - 1) / multiple * multiple;
+        }
+
+        /// Memory from the aligned variant of malloc.
+        class AlignedBuffer : public Buffer {
+           public:
+            AlignedBuffer(std::size_t size, std::size_t alignment) : Buffer(), size(size) {
+                if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+                    throw std::invalid_argument(
+                        "The alignment must be a power of 2, got " + std::to_string(alignment) +
+                        ".");
+                }
+                // Both allocators reject alignments smaller than a pointer, and may return
+                // nullptr for an empty block.
+                alignment = std::max(alignment, sizeof(void*));
+                const std::size_t allocatedSize = std::max<std::size_t>(size, 1);
+#if MF_WINDOWS
+                buffer = _aligned_malloc(allocatedSize, alignment);
+#else
+                if (posix_memalign(&buffer, alignment, allocatedSize) != 0) {
+                    buffer = nullptr;
+                }
+#endif
+                if (buffer == nullptr) {
+                    throw std::bad_alloc();
+                }
+                std::memset(buffer, 0, size);
+            }
+
+            ~AlignedBuffer() override {
+#if MF_WINDOWS
+                _aligned_free(buffer);
+#else
+                std::free(buffer);
+#endif
+            }
+
+            AlignedBuffer(const AlignedBuffer&) = delete;
+            AlignedBuffer& operator=(const AlignedBuffer&) = delete;
+
+            void* get() const override {
+                return buffer;
+            }
+
+            std::size_t getSize() const override {
+                return size;
+            }
+
+            bool ownsWritableBytes() const override {
+                return true;
+            }
+
+           private:
+            void* buffer = nullptr;
+            const std::size_t size;
+        };
+
+        std::shared_ptr<Buffer> makeAlignedBuffer(std::size_t size, std::size_t alignment) {
+            return std::make_shared<AlignedBuffer>(size, alignment);
+        }
+
+#if MF_UNIX
+        /// Memory mapped on its own, aligned on HUGE_PAGE_SIZE. It is zero-filled by the kernel.
+        class HugePageBuffer : public Buffer {
+           public:
+            explicit HugePageBuffer(std::size_t size)
+                : Buffer(),
+                  mappedSize(roundUp(std::max<std::size_t>(size, 1), HUGE_PAGE_SIZE)),
+                  size(size) {
+#    ifdef MAP_HUGETLB
+                buffer = mmap(
+                    nullptr, mappedSize, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if (buffer != MAP_FAILED) {
+                    return;
+                }
+#    endif
+                // Not enough reserved huge pages: maps one more huge page than needed, so that
+                // the aligned part can be kept and the rest given back.
+                const std::size_t reservedSize = mappedSize + HUGE_PAGE_SIZE;
+                void* const area = mmap(
+                    nullptr, reservedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                    -1, 0);
+                MF::SystemErrors::Errno::throwCurrentSystemErrorIf(area == MAP_FAILED);
+
+                byte* const begin = static_cast<byte*>(area);
+                byte* const aligned = reinterpret_cast<byte*>(
+                    roundUp(reinterpret_cast<std::uintptr_t>(begin), HUGE_PAGE_SIZE));
+                byte* const alignedEnd = aligned + mappedSize;
+                byte* const end = begin + reservedSize;
+                if (aligned != begin) {
+                    munmap(begin, static_cast<std::size_t>(aligned - begin));
+                }
+                if (alignedEnd != end) {
+                    munmap(alignedEnd, static_cast<std::size_t>(end - alignedEnd));
+                }
+                buffer = aligned;
+#    ifdef MADV_HUGEPAGE
+                // Only a hint: the kernel may have transparent huge pages disabled.
+                madvise(buffer, mappedSize, MADV_HUGEPAGE);
+#    endif
+            }
+
+            ~HugePageBuffer() override {
+                munmap(buffer, mappedSize);
+            }
+
+            HugePageBuffer(const HugePageBuffer&) = delete;
+            HugePageBuffer& operator=(const HugePageBuffer&) = delete;
+
+            void* get() const override {
+                return buffer;
+            }
+
+            std::size_t getSize() const override {
+                return size;
+            }
+
+            bool ownsWritableBytes() const override {
+                return true;
+            }
+
+           private:
+            void* buffer = nullptr;
+            const std::size_t mappedSize;
+            const std::size_t size;
+        };
+
+        std::shared_ptr<Buffer> makeHugePageBuffer(std::size_t size) {
+            return std::make_shared<HugePageBuffer>(size);
+        }
+#else
+        std::shared_ptr<Buffer> makeHugePageBuffer(std::size_t size) {
+            const auto result = makeAlignedBuffer(roundUp(size, HUGE_PAGE_SIZE), HUGE_PAGE_SIZE);
+            return result->slice(0, size);
+        }
+#endif
+    } // namespace Bytes
+} // namespace MF
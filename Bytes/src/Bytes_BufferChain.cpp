@@ -0,0 +1,162 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "MF/BufferChain.hpp"
+#include "MF/BufferPool.hpp"
+
+#if MF_UNIX
+#    include <cerrno>
+#    include <climits>
+
+#    include <unistd.h>
+
+#    include "MF/SystemErrors.hpp"
+#endif
+
+namespace MF
+{
+    namespace Bytes
+    {
+        void BufferChain::append(std::shared_ptr<Buffer> buffer) {
+            const std::size_t bufferSize = buffer->getSize();
+            if (bufferSize != 0) {
+                buffers.push_back(std::move(buffer));
+                size += bufferSize;
+            }
+        }
+
+        void BufferChain::append(const BufferChain& other) {
+            // Copy first, in case "other" is this chain.
+            const Buffers_t otherBuffers = other.buffers;
+            buffers.insert(buffers.end(), otherBuffers.cbegin(), otherBuffers.cend());
+            size += other.size;
+        }
+
+        void BufferChain::prepend(std::shared_ptr<Buffer> buffer) {
+            const std::size_t bufferSize = buffer->getSize();
+            if (bufferSize != 0) {
+                buffers.push_front(std::move(buffer));
+                size += bufferSize;
+            }
+        }
+
+        void BufferChain::prepend(const BufferChain& other) {
+            const Buffers_t otherBuffers = other.buffers;
+            buffers.insert(buffers.begin(), otherBuffers.cbegin(), otherBuffers.cend());
+            size += other.size;
+        }
+
+        void BufferChain::clear() {
+            buffers.clear();
+            size = 0;
+        }
+
+        void BufferChain::throwForInvalidLength(std::size_t length) const {
+            if (length > size) {
+                std::ostringstream oss;
+                oss << "Length out of bounds: " << length << " is > the chain size, which is "
+                    << size << ".";
+                throw std::out_of_range(oss.str());
+            }
+        }
+
+        void BufferChain::consume(std::size_t length) {
+            throwForInvalidLength(length);
+
+            size -= length;
+            while (length != 0) {
+                const std::size_t frontSize = buffers.front()->getSize();
+                if (length < frontSize) {
+                    buffers.front() = buffers.front()->slice(length, frontSize - length);
+                    return;
+                }
+                buffers.pop_front();
+                length -= frontSize;
+            }
+        }
+
+        BufferChain BufferChain::split(std::size_t length) {
+            throwForInvalidLength(length);
+
+            BufferChain result;
+            while (result.size != length) {
+                const std::size_t missing = length - result.size;
+                const std::size_t frontSize = buffers.front()->getSize();
+                if (missing < frontSize) {
+                    result.append(buffers.front()->slice(0, missing));
+                    buffers.front() = buffers.front()->slice(missing, frontSize - missing);
+                } else {
+                    result.append(std::move(buffers.front()));
+                    buffers.pop_front();
+                }
+            }
+            size -= length;
+            return result;
+        }
+
+        void BufferChain::copyTo(void* output) const {
+            byte* position = static_cast<byte*>(output);
+            for (const auto& buffer : buffers) {
+                std::memcpy(position, buffer->get(), buffer->getSize());
+                position += buffer->getSize();
+            }
+        }
+
+        std::shared_ptr<Buffer> BufferChain::flatten() const {
+            if (buffers.size() == 1) {
+                return buffers.front();
+            }
+
+            auto result = BufferPool::makeBuffer(size);
+            copyTo(result->get());
+            return result;
+        }
+
+#if MF_UNIX
+        std::vector<struct iovec> BufferChain::getIovecs() const {
+            std::vector<struct iovec> result(buffers.size());
+            std::transform(
+                buffers.cbegin(), buffers.cend(), result.begin(),
+                [](const std::shared_ptr<Buffer>& buffer) {
+                    struct iovec ioVector {};
+                    ioVector.iov_base = buffer->get();
+                    ioVector.iov_len = buffer->getSize();
+                    return ioVector;
+                });
+            return result;
+        }
+
+        void BufferChain::writeTo(int fileDescriptor) {
+#    ifdef IOV_MAX
+            const std::size_t maxIovecs = IOV_MAX;
+#    else
+            const std::size_t maxIovecs = 1024;
+#    endif
+
+            std::vector<struct iovec> ioVectors;
+            while (!isEmpty()) {
+                const std::size_t count = std::min(buffers.size(), maxIovecs);
+                ioVectors.resize(count);
+                for (std::size_t i = 0; i < count; i++) {
+                    ioVectors[i].iov_base = buffers[i]->get();
+                    ioVectors[i].iov_len = buffers[i]->getSize();
+                }
+
+                const ssize_t written =
+                    writev(fileDescriptor, ioVectors.data(), static_cast<int>(count));
+                if (written == -1 && errno == EINTR) {
+                    continue;
+                }
+                MF::SystemErrors::Errno::throwCurrentSystemErrorIf(written == -1);
+                consume(static_cast<std::size_t>(written));
+            }
+        }
+#endif
+    } // namespace Bytes
+} // namespace MF
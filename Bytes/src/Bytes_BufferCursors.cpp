@@ -0,0 +1,142 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+
+#include "MF/BufferCursors.hpp"
+#include "MF/BufferPool.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        // ----- READER ----- //
+
+        BufferReader::BufferReader(std::shared_ptr<Buffer> buffer, Endianness endianness)
+            : owner(std::move(buffer)), span(owner->getSpan()), endianness(endianness) {
+        }
+
+        BufferReader::BufferReader(BufferSpan span, Endianness endianness)
+            : owner(), span(span), endianness(endianness) {
+        }
+
+        void BufferReader::throwForMissingBytes(std::size_t nbBytes) const {
+            std::ostringstream oss;
+            oss << "Cannot read " << nbBytes << " bytes at position " << position
+                << ": only " << getRemaining() << " bytes remain.";
+            throw std::out_of_range(oss.str());
+        }
+
+        void BufferReader::readBytes(void* output, std::size_t nbBytes) {
+            require(nbBytes);
+            if (nbBytes != 0) {
+                std::memcpy(output, span.data() + position, nbBytes);
+            }
+            position += nbBytes;
+        }
+
+        std::uint64_t BufferReader::readVarUInt() {
+            const byte* const input = span.data() + position;
+            const std::size_t maxLength = std::min(getRemaining(), detail::MAX_VARINT_LENGTH);
+
+            std::uint64_t result = 0;
+            for (std::size_t i = 0; i < maxLength; i++) {
+                const byte current = input[i];
+                // The 10th byte can only hold the 64th bit.
+                if (i == detail::MAX_VARINT_LENGTH - 1 && current > 1) {
+                    throw std::invalid_argument("Invalid varint: it overflows 64 bits.");
+                }
+
+                result |= static_cast<std::uint64_t>(current & 0x7F) << (7 * i);
+                if ((current & 0x80) == 0) {
+                    position += i + 1;
+                    return result;
+                }
+            }
+
+            if (maxLength == detail::MAX_VARINT_LENGTH) {
+                throw std::invalid_argument("Invalid varint: it is too long.");
+            }
+            throwForMissingBytes(maxLength + 1);
+        }
+
+        BufferSpan BufferReader::readLengthPrefixedSpan() {
+            const std::size_t startPosition = position;
+            const std::uint64_t length = readVarUInt();
+            if (length > getRemaining()) {
+                position = startPosition;
+                throwForMissingBytes(static_cast<std::size_t>(length));
+            }
+
+            const BufferSpan result(span.data() + position, static_cast<std::size_t>(length));
+            position += result.size();
+            return result;
+        }
+
+        std::string BufferReader::readLengthPrefixedString() {
+            const BufferSpan view = readLengthPrefixedSpan();
+            return std::string(view.begin(), view.end());
+        }
+
+        // ----- WRITER ----- //
+
+        BufferWriter::BufferWriter(Endianness endianness, std::size_t initialCapacity)
+            : storage(BufferPool::makeBuffer(initialCapacity)),
+              span(storage->getSpan()),
+              endianness(endianness),
+              initialCapacity(initialCapacity) {
+        }
+
+        void BufferWriter::grow(std::size_t nbBytes) {
+            if (nbBytes > static_cast<std::size_t>(-1) - position) {
+                throw std::bad_alloc();
+            }
+            const std::size_t newCapacity = std::max(span.size() * 2, position + nbBytes);
+
+            auto newStorage = BufferPool::makeBuffer(newCapacity);
+            std::memcpy(newStorage->get(), span.data(), position);
+            storage = std::move(newStorage);
+            span = storage->getSpan();
+        }
+
+        void BufferWriter::writeBytes(const void* input, std::size_t nbBytes) {
+            reserve(nbBytes);
+            if (nbBytes != 0) {
+                std::memcpy(span.data() + position, input, nbBytes);
+            }
+            position += nbBytes;
+        }
+
+        void BufferWriter::writeVarUInt(std::uint64_t value) {
+            reserve(detail::MAX_VARINT_LENGTH);
+
+            byte* const output = span.data() + position;
+            std::size_t length = 0;
+            while (value >= 0x80) {
+                output[length++] = static_cast<byte>(value | 0x80);
+                value >>= 7;
+            }
+            output[length++] = static_cast<byte>(value);
+            position += length;
+        }
+
+        void BufferWriter::writeLengthPrefixed(const void* input, std::size_t nbBytes) {
+            writeVarUInt(nbBytes);
+            writeBytes(input, nbBytes);
+        }
+
+        std::shared_ptr<Buffer> BufferWriter::finish() {
+            auto result = storage->slice(0, position);
+
+            storage = BufferPool::makeBuffer(initialCapacity);
+            span = storage->getSpan();
+            position = 0;
+            return result;
+        }
+    } // namespace Bytes
+} // namespace MF
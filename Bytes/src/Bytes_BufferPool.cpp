@@ -0,0 +1,231 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <cstddef>
+#include <new>
+
+#include "MF/BufferPool.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        namespace BufferPool
+        {
+            // Size classes are 128, 256, ..., MAX_POOLED_BLOCK_SIZE bytes.
+            static constexpr std::size_t MIN_BLOCK_SIZE = 128;
+            static constexpr std::size_t NB_SIZE_CLASSES = 10;
+            static_assert(
+                (MIN_BLOCK_SIZE << (NB_SIZE_CLASSES - 1)) == MAX_POOLED_BLOCK_SIZE,
+                "The size classes do not match MAX_POOLED_BLOCK_SIZE.");
+
+            /// Each thread keeps at most this amount of free memory per size class.
+            static constexpr std::size_t MAX_CACHED_BYTES_PER_CLASS = 1024 * 1024;
+
+            static constexpr std::size_t BLOCK_ALIGNMENT = alignof(std::max_align_t);
+
+            static std::size_t getSizeClass(std::size_t blockSize) {
+                std::size_t sizeClass = 0;
+                for (std::size_t classSize = MIN_BLOCK_SIZE; classSize < blockSize;
+                     classSize <<= 1) {
+                    sizeClass++;
+                }
+                return sizeClass;
+            }
+
+            static std::size_t getClassBlockSize(std::size_t sizeClass) {
+                return MIN_BLOCK_SIZE << sizeClass;
+            }
+
+            static std::size_t getMaxCachedBlocks(std::size_t sizeClass) {
+                const std::size_t maxBlocks =
+                    MAX_CACHED_BYTES_PER_CLASS / getClassBlockSize(sizeClass);
+                return maxBlocks < 4 ? 4 : maxBlocks;
+            }
+
+            // ----- THREAD-LOCAL FREE LISTS ----- //
+
+            /// A free block stores the link to the next one in its own memory.
+            struct FreeBlock {
+                FreeBlock* next;
+            };
+
+            struct ThreadCache {
+                FreeBlock* heads[NB_SIZE_CLASSES] = {};
+                std::size_t counts[NB_SIZE_CLASSES] = {};
+
+                ThreadCache() = default;
+                ThreadCache(const ThreadCache&) = delete;
+                ThreadCache& operator=(const ThreadCache&) = delete;
+
+                ~ThreadCache();
+
+                void releaseAll() {
+                    for (std::size_t sizeClass = 0; sizeClass < NB_SIZE_CLASSES; sizeClass++) {
+                        while (heads[sizeClass] != nullptr) {
+                            FreeBlock* const block = heads[sizeClass];
+                            heads[sizeClass] = block->next;
+                            ::operator delete(block);
+                        }
+                        counts[sizeClass] = 0;
+                    }
+                }
+            };
+
+            // Trivially destructible, so that it stays usable after the cache is destroyed:
+            // buffers may still be released later during the thread (or program) exit.
+            static thread_local bool threadCacheDestroyed = false;
+
+            ThreadCache::~ThreadCache() {
+                releaseAll();
+                threadCacheDestroyed = true;
+            }
+
+            /// @return nullptr if the calling thread is exiting.
+            static ThreadCache* getThreadCache() {
+                if (threadCacheDestroyed) {
+                    return nullptr;
+                }
+                static thread_local ThreadCache cache;
+                return &cache;
+            }
+
+            static void* allocateBlock(std::size_t blockSize) {
+                if (blockSize > MAX_POOLED_BLOCK_SIZE) {
+                    return ::operator new(blockSize);
+                }
+
+                const std::size_t sizeClass = getSizeClass(blockSize);
+                ThreadCache* const cache = getThreadCache();
+                if (cache != nullptr && cache->heads[sizeClass] != nullptr) {
+                    FreeBlock* const block = cache->heads[sizeClass];
+                    cache->heads[sizeClass] = block->next;
+                    cache->counts[sizeClass]--;
+                    return block;
+                }
+                return ::operator new(getClassBlockSize(sizeClass));
+            }
+
+            static void releaseBlock(void* block, std::size_t blockSize) {
+                if (blockSize <= MAX_POOLED_BLOCK_SIZE) {
+                    const std::size_t sizeClass = getSizeClass(blockSize);
+                    ThreadCache* const cache = getThreadCache();
+                    if (cache != nullptr &&
+                        cache->counts[sizeClass] < getMaxCachedBlocks(sizeClass)) {
+                        FreeBlock* const freeBlock = static_cast<FreeBlock*>(block);
+                        freeBlock->next = cache->heads[sizeClass];
+                        cache->heads[sizeClass] = freeBlock;
+                        cache->counts[sizeClass]++;
+                        return;
+                    }
+                }
+                ::operator delete(block);
+            }
+
+            // ----- ALLOCATOR FOR "std::allocate_shared" ----- //
+
+            /**
+             * Allocates the shared_ptr control block (which contains the Buffer object) with
+             * the memory of the buffer right after it, in the same block.
+             */
+            template <typename T>
+            struct BlockAllocator {
+                using value_type = T;
+
+                BlockAllocator(std::size_t payloadSize, byte** payloadAddress)
+                    : payloadSize(payloadSize), payloadAddress(payloadAddress) {
+                }
+
+                template <typename U>
+                BlockAllocator(const BlockAllocator<U>& other)
+                    : payloadSize(other.payloadSize), payloadAddress(other.payloadAddress) {
+                }
+
+                T* allocate(std::size_t n) {
+                    const std::size_t headerSize = getHeaderSize(n);
+                    if (payloadSize > static_cast<std::size_t>(-1) - headerSize) {
+                        throw std::bad_alloc();
+                    }
+                    byte* const block =
+                        static_cast<byte*>(allocateBlock(headerSize + payloadSize));
+                    *payloadAddress = block + headerSize;
+                    return reinterpret_cast<T*>(block);
+                }
+
+                void deallocate(T* pointer, std::size_t n) {
+                    releaseBlock(pointer, getHeaderSize(n) + payloadSize);
+                }
+
+                static std::size_t getHeaderSize(std::size_t n) {
+                    const std::size_t size = n * sizeof(T);
+                    return (size + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT;
+                }
+
+                std::size_t payloadSize;
+                // Only written by "allocate", which happens once, inside "allocate_shared".
+                byte** payloadAddress;
+            };
+
+            template <typename T, typename U>
+            bool operator==(const BlockAllocator<T>& lhs, const BlockAllocator<U>& rhs) {
+                return lhs.payloadSize == rhs.payloadSize;
+            }
+
+            template <typename T, typename U>
+            bool operator!=(const BlockAllocator<T>& lhs, const BlockAllocator<U>& rhs) {
+                return !(lhs == rhs);
+            }
+
+            class PooledBuffer : public Buffer {
+               public:
+                /// "payloadAddress" is only read here, after the block has been allocated.
+                PooledBuffer(byte* const* payloadAddress, std::size_t size)
+                    : Buffer(), buffer(*payloadAddress), size(size) {
+                }
+
+                void* get() const override {
+                    return buffer;
+                }
+
+                std::size_t getSize() const override {
+                    return size;
+                }
+
+                bool ownsWritableBytes() const override {
+                    return true;
+                }
+
+               private:
+                byte* const buffer;
+                const std::size_t size;
+            };
+
+            std::shared_ptr<Buffer> makeBuffer(std::size_t size) {
+                byte* payload = nullptr;
+                return std::allocate_shared<PooledBuffer>(
+                    BlockAllocator<PooledBuffer>(size, &payload), &payload, size);
+            }
+
+            std::size_t getThreadCachedBlocksCount() {
+                const ThreadCache* const cache = getThreadCache();
+                if (cache == nullptr) {
+                    return 0;
+                }
+
+                std::size_t result = 0;
+                for (const std::size_t count : cache->counts) {
+                    result += count;
+                }
+                return result;
+            }
+
+            void releaseThreadCache() {
+                ThreadCache* const cache = getThreadCache();
+                if (cache != nullptr) {
+                    cache->releaseAll();
+                }
+            }
+        } // namespace BufferPool
+    } // namespace Bytes
+} // namespace MF
@@ -0,0 +1,441 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "BytesCpuHelper.hpp"
+#include "MF/BufferSearch.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        /// Converts a result on a sub-range starting at "offset" to a result on the whole range.
+        static inline std::size_t addOffset(std::size_t result, std::size_t offset) {
+            return (result == NOT_FOUND) ? NOT_FOUND : result + offset;
+        }
+
+        // ----- SCALAR ----- //
+        // The patterns given to the kernels have at least 2 bytes.
+
+        static std::size_t findByteWithScalar(const byte* data, std::size_t size, byte value) {
+            const void* const found = (size == 0) ? nullptr : std::memchr(data, value, size);
+            return (found == nullptr) ? NOT_FOUND
+                                      : static_cast<std::size_t>(static_cast<const byte*>(found) -
+                                                                 data);
+        }
+
+        static std::size_t findAnyByteWithScalar(
+            const byte* data, std::size_t size, const ByteSet& values) {
+            for (std::size_t i = 0; i < size; i++) {
+                if (values.contains(data[i])) {
+                    return i;
+                }
+            }
+            return NOT_FOUND;
+        }
+
+        static std::size_t findPatternWithScalar(
+            const byte* data, std::size_t size, const byte* pattern, std::size_t patternSize) {
+            if (patternSize > size) {
+                return NOT_FOUND;
+            }
+
+            const std::size_t lastCandidate = size - patternSize;
+            for (std::size_t i = 0; i <= lastCandidate; i++) {
+                const std::size_t candidate =
+                    findByteWithScalar(data + i, lastCandidate - i + 1, pattern[0]);
+                if (candidate == NOT_FOUND) {
+                    return NOT_FOUND;
+                }
+                i += candidate;
+                if (std::memcmp(data + i + 1, pattern + 1, patternSize - 1) == 0) {
+                    return i;
+                }
+            }
+            return NOT_FOUND;
+        }
+
+        static std::size_t countByteWithScalar(const byte* data, std::size_t size, byte value) {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i < size; i++) {
+                result += (data[i] == value) ? 1 : 0;
+            }
+            return result;
+        }
+
+        // ----- SIMD ----- //
+        // Each kernel searches whole blocks, then gives the tail to a narrower kernel.
+
+#if MF_BYTES_SIMD
+        MF_BYTES_TARGET("sse2")
+        static std::size_t findByteWithSse2(const byte* data, std::size_t size, byte value) {
+            const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+
+            std::size_t i = 0;
+            for (; i + 16 <= size; i += 16) {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                const auto mask =
+                    static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+                if (mask != 0) {
+                    return i + countTrailingZeros(mask);
+                }
+            }
+            return addOffset(findByteWithScalar(data + i, size - i, value), i);
+        }
+
+        MF_BYTES_TARGET("avx2")
+        static std::size_t findByteWithAvx2(const byte* data, std::size_t size, byte value) {
+            const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
+
+            std::size_t i = 0;
+            for (; i + 32 <= size; i += 32) {
+                const __m256i block =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const auto mask = static_cast<std::uint32_t>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+                if (mask != 0) {
+                    return i + countTrailingZeros(mask);
+                }
+            }
+            return addOffset(findByteWithSse2(data + i, size - i, value), i);
+        }
+
+        // A byte is in the set when the bit (value >> 4) & 7 of bitmaps[value >> 7][value & 0xF]
+        // is set. "shuffle" gives 0 for the indices which have their high bit set, so each
+        // bitmap is looked up with the values of its half only.
+
+        MF_BYTES_TARGET("ssse3")
+        static std::size_t findAnyByteWithSsse3(
+            const byte* data, std::size_t size, const ByteSet& values) {
+            const __m128i lowHalf =
+                _mm_load_si128(reinterpret_cast<const __m128i*>(values.getBitmaps(0)));
+            const __m128i highHalf =
+                _mm_load_si128(reinterpret_cast<const __m128i*>(values.getBitmaps(1)));
+            const __m128i bits = _mm_setr_epi8(
+                1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+            const __m128i highBit = _mm_set1_epi8(-128);
+            const __m128i lowNibble = _mm_set1_epi8(0x0F);
+
+            std::size_t i = 0;
+            for (; i + 16 <= size; i += 16) {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                const __m128i bitmaps = _mm_or_si128(
+                    _mm_shuffle_epi8(lowHalf, block),
+                    _mm_shuffle_epi8(highHalf, _mm_xor_si128(block, highBit)));
+                const __m128i bit =
+                    _mm_shuffle_epi8(bits, _mm_and_si128(_mm_srli_epi16(block, 4), lowNibble));
+                const auto mask = static_cast<std::uint32_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bitmaps, bit), bit)));
+                if (mask != 0) {
+                    return i + countTrailingZeros(mask);
+                }
+            }
+            return addOffset(findAnyByteWithScalar(data + i, size - i, values), i);
+        }
+
+        MF_BYTES_TARGET("avx2")
+        static std::size_t findAnyByteWithAvx2(
+            const byte* data, std::size_t size, const ByteSet& values) {
+            const __m256i lowHalf = _mm256_broadcastsi128_si256(
+                _mm_load_si128(reinterpret_cast<const __m128i*>(values.getBitmaps(0))));
+            const __m256i highHalf = _mm256_broadcastsi128_si256(
+                _mm_load_si128(reinterpret_cast<const __m128i*>(values.getBitmaps(1))));
+            const __m256i bits = _mm256_setr_epi8(
+                1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32,
+                64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+            const __m256i highBit = _mm256_set1_epi8(-128);
+            const __m256i lowNibble = _mm256_set1_epi8(0x0F);
+
+            std::size_t i = 0;
+            for (; i + 32 <= size; i += 32) {
+                const __m256i block =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const __m256i bitmaps = _mm256_or_si256(
+                    _mm256_shuffle_epi8(lowHalf, block),
+                    _mm256_shuffle_epi8(highHalf, _mm256_xor_si256(block, highBit)));
+                const __m256i bit = _mm256_shuffle_epi8(
+                    bits, _mm256_and_si256(_mm256_srli_epi16(block, 4), lowNibble));
+                const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(
+                    _mm256_cmpeq_epi8(_mm256_and_si256(bitmaps, bit), bit)));
+                if (mask != 0) {
+                    return i + countTrailingZeros(mask);
+                }
+            }
+            return addOffset(findAnyByteWithSsse3(data + i, size - i, values), i);
+        }
+
+        MF_BYTES_TARGET("sse2")
+        static std::size_t findPatternWithSse2(
+            const byte* data, std::size_t size, const byte* pattern, std::size_t patternSize) {
+            const __m128i first = _mm_set1_epi8(static_cast<char>(pattern[0]));
+            const __m128i last = _mm_set1_epi8(static_cast<char>(pattern[patternSize - 1]));
+            const std::size_t lastOffset = patternSize - 1;
+
+            std::size_t i = 0;
+            for (; i + lastOffset + 16 <= size; i += 16) {
+                const __m128i firstBlock =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                const __m128i lastBlock =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + lastOffset));
+                auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(
+                    _mm_cmpeq_epi8(firstBlock, first), _mm_cmpeq_epi8(lastBlock, last))));
+                for (; mask != 0; mask &= mask - 1) {
+                    const std::size_t candidate = i + countTrailingZeros(mask);
+                    if (std::memcmp(data + candidate + 1, pattern + 1, patternSize - 2) == 0) {
+                        return candidate;
+                    }
+                }
+            }
+            return addOffset(findPatternWithScalar(data + i, size - i, pattern, patternSize), i);
+        }
+
+        MF_BYTES_TARGET("avx2")
+        static std::size_t findPatternWithAvx2(
+            const byte* data, std::size_t size, const byte* pattern, std::size_t patternSize) {
+            const __m256i first = _mm256_set1_epi8(static_cast<char>(pattern[0]));
+            const __m256i last = _mm256_set1_epi8(static_cast<char>(pattern[patternSize - 1]));
+            const std::size_t lastOffset = patternSize - 1;
+
+            std::size_t i = 0;
+            for (; i + lastOffset + 32 <= size; i += 32) {
+                const __m256i firstBlock =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                const __m256i lastBlock =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + lastOffset));
+                auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(
+                    _mm256_cmpeq_epi8(firstBlock, first), _mm256_cmpeq_epi8(lastBlock, last))));
+                for (; mask != 0; mask &= mask - 1) {
+                    const std::size_t candidate = i + countTrailingZeros(mask);
+                    if (std::memcmp(data + candidate + 1, pattern + 1, patternSize - 2) == 0) {
+                        return candidate;
+                    }
+                }
+            }
+            return addOffset(findPatternWithSse2(data + i, size - i, pattern, patternSize), i);
+        }
+
+        // The counters are bytes: they are summed with "sad" at most every 255 blocks.
+
+        MF_BYTES_TARGET("sse2")
+        static std::size_t countByteWithSse2(const byte* data, std::size_t size, byte value) {
+            const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+            const __m128i zero = _mm_setzero_si128();
+
+            std::size_t result = 0;
+            std::size_t i = 0;
+            while (i + 16 <= size) {
+                const std::size_t blocks = std::min<std::size_t>((size - i) / 16, 255);
+                __m128i counters = zero;
+                for (std::size_t block = 0; block < blocks; block++, i += 16) {
+                    const __m128i chunk =
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                    counters = _mm_sub_epi8(counters, _mm_cmpeq_epi8(chunk, needle));
+                }
+
+                alignas(16) std::uint64_t sums[2];
+                _mm_store_si128(reinterpret_cast<__m128i*>(sums), _mm_sad_epu8(counters, zero));
+                result += static_cast<std::size_t>(sums[0] + sums[1]);
+            }
+            return result + countByteWithScalar(data + i, size - i, value);
+        }
+
+        MF_BYTES_TARGET("avx2")
+        static std::size_t countByteWithAvx2(const byte* data, std::size_t size, byte value) {
+            const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
+            const __m256i zero = _mm256_setzero_si256();
+
+            std::size_t result = 0;
+            std::size_t i = 0;
+            while (i + 32 <= size) {
+                const std::size_t blocks = std::min<std::size_t>((size - i) / 32, 255);
+                __m256i counters = zero;
+                for (std::size_t block = 0; block < blocks; block++, i += 32) {
+                    const __m256i chunk =
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                    counters = _mm256_sub_epi8(counters, _mm256_cmpeq_epi8(chunk, needle));
+                }
+
+                alignas(32) std::uint64_t sums[4];
+                _mm256_store_si256(
+                    reinterpret_cast<__m256i*>(sums), _mm256_sad_epu8(counters, zero));
+                result += static_cast<std::size_t>(sums[0] + sums[1] + sums[2] + sums[3]);
+            }
+            return result + countByteWithSse2(data + i, size - i, value);
+        }
+#endif
+
+        struct SearchKernels {
+            std::size_t (*findByte)(const byte* data, std::size_t size, byte value);
+            std::size_t (*findAnyByte)(const byte* data, std::size_t size, const ByteSet& values);
+            std::size_t (*findPattern)(
+                const byte* data, std::size_t size, const byte* pattern, std::size_t patternSize);
+            std::size_t (*countByte)(const byte* data, std::size_t size, byte value);
+        };
+
+        static SearchKernels selectSearchKernels() {
+            SearchKernels kernels = {
+                findByteWithScalar, findAnyByteWithScalar, findPatternWithScalar,
+                countByteWithScalar};
+#if MF_BYTES_SIMD
+            const CpuFeatures& features = getCpuFeatures();
+            if (features.avx2) {
+                kernels = {
+                    findByteWithAvx2, findAnyByteWithAvx2, findPatternWithAvx2, countByteWithAvx2};
+            } else if (features.sse2) {
+                kernels = {
+                    findByteWithSse2,
+                    features.ssse3 ? findAnyByteWithSsse3 : findAnyByteWithScalar,
+                    findPatternWithSse2, countByteWithSse2};
+            }
+#endif
+            return kernels;
+        }
+
+        static const SearchKernels& getSearchKernels() {
+            static const SearchKernels kernels = selectSearchKernels();
+            return kernels;
+        }
+
+        // ----- RAW MEMORY ----- //
+
+        std::size_t findByte(const void* data, std::size_t size, byte value) {
+            return getSearchKernels().findByte(static_cast<const byte*>(data), size, value);
+        }
+
+        std::size_t findAnyByte(const void* data, std::size_t size, const ByteSet& values) {
+            return getSearchKernels().findAnyByte(static_cast<const byte*>(data), size, values);
+        }
+
+        std::size_t findPattern(
+            const void* data, std::size_t size, const void* pattern, std::size_t patternSize) {
+            const byte* const bytes = static_cast<const byte*>(pattern);
+            if (patternSize == 0) {
+                return 0;
+            }
+            if (patternSize == 1) {
+                return findByte(data, size, bytes[0]);
+            }
+            return getSearchKernels().findPattern(
+                static_cast<const byte*>(data), size, bytes, patternSize);
+        }
+
+        std::size_t countByte(const void* data, std::size_t size, byte value) {
+            return getSearchKernels().countByte(static_cast<const byte*>(data), size, value);
+        }
+
+        // ----- BUFFER ----- //
+
+        std::size_t Buffer::find(byte value, std::size_t from) const {
+            const std::size_t size = getSize();
+            if (from >= size) {
+                return NOT_FOUND;
+            }
+            return addOffset(findByte(cbegin() + from, size - from, value), from);
+        }
+
+        std::size_t Buffer::findAny(const ByteSet& values, std::size_t from) const {
+            const std::size_t size = getSize();
+            if (from >= size) {
+                return NOT_FOUND;
+            }
+            return addOffset(findAnyByte(cbegin() + from, size - from, values), from);
+        }
+
+        std::size_t Buffer::find(const std::string& pattern, std::size_t from) const {
+            const std::size_t size = getSize();
+            if (from > size) {
+                return NOT_FOUND;
+            }
+            return addOffset(
+                findPattern(cbegin() + from, size - from, pattern.data(), pattern.size()), from);
+        }
+
+        std::size_t Buffer::count(byte value) const {
+            return countByte(cbegin(), getSize(), value);
+        }
+
+        // ----- BYTE SET ----- //
+
+        ByteSet::ByteSet(std::initializer_list<byte> values) {
+            for (const byte value : values) {
+                add(value);
+            }
+        }
+
+        ByteSet::ByteSet(const std::string& values) {
+            for (const char value : values) {
+                add(static_cast<byte>(value));
+            }
+        }
+
+        // ----- SEVERAL PATTERNS ----- //
+
+        PatternSet::PatternSet(std::vector<std::string> patterns) : patterns(std::move(patterns)) {
+            if (this->patterns.empty()) {
+                throw std::invalid_argument("A PatternSet needs at least one pattern.");
+            }
+            for (const auto& pattern : this->patterns) {
+                if (pattern.empty()) {
+                    throw std::invalid_argument("The patterns of a PatternSet cannot be empty.");
+                }
+                firstBytes.add(static_cast<byte>(pattern[0]));
+            }
+        }
+
+        PatternMatch PatternSet::find(const void* data, std::size_t size) const {
+            const byte* const bytes = static_cast<const byte*>(data);
+
+            for (std::size_t position = 0; position < size; position++) {
+                const std::size_t candidate =
+                    findAnyByte(bytes + position, size - position, firstBytes);
+                if (candidate == NOT_FOUND) {
+                    break;
+                }
+                position += candidate;
+
+                for (std::size_t i = 0; i < patterns.size(); i++) {
+                    const std::string& pattern = patterns[i];
+                    if (pattern.size() <= size - position &&
+                        std::memcmp(bytes + position, pattern.data(), pattern.size()) == 0) {
+                        PatternMatch match;
+                        match.position = position;
+                        match.patternIndex = i;
+                        return match;
+                    }
+                }
+            }
+            return PatternMatch();
+        }
+
+        PatternMatch PatternSet::find(const Buffer& buffer, std::size_t from) const {
+            const std::size_t size = buffer.getSize();
+            if (from >= size) {
+                return PatternMatch();
+            }
+            PatternMatch match = find(buffer.cbegin() + from, size - from);
+            match.position = addOffset(match.position, from);
+            return match;
+        }
+
+        std::vector<std::shared_ptr<Buffer>> split(
+            const std::shared_ptr<Buffer>& buffer, const PatternSet& delimiters) {
+            std::vector<std::shared_ptr<Buffer>> result;
+
+            std::size_t start = 0;
+            for (;;) {
+                const PatternMatch match = delimiters.find(*buffer, start);
+                if (match.position == NOT_FOUND) {
+                    break;
+                }
+                result.push_back(buffer->slice(start, match.position - start));
+                start = match.position + delimiters.getPatterns()[match.patternIndex].size();
+            }
+            result.push_back(buffer->slice(start, buffer->getSize() - start));
+            return result;
+        }
+    } // namespace Bytes
+} // namespace MF
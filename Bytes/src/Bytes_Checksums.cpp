@@ -0,0 +1,347 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <cstring>
+
+#include "BytesCpuHelper.hpp"
+#include "MF/Checksums.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        static inline std::uint32_t readLittleEndian32(const byte* input) {
+            return static_cast<std::uint32_t>(input[0]) |
+                   (static_cast<std::uint32_t>(input[1]) << 8) |
+                   (static_cast<std::uint32_t>(input[2]) << 16) |
+                   (static_cast<std::uint32_t>(input[3]) << 24);
+        }
+
+        static inline std::uint64_t readLittleEndian64(const byte* input) {
+            return static_cast<std::uint64_t>(readLittleEndian32(input)) |
+                   (static_cast<std::uint64_t>(readLittleEndian32(input + 4)) << 32);
+        }
+
+        // ----- SLICING-BY-8 ----- //
+
+        /// Tables of a reflected CRC-32, to process 8 bytes per step.
+        struct CrcTables {
+            std::uint32_t values[8][256];
+
+            explicit CrcTables(std::uint32_t reflectedPolynomial) : values() {
+                for (std::uint32_t i = 0; i < 256; i++) {
+                    std::uint32_t crc = i;
+                    for (int bit = 0; bit < 8; bit++) {
+                        crc = (crc >> 1) ^ ((crc & 1) ? reflectedPolynomial : 0);
+                    }
+                    values[0][i] = crc;
+                }
+                for (std::size_t slice = 1; slice < 8; slice++) {
+                    for (std::size_t i = 0; i < 256; i++) {
+                        const std::uint32_t previous = values[slice - 1][i];
+                        values[slice][i] = (previous >> 8) ^ values[0][previous & 0xFF];
+                    }
+                }
+            }
+        };
+
+        static std::uint32_t updateWithTables(
+            const CrcTables& tables, std::uint32_t crc, const byte* input, std::size_t size) {
+            const auto& t = tables.values;
+            for (; size >= 8; size -= 8, input += 8) {
+                const std::uint32_t low = readLittleEndian32(input) ^ crc;
+                const std::uint32_t high = readLittleEndian32(input + 4);
+                crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^
+                      t[4][low >> 24] ^ t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^
+                      t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+            }
+            for (; size > 0; size--, input++) {
+                crc = (crc >> 8) ^ t[0][(crc ^ *input) & 0xFF];
+            }
+            return crc;
+        }
+
+        static const CrcTables& getCrc32cTables() {
+            static const CrcTables tables(0x82F63B78U);
+            return tables;
+        }
+
+        static const CrcTables& getCrc32Tables() {
+            static const CrcTables tables(0xEDB88320U);
+            return tables;
+        }
+
+        // ----- SIMD ----- //
+
+        /// Updates a CRC register (not inverted) with "size" bytes.
+        using CrcUpdater_t =
+            std::uint32_t (*)(std::uint32_t crc, const byte* input, std::size_t size);
+
+        static std::uint32_t updateCrc32cWithTables(
+            std::uint32_t crc, const byte* input, std::size_t size) {
+            return updateWithTables(getCrc32cTables(), crc, input, size);
+        }
+
+        static std::uint32_t updateCrc32WithTables(
+            std::uint32_t crc, const byte* input, std::size_t size) {
+            return updateWithTables(getCrc32Tables(), crc, input, size);
+        }
+
+#if MF_BYTES_SIMD
+        MF_BYTES_TARGET("sse4.2")
+        static std::uint32_t updateCrc32cWithSse42(
+            std::uint32_t crc, const byte* input, std::size_t size) {
+#    if defined(__x86_64__) || defined(_M_X64)
+            std::uint64_t crc64 = crc;
+            for (; size >= 8; size -= 8, input += 8) {
+                std::uint64_t value;
+                std::memcpy(&value, input, sizeof(value));
+                crc64 = _mm_crc32_u64(crc64, value);
+            }
+            crc = static_cast<std::uint32_t>(crc64);
+#    endif
+            for (; size >= 4; size -= 4, input += 4) {
+                std::uint32_t value;
+                std::memcpy(&value, input, sizeof(value));
+                crc = _mm_crc32_u32(crc, value);
+            }
+            for (; size > 0; size--, input++) {
+                crc = _mm_crc32_u8(crc, *input);
+            }
+            return crc;
+        }
+
+        static inline __m128i loadBlock(const byte* address) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(address));
+        }
+
+        /// Multiplies "value" by the folding constants, and adds the "next" 128 bits.
+        MF_BYTES_TARGET("pclmul")
+        static inline __m128i fold(__m128i value, __m128i constants, __m128i next) {
+            const __m128i low = _mm_clmulepi64_si128(value, constants, 0x00);
+            const __m128i high = _mm_clmulepi64_si128(value, constants, 0x11);
+            return _mm_xor_si128(_mm_xor_si128(high, low), next);
+        }
+
+        /**
+         * Folds 64 bytes at a time with carry-less multiplications, then reduces to 32 bits
+         * with a Barrett reduction. See "Fast CRC Computation for Generic Polynomials Using
+         * PCLMULQDQ Instruction" (Intel). The constants are those of the reflected CRC-32.
+         * Requires at least 64 bytes, and processes a multiple of 16 bytes.
+         */
+        MF_BYTES_TARGET("pclmul,sse4.1")
+        static std::uint32_t foldCrc32WithPclmul(
+            std::uint32_t crc, const byte* input, std::size_t size) {
+            alignas(16) static const std::uint64_t k1k2[] = {0x0154442BD4ULL, 0x01C6E41596ULL};
+            alignas(16) static const std::uint64_t k3k4[] = {0x01751997D0ULL, 0x00CCAA009EULL};
+            alignas(16) static const std::uint64_t k5k0[] = {0x0163CD6124ULL, 0};
+            alignas(16) static const std::uint64_t poly[] = {0x01DB710641ULL, 0x01F7011641ULL};
+
+            __m128i x1 = _mm_xor_si128(loadBlock(input), _mm_cvtsi32_si128(static_cast<int>(crc)));
+            __m128i x2 = loadBlock(input + 16);
+            __m128i x3 = loadBlock(input + 32);
+            __m128i x4 = loadBlock(input + 48);
+            input += 64;
+            size -= 64;
+
+            __m128i constants = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+            for (; size >= 64; size -= 64, input += 64) {
+                x1 = fold(x1, constants, loadBlock(input));
+                x2 = fold(x2, constants, loadBlock(input + 16));
+                x3 = fold(x3, constants, loadBlock(input + 32));
+                x4 = fold(x4, constants, loadBlock(input + 48));
+            }
+
+            // 512 -> 128 bits.
+            constants = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+            x1 = fold(x1, constants, x2);
+            x1 = fold(x1, constants, x3);
+            x1 = fold(x1, constants, x4);
+            for (; size >= 16; size -= 16, input += 16) {
+                x1 = fold(x1, constants, loadBlock(input));
+            }
+
+            // 128 -> 64 bits.
+            const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+            x2 = _mm_clmulepi64_si128(x1, constants, 0x10);
+            x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+            constants = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+            x2 = _mm_srli_si128(x1, 4);
+            x1 = _mm_and_si128(x1, mask32);
+            x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, constants, 0x00), x2);
+
+            // Barrett reduction, 64 -> 32 bits.
+            constants = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+            x2 = _mm_and_si128(x1, mask32);
+            x2 = _mm_clmulepi64_si128(x2, constants, 0x10);
+            x2 = _mm_and_si128(x2, mask32);
+            x2 = _mm_clmulepi64_si128(x2, constants, 0x00);
+            x1 = _mm_xor_si128(x1, x2);
+            return static_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));
+        }
+
+        static std::uint32_t updateCrc32WithPclmul(
+            std::uint32_t crc, const byte* input, std::size_t size) {
+            if (size >= 64) {
+                const std::size_t foldedSize = size & ~static_cast<std::size_t>(15);
+                crc = foldCrc32WithPclmul(crc, input, foldedSize);
+                input += foldedSize;
+                size -= foldedSize;
+            }
+            return updateCrc32WithTables(crc, input, size);
+        }
+#endif
+
+        static CrcUpdater_t selectCrc32cUpdater() {
+#if MF_BYTES_SIMD
+            if (getCpuFeatures().sse42) {
+                return updateCrc32cWithSse42;
+            }
+#endif
+            return updateCrc32cWithTables;
+        }
+
+        static CrcUpdater_t selectCrc32Updater() {
+#if MF_BYTES_SIMD
+            if (getCpuFeatures().pclmul && getCpuFeatures().sse41) {
+                return updateCrc32WithPclmul;
+            }
+#endif
+            return updateCrc32WithTables;
+        }
+
+        // ----- CRC ----- //
+
+        void Crc32c::update(const void* data, std::size_t size) {
+            static const CrcUpdater_t updater = selectCrc32cUpdater();
+            state = updater(state, static_cast<const byte*>(data), size);
+        }
+
+        void Crc32::update(const void* data, std::size_t size) {
+            static const CrcUpdater_t updater = selectCrc32Updater();
+            state = updater(state, static_cast<const byte*>(data), size);
+        }
+
+        // ----- HASH64 ----- //
+
+        static constexpr std::uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+        static constexpr std::uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+        static constexpr std::uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+        static constexpr std::uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+        static constexpr std::uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+        static inline std::uint64_t rotateLeft(std::uint64_t value, int bits) {
+            return (value << bits) | (value >> (64 - bits));
+        }
+
+        static inline std::uint64_t hashRound(std::uint64_t accumulator, std::uint64_t input) {
+            accumulator += input * PRIME64_2;
+            return rotateLeft(accumulator, 31) * PRIME64_1;
+        }
+
+        static inline std::uint64_t mergeRound(std::uint64_t hash, std::uint64_t accumulator) {
+            hash ^= hashRound(0, accumulator);
+            return hash * PRIME64_1 + PRIME64_4;
+        }
+
+        /// Processes whole stripes of 32 bytes and returns the number of bytes processed.
+        static std::size_t hashStripes(
+            std::uint64_t (&accumulators)[4], const byte* input, std::size_t size) {
+            std::uint64_t v1 = accumulators[0], v2 = accumulators[1];
+            std::uint64_t v3 = accumulators[2], v4 = accumulators[3];
+
+            std::size_t done = 0;
+            for (; done + 32 <= size; done += 32) {
+                v1 = hashRound(v1, readLittleEndian64(input + done));
+                v2 = hashRound(v2, readLittleEndian64(input + done + 8));
+                v3 = hashRound(v3, readLittleEndian64(input + done + 16));
+                v4 = hashRound(v4, readLittleEndian64(input + done + 24));
+            }
+
+            accumulators[0] = v1;
+            accumulators[1] = v2;
+            accumulators[2] = v3;
+            accumulators[3] = v4;
+            return done;
+        }
+
+        Hash64::Hash64(std::uint64_t seed) : seed(seed) {
+            reset();
+        }
+
+        void Hash64::reset() {
+            accumulators[0] = seed + PRIME64_1 + PRIME64_2;
+            accumulators[1] = seed + PRIME64_2;
+            accumulators[2] = seed;
+            accumulators[3] = seed - PRIME64_1;
+            totalSize = 0;
+            pendingSize = 0;
+        }
+
+        void Hash64::update(const void* data, std::size_t size) {
+            // "data" may be nullptr, which std::memcpy does not accept.
+            if (size == 0) {
+                return;
+            }
+            const byte* input = static_cast<const byte*>(data);
+            totalSize += size;
+
+            if (pendingSize + size < sizeof(pending)) {
+                std::memcpy(pending + pendingSize, input, size);
+                pendingSize += size;
+                return;
+            }
+
+            if (pendingSize > 0) {
+                const std::size_t missing = sizeof(pending) - pendingSize;
+                std::memcpy(pending + pendingSize, input, missing);
+                hashStripes(accumulators, pending, sizeof(pending));
+                input += missing;
+                size -= missing;
+            }
+
+            const std::size_t done = hashStripes(accumulators, input, size);
+            pendingSize = size - done;
+            std::memcpy(pending, input + done, pendingSize);
+        }
+
+        std::uint64_t Hash64::finalize() const {
+            std::uint64_t hash;
+            if (totalSize >= sizeof(pending)) {
+                hash = rotateLeft(accumulators[0], 1) + rotateLeft(accumulators[1], 7) +
+                       rotateLeft(accumulators[2], 12) + rotateLeft(accumulators[3], 18);
+                for (const std::uint64_t accumulator : accumulators) {
+                    hash = mergeRound(hash, accumulator);
+                }
+            } else {
+                hash = seed + PRIME64_5;
+            }
+            hash += totalSize;
+
+            const byte* input = pending;
+            std::size_t size = pendingSize;
+            for (; size >= 8; size -= 8, input += 8) {
+                hash ^= hashRound(0, readLittleEndian64(input));
+                hash = rotateLeft(hash, 27) * PRIME64_1 + PRIME64_4;
+            }
+            if (size >= 4) {
+                hash ^= static_cast<std::uint64_t>(readLittleEndian32(input)) * PRIME64_1;
+                hash = rotateLeft(hash, 23) * PRIME64_2 + PRIME64_3;
+                size -= 4;
+                input += 4;
+            }
+            for (; size > 0; size--, input++) {
+                hash ^= *input * PRIME64_5;
+                hash = rotateLeft(hash, 11) * PRIME64_1;
+            }
+
+            hash ^= hash >> 33;
+            hash *= PRIME64_2;
+            hash ^= hash >> 29;
+            hash *= PRIME64_3;
+            hash ^= hash >> 32;
+            return hash;
+        }
+    } // namespace Bytes
+} // namespace MF
@@ -0,0 +1,557 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "MF/BufferPool.hpp"
+#include "MF/Compression.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        // ----- BLOCKS ----- //
+
+        /// Shortest match worth encoding.
+        static constexpr std::size_t MIN_MATCH = 4;
+        /// The format requires the last bytes of a block to be literals...
+        static constexpr std::size_t LAST_LITERALS = 5;
+        /// ... and the last match to start this far from the end.
+        static constexpr std::size_t MATCH_FIND_LIMIT = 12;
+        static constexpr std::size_t MAX_OFFSET = 65535;
+        /// Positions table of 16 KiB, which stays in L1.
+        static constexpr unsigned int HASH_LOG = 12;
+        /// Without a match, the search step grows every 2^SKIP_STRENGTH bytes.
+        static constexpr unsigned int SKIP_STRENGTH = 6;
+
+        static inline std::uint32_t read32(const byte* input) {
+            std::uint32_t result;
+            std::memcpy(&result, input, sizeof(result));
+            return result;
+        }
+
+        static inline std::uint32_t hashPosition(const byte* input) {
+            return (read32(input) * 2654435761U) >> (32 - HASH_LOG);
+        }
+
+        /// Number of equal bytes at "input" and "match", without reading beyond "limit".
+        static inline std::size_t countEqualBytes(
+            const byte* input, const byte* match, const byte* limit) {
+            const byte* const start = input;
+            while (input + sizeof(std::uint64_t) <= limit) {
+                std::uint64_t inputValue;
+                std::uint64_t matchValue;
+                std::memcpy(&inputValue, input, sizeof(inputValue));
+                std::memcpy(&matchValue, match, sizeof(matchValue));
+                if (inputValue != matchValue) {
+                    break;
+                }
+                input += sizeof(std::uint64_t);
+                match += sizeof(std::uint64_t);
+            }
+            while (input < limit && *input == *match) {
+                input++;
+                match++;
+            }
+            return static_cast<std::size_t>(input - start);
+        }
+
+        /// Writes a length which did not fit in the 4 bits of the token.
+        static inline byte* writeExtendedLength(byte* output, std::size_t length) {
+            for (; length >= 255; length -= 255) {
+                *output++ = 255;
+            }
+            *output++ = static_cast<byte>(length);
+            return output;
+        }
+
+        static inline byte* writeLiterals(
+            byte* output, byte* token, const byte* literals, std::size_t size) {
+            if (size >= 15) {
+                *token = 15 << 4;
+                output = writeExtendedLength(output, size - 15);
+            } else {
+                *token = static_cast<byte>(size << 4);
+            }
+            if (size != 0) {
+                std::memcpy(output, literals, size);
+            }
+            return output + size;
+        }
+
+        std::size_t getCompressedBlockBound(std::size_t inputSize) {
+            return inputSize + inputSize / 255 + 16;
+        }
+
+        std::size_t compressBlock(
+            const void* input, std::size_t inputSize, void* output, std::size_t outputCapacity) {
+            if (outputCapacity < getCompressedBlockBound(inputSize)) {
+                throw std::invalid_argument(
+                    "The output capacity (" + std::to_string(outputCapacity) +
+                    ") is smaller than the bound of the compressed block (" +
+                    std::to_string(getCompressedBlockBound(inputSize)) + ").");
+            }
+            const byte* const source = static_cast<const byte*>(input);
+            byte* destination = static_cast<byte*>(output);
+            const byte* anchor = source;
+
+            if (inputSize > MATCH_FIND_LIMIT) {
+                // Last position of the input where a match may start, and where it must end.
+                const byte* const matchStartLimit = source + inputSize - MATCH_FIND_LIMIT;
+                const byte* const matchEndLimit = source + inputSize - LAST_LITERALS;
+
+                // 32 bits positions, relative to "source". Beyond 4 GiB they wrap, which only
+                // costs missed matches, since the candidates are always checked.
+                std::uint32_t positions[1 << HASH_LOG] = {};
+                const byte* current = source + 1;
+                for (;;) {
+                    // Looks for a match, with a growing step in incompressible areas.
+                    const byte* match = nullptr;
+                    const byte* next = current;
+                    std::size_t attempts = std::size_t(1) << SKIP_STRENGTH;
+                    do {
+                        current = next;
+                        next += attempts++ >> SKIP_STRENGTH;
+                        if (next > matchStartLimit) {
+                            goto lastLiterals;
+                        }
+                        const std::uint32_t hash = hashPosition(current);
+                        match = source + positions[hash];
+                        positions[hash] = static_cast<std::uint32_t>(current - source);
+                    } while (static_cast<std::size_t>(current - match) > MAX_OFFSET ||
+                             read32(match) != read32(current));
+
+                    // Extends the match backwards, on the pending literals.
+                    while (current > anchor && match > source && current[-1] == match[-1]) {
+                        current--;
+                        match--;
+                    }
+
+                    const std::size_t matchLength =
+                        MIN_MATCH +
+                        countEqualBytes(current + MIN_MATCH, match + MIN_MATCH, matchEndLimit);
+                    byte* const token = destination++;
+                    destination = writeLiterals(
+                        destination, token, anchor, static_cast<std::size_t>(current - anchor));
+
+                    const auto offset = static_cast<std::size_t>(current - match);
+                    *destination++ = static_cast<byte>(offset);
+                    *destination++ = static_cast<byte>(offset >> 8);
+                    if (matchLength - MIN_MATCH >= 15) {
+                        *token |= 15;
+                        destination =
+                            writeExtendedLength(destination, matchLength - MIN_MATCH - 15);
+                    } else {
+                        *token |= static_cast<byte>(matchLength - MIN_MATCH);
+                    }
+
+                    current += matchLength;
+                    anchor = current;
+                    if (current > matchStartLimit) {
+                        break;
+                    }
+                    // The end of the match helps to find the next one.
+                    positions[hashPosition(current - 2)] =
+                        static_cast<std::uint32_t>(current - 2 - source);
+                }
+            }
+
+        lastLiterals:
+            byte* const token = destination++;
+            destination = writeLiterals(
+                destination, token, anchor, static_cast<std::size_t>(source + inputSize - anchor));
+            return static_cast<std::size_t>(destination - static_cast<byte*>(output));
+        }
+
+        [[noreturn]] static void throwForCorruptedBlock(const byte* position, const byte* start) {
+            throw std::invalid_argument(
+                "Corrupted compressed block at index " + std::to_string(position - start) + ".");
+        }
+
+        static inline std::size_t readExtendedLength(
+            const byte*& input, const byte* inputEnd, const byte* inputStart) {
+            std::size_t result = 0;
+            byte value;
+            do {
+                if (input >= inputEnd) {
+                    throwForCorruptedBlock(input, inputStart);
+                }
+                value = *input++;
+                result += value;
+            } while (value == 255);
+            return result;
+        }
+
+        std::size_t decompressBlock(
+            const void* input, std::size_t inputSize, void* output, std::size_t outputCapacity) {
+            const byte* const inputStart = static_cast<const byte*>(input);
+            const byte* const inputEnd = inputStart + inputSize;
+            byte* const outputStart = static_cast<byte*>(output);
+            byte* const outputEnd = outputStart + outputCapacity;
+            const byte* source = inputStart;
+            byte* destination = outputStart;
+
+            for (;;) {
+                if (source >= inputEnd) {
+                    throwForCorruptedBlock(source, inputStart);
+                }
+                const byte token = *source++;
+
+                // Literals: one 32 bytes copy for the short ones, when there is room for it.
+                std::size_t literalsSize = token >> 4;
+                if (literalsSize == 15) {
+                    literalsSize += readExtendedLength(source, inputEnd, inputStart);
+                }
+                const auto inputLeft = static_cast<std::size_t>(inputEnd - source);
+                const auto outputLeft = static_cast<std::size_t>(outputEnd - destination);
+                if (literalsSize > inputLeft || literalsSize > outputLeft) {
+                    throwForCorruptedBlock(source, inputStart);
+                }
+                if (literalsSize <= 32 && inputLeft >= 32 && outputLeft >= 32) {
+                    std::memcpy(destination, source, 32);
+                } else if (literalsSize != 0) {
+                    std::memcpy(destination, source, literalsSize);
+                }
+                source += literalsSize;
+                destination += literalsSize;
+                if (source == inputEnd) {
+                    // A block always ends with literals.
+                    break;
+                }
+
+                // Match.
+                if (inputEnd - source < 2) {
+                    throwForCorruptedBlock(source, inputStart);
+                }
+                const std::size_t offset = static_cast<std::size_t>(source[0]) |
+                                           (static_cast<std::size_t>(source[1]) << 8);
+                if (offset == 0 || offset > static_cast<std::size_t>(destination - outputStart)) {
+                    throwForCorruptedBlock(source, inputStart);
+                }
+                source += 2;
+                std::size_t matchLength = token & 15;
+                if (matchLength == 15) {
+                    matchLength += readExtendedLength(source, inputEnd, inputStart);
+                }
+                matchLength += MIN_MATCH;
+                const auto room = static_cast<std::size_t>(outputEnd - destination);
+                if (matchLength > room) {
+                    throwForCorruptedBlock(source, inputStart);
+                }
+
+                const byte* match = destination - offset;
+                byte* const matchEnd = destination + matchLength;
+                if (offset >= 16 && room >= matchLength + 16) {
+                    // Copies by 16 bytes, maybe beyond "matchEnd" (overwritten later).
+                    do {
+                        std::memcpy(destination, match, 16);
+                        destination += 16;
+                        match += 16;
+                    } while (destination < matchEnd);
+                } else if (room >= matchLength + 8) {
+                    // Same by 8 bytes.
+                    if (offset < 8) {
+                        // The first 8 bytes one by one, since they overlap. Then the bytes repeat
+                        // with any multiple of "offset" as period: the smallest one >= 8 allows
+                        // copies by 8 bytes.
+                        for (int i = 0; i < 8; i++) {
+                            destination[i] = match[i];
+                        }
+                        destination += 8;
+                        match = destination - (8 + offset - 1) / offset * offset;
+                    }
+                    while (destination < matchEnd) {
+                        std::memcpy(destination, match, 8);
+                        destination += 8;
+                        match += 8;
+                    }
+                } else {
+                    while (destination < matchEnd) {
+                        *destination++ = *match++;
+                    }
+                }
+                destination = matchEnd;
+            }
+            return static_cast<std::size_t>(destination - outputStart);
+        }
+
+        // ----- FRAMES ----- //
+
+        static constexpr byte FRAME_MAGIC[4] = {'M', 'F', 'L', 'Z'};
+        static constexpr std::size_t FRAME_HEADER_SIZE = 6;
+        static constexpr byte FLAG_CONTENT_SIZE = 0x01;
+        /// In the header of a block: its bytes are stored as is.
+        static constexpr std::uint32_t UNCOMPRESSED_BLOCK_BIT = 0x80000000U;
+
+        static inline void writeLittleEndian32(byte* output, std::uint32_t value) {
+            for (int i = 0; i < 4; i++) {
+                output[i] = static_cast<byte>(value >> (8 * i));
+            }
+        }
+
+        static inline std::uint32_t readLittleEndian32(const byte* input) {
+            return static_cast<std::uint32_t>(input[0]) |
+                   (static_cast<std::uint32_t>(input[1]) << 8) |
+                   (static_cast<std::uint32_t>(input[2]) << 16) |
+                   (static_cast<std::uint32_t>(input[3]) << 24);
+        }
+
+        static unsigned int getBlockSizeLog(std::size_t blockSize) {
+            unsigned int result = 0;
+            while ((std::size_t(1) << result) < blockSize) {
+                result++;
+            }
+            if ((std::size_t(1) << result) != blockSize || blockSize < MIN_COMPRESSION_BLOCK_SIZE ||
+                blockSize > MAX_COMPRESSION_BLOCK_SIZE) {
+                throw std::invalid_argument(
+                    "The block size must be a power of 2 in [" +
+                    std::to_string(MIN_COMPRESSION_BLOCK_SIZE) + ", " +
+                    std::to_string(MAX_COMPRESSION_BLOCK_SIZE) + "], got " +
+                    std::to_string(blockSize) + ".");
+            }
+            return result;
+        }
+
+        FrameCompressor::FrameCompressor(std::size_t blockSize, std::size_t contentSize)
+            : blockSize(blockSize), expectedContentSize(contentSize) {
+            const unsigned int blockSizeLog = getBlockSizeLog(blockSize);
+            pendingBlock.reserve(blockSize);
+            compressedBlock.resize(getCompressedBlockBound(blockSize));
+
+            const bool hasContentSize = contentSize != UNKNOWN_CONTENT_SIZE;
+            auto header = BufferPool::makeBuffer(FRAME_HEADER_SIZE + (hasContentSize ? 8 : 0));
+            byte* const bytes = header->getWithCast<byte>();
+            std::memcpy(bytes, FRAME_MAGIC, sizeof(FRAME_MAGIC));
+            bytes[4] = hasContentSize ? FLAG_CONTENT_SIZE : 0;
+            bytes[5] = static_cast<byte>(blockSizeLog);
+            if (hasContentSize) {
+                const auto size = static_cast<std::uint64_t>(contentSize);
+                writeLittleEndian32(bytes + 6, static_cast<std::uint32_t>(size));
+                writeLittleEndian32(bytes + 10, static_cast<std::uint32_t>(size >> 32));
+            }
+            output.append(std::move(header));
+        }
+
+        void FrameCompressor::update(const void* data, std::size_t size) {
+            if (finished) {
+                throw std::logic_error("The frame is already finished.");
+            }
+            const byte* input = static_cast<const byte*>(data);
+            contentSize += size;
+            checksum.update(input, size);
+
+            if (!pendingBlock.empty()) {
+                const std::size_t taken = std::min(blockSize - pendingBlock.size(), size);
+                pendingBlock.insert(pendingBlock.end(), input, input + taken);
+                input += taken;
+                size -= taken;
+                if (pendingBlock.size() < blockSize) {
+                    return;
+                }
+                compressBlockToOutput(pendingBlock.data(), blockSize);
+                pendingBlock.clear();
+            }
+            // Whole blocks are compressed without copy.
+            for (; size >= blockSize; input += blockSize, size -= blockSize) {
+                compressBlockToOutput(input, blockSize);
+            }
+            pendingBlock.insert(pendingBlock.end(), input, input + size);
+        }
+
+        void FrameCompressor::finish() {
+            if (finished) {
+                throw std::logic_error("The frame is already finished.");
+            }
+            if (expectedContentSize != UNKNOWN_CONTENT_SIZE && contentSize != expectedContentSize) {
+                throw std::logic_error(
+                    "The content size (" + std::to_string(contentSize) +
+                    ") does not match the expected one (" + std::to_string(expectedContentSize) +
+                    ").");
+            }
+            if (!pendingBlock.empty()) {
+                compressBlockToOutput(pendingBlock.data(), pendingBlock.size());
+                pendingBlock.clear();
+            }
+
+            // The end mark (an empty block header), then the checksum.
+            auto trailer = BufferPool::makeBuffer(8);
+            writeLittleEndian32(trailer->getWithCast<byte>(), 0);
+            writeLittleEndian32(trailer->getWithCast<byte>() + 4, checksum.finalize());
+            output.append(std::move(trailer));
+            finished = true;
+        }
+
+        void FrameCompressor::compressBlockToOutput(const byte* data, std::size_t size) {
+            const std::size_t compressedSize =
+                compressBlock(data, size, compressedBlock.data(), compressedBlock.size());
+            const bool isCompressed = compressedSize < size;
+            const std::size_t storedSize = isCompressed ? compressedSize : size;
+
+            auto block = BufferPool::makeBuffer(4 + storedSize);
+            byte* const bytes = block->getWithCast<byte>();
+            const std::uint32_t flags = isCompressed ? 0 : UNCOMPRESSED_BLOCK_BIT;
+            writeLittleEndian32(bytes, static_cast<std::uint32_t>(storedSize) | flags);
+            std::memcpy(bytes + 4, isCompressed ? compressedBlock.data() : data, storedSize);
+            output.append(std::move(block));
+        }
+
+        [[noreturn]] static void throwForCorruptedFrame(
+            std::size_t index, const std::string& reason) {
+            throw std::invalid_argument(
+                "Corrupted compressed frame at index " + std::to_string(index) + ": " + reason);
+        }
+
+        void FrameDecompressor::update(const void* data, std::size_t size) {
+            const byte* input = static_cast<const byte*>(data);
+            while (size > 0) {
+                if (state == State::FINISHED) {
+                    throwForCorruptedFrame(frameIndex, "unexpected bytes after the end.");
+                }
+                const std::size_t partSize = neededSize;
+                if (pending.empty() && size >= partSize) {
+                    // The whole part is available: no copy.
+                    process(input);
+                    input += partSize;
+                    size -= partSize;
+                } else {
+                    const std::size_t taken = std::min(partSize - pending.size(), size);
+                    pending.insert(pending.end(), input, input + taken);
+                    input += taken;
+                    size -= taken;
+                    if (pending.size() < partSize) {
+                        return;
+                    }
+                    process(pending.data());
+                    pending.clear();
+                }
+                frameIndex += partSize;
+            }
+        }
+
+        void FrameDecompressor::process(const byte* data) {
+            switch (state) {
+                case State::HEADER: {
+                    if (std::memcmp(data, FRAME_MAGIC, sizeof(FRAME_MAGIC)) != 0) {
+                        throwForCorruptedFrame(frameIndex, "bad magic number.");
+                    }
+                    if ((data[4] & ~FLAG_CONTENT_SIZE) != 0) {
+                        throwForCorruptedFrame(frameIndex + 4, "unknown flags.");
+                    }
+                    const std::size_t blockSizeLog = data[5];
+                    if (blockSizeLog > 63) {
+                        throwForCorruptedFrame(frameIndex + 5, "bad block size.");
+                    }
+                    blockSize = std::size_t(1) << blockSizeLog;
+                    if (blockSize < MIN_COMPRESSION_BLOCK_SIZE ||
+                        blockSize > MAX_COMPRESSION_BLOCK_SIZE) {
+                        throwForCorruptedFrame(frameIndex + 5, "bad block size.");
+                    }
+                    const bool hasContentSize = (data[4] & FLAG_CONTENT_SIZE) != 0;
+                    state = hasContentSize ? State::CONTENT_SIZE : State::BLOCK_HEADER;
+                    neededSize = hasContentSize ? 8 : 4;
+                    break;
+                }
+                case State::CONTENT_SIZE: {
+                    const std::uint64_t size =
+                        readLittleEndian32(data) |
+                        (static_cast<std::uint64_t>(readLittleEndian32(data + 4)) << 32);
+                    if (size >= static_cast<std::uint64_t>(UNKNOWN_CONTENT_SIZE)) {
+                        throwForCorruptedFrame(frameIndex, "content size too big.");
+                    }
+                    expectedContentSize = static_cast<std::size_t>(size);
+                    state = State::BLOCK_HEADER;
+                    neededSize = 4;
+                    break;
+                }
+                case State::BLOCK_HEADER: {
+                    const std::uint32_t header = readLittleEndian32(data);
+                    if (header == 0) {
+                        state = State::CHECKSUM;
+                        neededSize = 4;
+                        break;
+                    }
+                    isBlockCompressed = (header & UNCOMPRESSED_BLOCK_BIT) == 0;
+                    neededSize = header & ~UNCOMPRESSED_BLOCK_BIT;
+                    if (neededSize == 0 || neededSize > getCompressedBlockBound(blockSize)) {
+                        throwForCorruptedFrame(frameIndex, "bad block size.");
+                    }
+                    state = State::BLOCK;
+                    break;
+                }
+                case State::BLOCK: {
+                    std::shared_ptr<Buffer> block;
+                    if (isBlockCompressed) {
+                        // When the content size is known, the last block gets a smaller buffer.
+                        const std::size_t capacity =
+                            std::min(blockSize, expectedContentSize - contentSize);
+                        block = BufferPool::makeBuffer(capacity);
+                        std::size_t size = 0;
+                        try {
+                            size = decompressBlock(data, neededSize, block->get(), capacity);
+                        } catch (const std::invalid_argument& exception) {
+                            throwForCorruptedFrame(frameIndex, exception.what());
+                        }
+                        if (size < capacity) {
+                            block = block->slice(0, size);
+                        }
+                    } else {
+                        if (neededSize > blockSize) {
+                            throwForCorruptedFrame(frameIndex, "bad block size.");
+                        }
+                        block = BufferPool::makeBuffer(neededSize);
+                        std::memcpy(block->get(), data, neededSize);
+                    }
+
+                    contentSize += block->getSize();
+                    if (contentSize > expectedContentSize) {
+                        throwForCorruptedFrame(frameIndex, "more content than announced.");
+                    }
+                    checksum.update(*block);
+                    output.append(std::move(block));
+                    state = State::BLOCK_HEADER;
+                    neededSize = 4;
+                    break;
+                }
+                case State::CHECKSUM: {
+                    if (readLittleEndian32(data) != checksum.finalize()) {
+                        throwForCorruptedFrame(frameIndex, "the checksum does not match.");
+                    }
+                    if (expectedContentSize != UNKNOWN_CONTENT_SIZE &&
+                        contentSize != expectedContentSize) {
+                        throwForCorruptedFrame(frameIndex, "less content than announced.");
+                    }
+                    state = State::FINISHED;
+                    neededSize = 0;
+                    break;
+                }
+                case State::FINISHED:
+                    break;
+            }
+        }
+
+        void FrameDecompressor::finish() const {
+            if (state != State::FINISHED) {
+                throw std::invalid_argument("The compressed frame is not complete.");
+            }
+        }
+
+        std::shared_ptr<Buffer> compress(const Buffer& input, std::size_t blockSize) {
+            FrameCompressor compressor(blockSize, input.getSize());
+            compressor.update(input);
+            compressor.finish();
+            return compressor.getOutput().flatten();
+        }
+
+        std::shared_ptr<Buffer> decompress(const Buffer& input) {
+            FrameDecompressor decompressor;
+            decompressor.update(input);
+            decompressor.finish();
+            return decompressor.getOutput().flatten();
+        }
+    } // namespace Bytes
+} // namespace MF
@@ -0,0 +1,48 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+#include "MF/BufferPool.hpp"
+#include "MF/CowBuffer.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        static std::atomic<std::size_t> copiesCount(0);
+
+        CowBuffer::CowBuffer(std::shared_ptr<Buffer> buffer) : storage(std::move(buffer)) {
+            if (storage == nullptr) {
+                throw std::invalid_argument("The buffer is equal to nullptr.");
+            }
+        }
+
+        void CowBuffer::makeUnique() {
+            // Only the bytes allocated by the buffer itself are written in place: the other kinds
+            // (slices, mapped files...) share them with owners which this count does not see,
+            // or are read-only. They are copied once, into a pool buffer.
+            // With a count of 1, a new owner can only be made from this handle (a copy,
+            // "getShared" or a slice), so 1 cannot become more meanwhile. More can become 1
+            // meanwhile, which only costs a useless copy.
+            if (storage.use_count() == 1 && storage->ownsWritableBytes()) {
+                // Synchronizes with the release of the last other owner, which may have read the
+                // bytes just before.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return;
+            }
+            const std::size_t size = getSize();
+            auto copy = BufferPool::makeBuffer(size);
+            std::memcpy(copy->get(), storage->get(), size);
+            storage = std::move(copy);
+            copiesCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::size_t CowBuffer::getCopiesCount() {
+            return copiesCount.load(std::memory_order_relaxed);
+        }
+    } // namespace Bytes
+} // namespace MF
@@ -0,0 +1,544 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "BytesCpuHelper.hpp"
+#include "MF/BufferPool.hpp"
+#include "MF/IntegerCodecs.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        template <typename UInt>
+        static inline UInt toLittleEndian(UInt value) {
+            return MF_BIG_ENDIAN ? detail::swapBytesInline(value) : value;
+        }
+
+        template <typename UInt>
+        static inline UInt loadLittleEndian(const byte* input) {
+            UInt value;
+            std::memcpy(&value, input, sizeof(value));
+            return toLittleEndian(value);
+        }
+
+        template <typename UInt>
+        static inline void storeLittleEndian(byte* output, UInt value) {
+            value = toLittleEndian(value);
+            std::memcpy(output, &value, sizeof(value));
+        }
+
+        /// Like "loadLittleEndian", but only reads the "available" bytes, the others are 0.
+        static inline std::uint64_t loadLittleEndian64Padded(
+            const byte* input, std::size_t available) {
+            if (available >= 8) {
+                return loadLittleEndian<std::uint64_t>(input);
+            }
+            byte bytes[8] = {};
+            std::memcpy(bytes, input, available);
+            return loadLittleEndian<std::uint64_t>(bytes);
+        }
+
+        static std::size_t getValuesCount(const Buffer& values) {
+            if (values.getSize() % sizeof(std::uint32_t) != 0) {
+                throw std::invalid_argument(
+                    "The size of a buffer of integers must be a multiple of 4, got " +
+                    std::to_string(values.getSize()) + ".");
+            }
+            return values.getSize() / sizeof(std::uint32_t);
+        }
+
+        [[noreturn]] static void throwForShortInput(std::size_t inputSize, std::size_t count) {
+            throw std::invalid_argument(
+                "The input (" + std::to_string(inputSize) + " bytes) is too short for " +
+                std::to_string(count) + " values.");
+        }
+
+        // ----- BIT PACKING ----- //
+
+        template <typename UInt>
+        static unsigned int getRequiredBitWidthOf(const UInt* values, std::size_t count) {
+            UInt all = 0;
+            for (std::size_t i = 0; i < count; i++) {
+                all |= values[i];
+            }
+            unsigned int result = 0;
+            for (; all != 0; all >>= 1) {
+                result++;
+            }
+            return result;
+        }
+
+        unsigned int getRequiredBitWidth(const std::uint32_t* values, std::size_t count) {
+            return getRequiredBitWidthOf(values, count);
+        }
+
+        unsigned int getRequiredBitWidth(const std::uint64_t* values, std::size_t count) {
+            return getRequiredBitWidthOf(values, count);
+        }
+
+        template <typename UInt>
+        static void checkBitWidth(const UInt* values, std::size_t count, unsigned int bitWidth) {
+            const unsigned int maxBitWidth = 8 * sizeof(UInt);
+            if (bitWidth > maxBitWidth) {
+                throw std::invalid_argument(
+                    "The bit width must be <= " + std::to_string(maxBitWidth) + ", got " +
+                    std::to_string(bitWidth) + ".");
+            }
+            if (values != nullptr && bitWidth < maxBitWidth &&
+                getRequiredBitWidthOf(values, count) > bitWidth) {
+                throw std::invalid_argument(
+                    "A value does not fit in " + std::to_string(bitWidth) + " bits.");
+            }
+        }
+
+        std::size_t bitPack(
+            const std::uint32_t* values, std::size_t count, unsigned int bitWidth, void* output) {
+            checkBitWidth(values, count, bitWidth);
+            byte* destination = static_cast<byte*>(output);
+
+            // Less than 32 bits are pending, so adding a value never overflows.
+            std::uint64_t pending = 0;
+            unsigned int pendingBits = 0;
+            for (std::size_t i = 0; i < count; i++) {
+                pending |= static_cast<std::uint64_t>(values[i]) << pendingBits;
+                pendingBits += bitWidth;
+                if (pendingBits >= 32) {
+                    storeLittleEndian(destination, static_cast<std::uint32_t>(pending));
+                    destination += 4;
+                    pending >>= 32;
+                    pendingBits -= 32;
+                }
+            }
+            for (; pendingBits > 0; pendingBits -= std::min(pendingBits, 8U), pending >>= 8) {
+                *destination++ = static_cast<byte>(pending);
+            }
+            return getBitPackedSize(count, bitWidth);
+        }
+
+        std::size_t bitPack(
+            const std::uint64_t* values, std::size_t count, unsigned int bitWidth, void* output) {
+            checkBitWidth(values, count, bitWidth);
+            byte* destination = static_cast<byte*>(output);
+
+            // A value may be split between the pending word and the next one.
+            std::uint64_t pending = 0;
+            unsigned int pendingBits = 0;
+            for (std::size_t i = 0; i < count; i++) {
+                const std::uint64_t value = values[i];
+                pending |= value << pendingBits;
+                pendingBits += bitWidth;
+                if (pendingBits >= 64) {
+                    storeLittleEndian(destination, pending);
+                    destination += 8;
+                    pendingBits -= 64;
+                    pending = (pendingBits == 0) ? 0 : value >> (bitWidth - pendingBits);
+                }
+            }
+            for (; pendingBits > 0; pendingBits -= std::min(pendingBits, 8U), pending >>= 8) {
+                *destination++ = static_cast<byte>(pending);
+            }
+            return getBitPackedSize(count, bitWidth);
+        }
+
+        static std::size_t bitUnpackWithScalar(
+            const byte* input,
+            std::size_t inputSize,
+            std::size_t first,
+            std::size_t count,
+            unsigned int bitWidth,
+            std::uint32_t* output) {
+            const std::uint64_t mask = (std::uint64_t(1) << bitWidth) - 1;
+            for (std::size_t i = first; i < count; i++) {
+                const std::size_t bitIndex = i * bitWidth;
+                const std::size_t byteIndex = bitIndex / 8;
+                const std::uint64_t word =
+                    loadLittleEndian64Padded(input + byteIndex, inputSize - byteIndex);
+                output[i] = static_cast<std::uint32_t>((word >> (bitIndex % 8)) & mask);
+            }
+            return getBitPackedSize(count, bitWidth);
+        }
+
+#if MF_BYTES_SIMD
+        /// Widest unpacking with 4 bytes per value: 7 bits of offset + 25 bits.
+        static constexpr unsigned int MAX_AVX2_BIT_WIDTH = 25;
+
+        /**
+         * For each bit width, how to unpack 8 values (which take "bitWidth" bytes) from 2 loads
+         * of 16 bytes, at 0 and at (bitWidth / 2) bytes. Value j gets 4 bytes with a shuffle,
+         * then is shifted right.
+         */
+        struct BitUnpackTables {
+            alignas(32) byte shuffles[MAX_AVX2_BIT_WIDTH + 1][32];
+            alignas(32) std::uint32_t shifts[MAX_AVX2_BIT_WIDTH + 1][8];
+
+            BitUnpackTables() : shuffles(), shifts() {
+                for (unsigned int bitWidth = 1; bitWidth <= MAX_AVX2_BIT_WIDTH; bitWidth++) {
+                    for (unsigned int j = 0; j < 8; j++) {
+                        const unsigned int loadBit = (j < 4) ? 0 : 8 * (bitWidth / 2);
+                        const unsigned int bitIndex = j * bitWidth - loadBit;
+                        for (unsigned int k = 0; k < 4; k++) {
+                            shuffles[bitWidth][4 * j + k] = static_cast<byte>(bitIndex / 8 + k);
+                        }
+                        shifts[bitWidth][j] = bitIndex % 8;
+                    }
+                }
+            }
+        };
+
+        /// Unpacks whole groups of 8 values, and returns the number of values done.
+        MF_BYTES_TARGET("avx2")
+        static std::size_t bitUnpackWithAvx2(
+            const byte* input,
+            std::size_t inputSize,
+            std::size_t count,
+            unsigned int bitWidth,
+            std::uint32_t* output) {
+            static const BitUnpackTables tables;
+            const __m256i shuffle =
+                _mm256_load_si256(reinterpret_cast<const __m256i*>(tables.shuffles[bitWidth]));
+            const __m256i shifts =
+                _mm256_load_si256(reinterpret_cast<const __m256i*>(tables.shifts[bitWidth]));
+            const __m256i mask = _mm256_set1_epi32(static_cast<int>((1U << bitWidth) - 1));
+            const std::size_t secondLoad = bitWidth / 2;
+
+            // Both loads stay in the 32 bytes from the group start.
+            std::size_t i = 0;
+            std::size_t groupStart = 0;
+            for (; i + 8 <= count && groupStart + 32 <= inputSize;
+                 i += 8, groupStart += bitWidth) {
+                const byte* const group = input + groupStart;
+                const __m256i bytes = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(group))),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(group + secondLoad)),
+                    1);
+                const __m256i values = _mm256_and_si256(
+                    _mm256_srlv_epi32(_mm256_shuffle_epi8(bytes, shuffle), shifts), mask);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), values);
+            }
+            return i;
+        }
+#endif
+
+        std::size_t bitUnpack(
+            const void* input,
+            std::size_t inputSize,
+            std::size_t count,
+            unsigned int bitWidth,
+            std::uint32_t* output) {
+            checkBitWidth<std::uint32_t>(nullptr, count, bitWidth);
+            if (inputSize < getBitPackedSize(count, bitWidth)) {
+                throwForShortInput(inputSize, count);
+            }
+            if (bitWidth == 0) {
+                std::fill(output, output + count, 0);
+                return 0;
+            }
+
+            const byte* const bytes = static_cast<const byte*>(input);
+            std::size_t first = 0;
+#if MF_BYTES_SIMD
+            static const bool hasAvx2 = getCpuFeatures().avx2;
+            if (hasAvx2 && bitWidth <= MAX_AVX2_BIT_WIDTH) {
+                first = bitUnpackWithAvx2(bytes, inputSize, count, bitWidth, output);
+            }
+#endif
+            return bitUnpackWithScalar(bytes, inputSize, first, count, bitWidth, output);
+        }
+
+        std::size_t bitUnpack(
+            const void* input,
+            std::size_t inputSize,
+            std::size_t count,
+            unsigned int bitWidth,
+            std::uint64_t* output) {
+            checkBitWidth<std::uint64_t>(nullptr, count, bitWidth);
+            if (inputSize < getBitPackedSize(count, bitWidth)) {
+                throwForShortInput(inputSize, count);
+            }
+
+            // A value may span 9 bytes: 7 bits of offset + 64 bits.
+            const byte* const bytes = static_cast<const byte*>(input);
+            const std::uint64_t mask =
+                (bitWidth == 64) ? ~std::uint64_t(0) : (std::uint64_t(1) << bitWidth) - 1;
+            for (std::size_t i = 0; i < count && bitWidth > 0; i++) {
+                const std::size_t bitIndex = i * bitWidth;
+                const std::size_t byteIndex = bitIndex / 8;
+                const unsigned int shift = bitIndex % 8;
+                std::uint64_t value =
+                    loadLittleEndian64Padded(bytes + byteIndex, inputSize - byteIndex) >> shift;
+                if (shift + bitWidth > 64) {
+                    value |= static_cast<std::uint64_t>(bytes[byteIndex + 8]) << (64 - shift);
+                }
+                output[i] = value & mask;
+            }
+            if (bitWidth == 0) {
+                std::fill(output, output + count, 0);
+            }
+            return getBitPackedSize(count, bitWidth);
+        }
+
+        std::shared_ptr<Buffer> bitPack(const Buffer& values, unsigned int bitWidth) {
+            const std::size_t count = getValuesCount(values);
+            auto result = BufferPool::makeBuffer(getBitPackedSize(count, bitWidth));
+            bitPack(values.getWithCast<std::uint32_t>(), count, bitWidth, result->get());
+            return result;
+        }
+
+        std::shared_ptr<Buffer> bitUnpack(
+            const Buffer& input, std::size_t count, unsigned int bitWidth) {
+            auto result = BufferPool::makeBuffer(count * sizeof(std::uint32_t));
+            bitUnpack(
+                input.get(), input.getSize(), count, bitWidth,
+                result->getWithCast<std::uint32_t>());
+            return result;
+        }
+
+        // ----- DELTA + ZIGZAG ----- //
+
+        template <typename UInt>
+        static void encodeDeltaZigZagOf(const UInt* values, std::size_t count, UInt* output) {
+            constexpr unsigned int signShift = 8 * sizeof(UInt) - 1;
+            UInt previous = 0;
+            for (std::size_t i = 0; i < count; i++) {
+                const UInt value = values[i];
+                const UInt delta = value - previous;
+                // Zigzag of the delta seen as signed: 0, -1, 1, -2... become 0, 1, 2, 3...
+                output[i] =
+                    static_cast<UInt>(delta << 1) ^ static_cast<UInt>(0 - (delta >> signShift));
+                previous = value;
+            }
+        }
+
+        template <typename UInt>
+        static UInt decodeDeltaZigZagWithScalar(
+            const UInt* values, std::size_t count, UInt* output, UInt previous) {
+            for (std::size_t i = 0; i < count; i++) {
+                const UInt value = values[i];
+                previous += (value >> 1) ^ static_cast<UInt>(0 - (value & 1));
+                output[i] = previous;
+            }
+            return previous;
+        }
+
+#if MF_BYTES_SIMD
+        MF_BYTES_TARGET("sse2")
+        static void decodeDeltaZigZagWithSse2(
+            const std::uint32_t* values, std::size_t count, std::uint32_t* output) {
+            const __m128i one = _mm_set1_epi32(1);
+            const __m128i zero = _mm_setzero_si128();
+            __m128i previous = zero;
+
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const __m128i encoded =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+                __m128i deltas = _mm_xor_si128(
+                    _mm_srli_epi32(encoded, 1), _mm_sub_epi32(zero, _mm_and_si128(encoded, one)));
+                // Prefix sums in 2 steps, then the last value of the previous block.
+                deltas = _mm_add_epi32(deltas, _mm_slli_si128(deltas, 4));
+                deltas = _mm_add_epi32(deltas, _mm_slli_si128(deltas, 8));
+                const __m128i decoded = _mm_add_epi32(deltas, previous);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), decoded);
+                previous = _mm_shuffle_epi32(decoded, _MM_SHUFFLE(3, 3, 3, 3));
+            }
+            decodeDeltaZigZagWithScalar(
+                values + i, count - i, output + i,
+                static_cast<std::uint32_t>(_mm_cvtsi128_si32(previous)));
+        }
+#endif
+
+        void encodeDeltaZigZag(
+            const std::uint32_t* values, std::size_t count, std::uint32_t* output) {
+            encodeDeltaZigZagOf(values, count, output);
+        }
+
+        void encodeDeltaZigZag(
+            const std::uint64_t* values, std::size_t count, std::uint64_t* output) {
+            encodeDeltaZigZagOf(values, count, output);
+        }
+
+        void decodeDeltaZigZag(
+            const std::uint32_t* values, std::size_t count, std::uint32_t* output) {
+#if MF_BYTES_SIMD
+            static const bool hasSse2 = getCpuFeatures().sse2;
+            if (hasSse2) {
+                decodeDeltaZigZagWithSse2(values, count, output);
+                return;
+            }
+#endif
+            decodeDeltaZigZagWithScalar(values, count, output, std::uint32_t(0));
+        }
+
+        void decodeDeltaZigZag(
+            const std::uint64_t* values, std::size_t count, std::uint64_t* output) {
+            decodeDeltaZigZagWithScalar(values, count, output, std::uint64_t(0));
+        }
+
+        void encodeDeltaZigZag(Buffer& values) {
+            auto* const data = values.getWithCast<std::uint32_t>();
+            encodeDeltaZigZag(data, getValuesCount(values), data);
+        }
+
+        void decodeDeltaZigZag(Buffer& values) {
+            auto* const data = values.getWithCast<std::uint32_t>();
+            decodeDeltaZigZag(data, getValuesCount(values), data);
+        }
+
+        // ----- STREAMVBYTE ----- //
+
+        /// Without branches, since the lengths are unpredictable.
+        static inline unsigned int getEncodedLength(std::uint32_t value) {
+            return 1 + (value > 0xFFU) + (value > 0xFFFFU) + (value > 0xFFFFFFU);
+        }
+
+        std::size_t streamVByteEncode(
+            const std::uint32_t* values, std::size_t count, void* output) {
+            byte* const controls = static_cast<byte*>(output);
+            const std::size_t controlsSize = (count + 3) / 4;
+
+            // Always stores 4 bytes, which fits since the output has the maximal size.
+            byte* data = controls + controlsSize;
+            const auto encodeGroup = [&data](const std::uint32_t* group, std::size_t size) {
+                unsigned int control = 0;
+                for (std::size_t j = 0; j < size; j++) {
+                    const unsigned int length = getEncodedLength(group[j]);
+                    control |= (length - 1) << (2 * j);
+                    storeLittleEndian(data, group[j]);
+                    data += length;
+                }
+                return static_cast<byte>(control);
+            };
+
+            // Whole groups with a constant size, so that the compiler unrolls them.
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                controls[i / 4] = encodeGroup(values + i, 4);
+            }
+            if (i < count) {
+                controls[i / 4] = encodeGroup(values + i, count - i);
+            }
+            return static_cast<std::size_t>(data - controls);
+        }
+
+        /// Decodes from the value "first", and returns the end of the data bytes.
+        static const byte* streamVByteDecodeWithScalar(
+            const byte* controls,
+            const byte* data,
+            const byte* end,
+            std::size_t first,
+            std::size_t count,
+            std::uint32_t* output) {
+            for (std::size_t i = first; i < count; i++) {
+                const unsigned int length = ((controls[i / 4] >> (2 * (i % 4))) & 3) + 1;
+                if (static_cast<std::size_t>(end - data) < length) {
+                    throwForShortInput(static_cast<std::size_t>(end - controls), count);
+                }
+                std::uint32_t value = 0;
+                for (unsigned int k = 0; k < length; k++) {
+                    value |= static_cast<std::uint32_t>(data[k]) << (8 * k);
+                }
+                output[i] = value;
+                data += length;
+            }
+            return data;
+        }
+
+#if MF_BYTES_SIMD
+        /// For each control byte: the shuffle which spreads its 4 values, and their total length.
+        struct StreamVByteTables {
+            alignas(16) byte shuffles[256][16];
+            byte lengths[256];
+
+            StreamVByteTables() : shuffles(), lengths() {
+                for (unsigned int control = 0; control < 256; control++) {
+                    unsigned int offset = 0;
+                    for (unsigned int j = 0; j < 4; j++) {
+                        const unsigned int length = ((control >> (2 * j)) & 3) + 1;
+                        for (unsigned int k = 0; k < 4; k++) {
+                            // The high bit makes the shuffle write a 0.
+                            shuffles[control][4 * j + k] =
+                                static_cast<byte>((k < length) ? offset + k : 0x80);
+                        }
+                        offset += length;
+                    }
+                    lengths[control] = static_cast<byte>(offset);
+                }
+            }
+        };
+
+        MF_BYTES_TARGET("ssse3")
+        static const byte* streamVByteDecodeWithSsse3(
+            const byte* controls,
+            const byte* data,
+            const byte* end,
+            std::size_t count,
+            std::uint32_t* output) {
+            static const StreamVByteTables tables;
+
+            // Each step loads 16 data bytes, for at most 16 used.
+            std::size_t i = 0;
+            for (; i + 4 <= count && end - data >= 16; i += 4) {
+                const byte control = controls[i / 4];
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+                const __m128i shuffle =
+                    _mm_load_si128(reinterpret_cast<const __m128i*>(tables.shuffles[control]));
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(output + i), _mm_shuffle_epi8(bytes, shuffle));
+                data += tables.lengths[control];
+            }
+            return streamVByteDecodeWithScalar(controls, data, end, i, count, output);
+        }
+#endif
+
+        std::size_t streamVByteDecode(
+            const void* input, std::size_t inputSize, std::size_t count, std::uint32_t* output) {
+            const std::size_t controlsSize = (count + 3) / 4;
+            if (inputSize < controlsSize + count) {
+                throwForShortInput(inputSize, count);
+            }
+            const byte* const controls = static_cast<const byte*>(input);
+            const byte* const data = controls + controlsSize;
+            const byte* const end = controls + inputSize;
+
+#if MF_BYTES_SIMD
+            static const bool hasSsse3 = getCpuFeatures().ssse3;
+            if (hasSsse3) {
+                return static_cast<std::size_t>(
+                    streamVByteDecodeWithSsse3(controls, data, end, count, output) - controls);
+            }
+#endif
+            return static_cast<std::size_t>(
+                streamVByteDecodeWithScalar(controls, data, end, 0, count, output) - controls);
+        }
+
+        std::shared_ptr<Buffer> streamVByteEncode(const Buffer& values) {
+            const std::size_t count = getValuesCount(values);
+            const std::uint32_t* const data = values.getWithCast<std::uint32_t>();
+
+            // Small integers take up to 4 times less than the maximal size, so the exact size is
+            // computed first. The encoder stores 4 bytes for the last value, which may need 3
+            // more bytes: they are left out of the returned slice.
+            std::size_t size = (count + 3) / 4;
+            for (std::size_t i = 0; i < count; i++) {
+                size += getEncodedLength(data[i]);
+            }
+            const auto encoded = BufferPool::makeBuffer(size + 3);
+            streamVByteEncode(data, count, encoded->get());
+            return encoded->slice(0, size);
+        }
+
+        std::shared_ptr<Buffer> streamVByteDecode(const Buffer& input, std::size_t count) {
+            auto result = BufferPool::makeBuffer(count * sizeof(std::uint32_t));
+            streamVByteDecode(
+                input.get(), input.getSize(), count, result->getWithCast<std::uint32_t>());
+            return result;
+        }
+    } // namespace Bytes
+} // namespace MF
@@ -0,0 +1,163 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include "MF/RingBuffer.hpp"
+
+#if MF_UNIX
+#    include <algorithm>
+#    include <cerrno>
+#    include <cstdio>
+#    include <cstring>
+#    include <new>
+#    include <stdexcept>
+#    include <string>
+
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+
+#    include "MF/SystemErrors.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        static std::size_t computeCapacity(std::size_t minCapacity) {
+            std::size_t result = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+            while (result < minCapacity) {
+                if (result > static_cast<std::size_t>(-1) / 4) {
+                    throw std::bad_alloc();
+                }
+                result *= 2;
+            }
+            return result;
+        }
+
+        /// Anonymous shared memory, which can be mapped several times.
+        static int createSharedMemory(std::size_t size) {
+#    if defined(__linux__)
+            const int fd = memfd_create("MF_RingBuffer", MFD_CLOEXEC);
+#    else
+            // A unique name, removed at once: only the file descriptor remains.
+            char name[64];
+            std::snprintf(
+                name, sizeof(name), "/MF_RingBuffer_%ld_%p", static_cast<long>(getpid()),
+                static_cast<void*>(name));
+            const int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+            if (fd != -1) {
+                shm_unlink(name);
+            }
+#    endif
+            MF::SystemErrors::Errno::throwCurrentSystemErrorIf(fd == -1);
+
+            if (ftruncate(fd, static_cast<off_t>(size)) == -1) {
+                const int error = errno;
+                close(fd);
+                errno = error;
+                MF::SystemErrors::Errno::throwCurrentSystemErrorIf(true);
+            }
+            return fd;
+        }
+
+        RingBuffer::RingBuffer(std::size_t minCapacity)
+            : memory(nullptr), capacity(computeCapacity(minCapacity)), padding() {
+            const int fd = createSharedMemory(capacity);
+
+            // Reserves the addresses of both mappings, then maps the memory on each half.
+            void* const area =
+                mmap(nullptr, 2 * capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            int error = (area == MAP_FAILED) ? errno : 0;
+            for (std::size_t half = 0; half < 2 && error == 0; half++) {
+                void* const mapped = mmap(
+                    static_cast<byte*>(area) + half * capacity, capacity, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_FIXED, fd, 0);
+                if (mapped == MAP_FAILED) {
+                    error = errno;
+                    munmap(area, 2 * capacity);
+                }
+            }
+
+            // The mappings keep the memory alive.
+            close(fd);
+            errno = error;
+            MF::SystemErrors::Errno::throwCurrentSystemErrorIf(error != 0);
+            memory = static_cast<byte*>(area);
+        }
+
+        RingBuffer::~RingBuffer() {
+            munmap(memory, 2 * capacity);
+        }
+
+        // ----- PRODUCER ----- //
+
+        BufferSpan RingBuffer::getWritableSpan(std::size_t minSize) {
+            const std::size_t write = producer.index.load(std::memory_order_relaxed);
+            std::size_t freeSize = capacity - (write - producer.otherIndex);
+            if (freeSize < minSize) {
+                producer.otherIndex = consumer.index.load(std::memory_order_acquire);
+                freeSize = capacity - (write - producer.otherIndex);
+            }
+            return BufferSpan(memory + (write & (capacity - 1)), freeSize);
+        }
+
+        void RingBuffer::commit(std::size_t nbBytes) {
+            const std::size_t write = producer.index.load(std::memory_order_relaxed);
+            const std::size_t freeSize = capacity - (write - producer.otherIndex);
+            if (nbBytes > freeSize) {
+                throw std::out_of_range(
+                    "Cannot commit " + std::to_string(nbBytes) + " bytes: only " +
+                    std::to_string(freeSize) + " bytes are writable.");
+            }
+            producer.index.store(write + nbBytes, std::memory_order_release);
+        }
+
+        bool RingBuffer::tryWrite(const void* data, std::size_t size) {
+            if (size > capacity) {
+                return false;
+            }
+            const BufferSpan span = getWritableSpan(size);
+            if (span.size() < size) {
+                return false;
+            }
+            std::memcpy(span.data(), data, size);
+            commit(size);
+            return true;
+        }
+
+        // ----- CONSUMER ----- //
+
+        BufferSpan RingBuffer::getReadableSpan(std::size_t minSize) {
+            const std::size_t read = consumer.index.load(std::memory_order_relaxed);
+            std::size_t readableSize = consumer.otherIndex - read;
+            if (readableSize < minSize) {
+                consumer.otherIndex = producer.index.load(std::memory_order_acquire);
+                readableSize = consumer.otherIndex - read;
+            }
+            return BufferSpan(memory + (read & (capacity - 1)), readableSize);
+        }
+
+        void RingBuffer::consume(std::size_t nbBytes) {
+            const std::size_t read = consumer.index.load(std::memory_order_relaxed);
+            const std::size_t readableSize = consumer.otherIndex - read;
+            if (nbBytes > readableSize) {
+                throw std::out_of_range(
+                    "Cannot consume " + std::to_string(nbBytes) + " bytes: only " +
+                    std::to_string(readableSize) + " bytes are readable.");
+            }
+            consumer.index.store(read + nbBytes, std::memory_order_release);
+        }
+
+        std::size_t RingBuffer::tryRead(void* output, std::size_t maxSize) {
+            const BufferSpan span = getReadableSpan(maxSize);
+            const std::size_t size = std::min(maxSize, span.size());
+            if (size > 0) {
+                std::memcpy(output, span.data(), size);
+                consume(size);
+            }
+            return size;
+        }
+    } // namespace Bytes
+} // namespace MF
+
+#endif
@@ -0,0 +1,214 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <cstring>
+#include <stdexcept>
+
+#include "BytesCpuHelper.hpp"
+#include "MF/Bytes.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        // ----- SCALAR ----- //
+
+        template <typename UInt>
+        static void swapWithScalar(
+            const byte* input, byte* output, std::size_t firstIndex, std::size_t count) {
+            for (std::size_t i = firstIndex; i < count; i++) {
+                UInt value;
+                std::memcpy(&value, input + i * sizeof(UInt), sizeof(UInt));
+                value = detail::swapBytesInline(value);
+                std::memcpy(output + i * sizeof(UInt), &value, sizeof(UInt));
+            }
+        }
+
+        // ----- SIMD ----- //
+
+        /// Processes as many whole blocks as possible and returns the number of bytes processed.
+        using BlockSwapper_t =
+            std::size_t (*)(const byte* input, byte* output, std::size_t nbBytes, const byte* mask);
+
+        static std::size_t swapWithNothing(const byte*, byte*, std::size_t, const byte*) {
+            return 0;
+        }
+
+#if MF_BYTES_SIMD
+        /// Shuffle masks reversing each element of a 32-bytes block.
+        template <std::size_t ElementSize>
+        struct ReverseMask {
+            alignas(32) byte indices[32];
+
+            ReverseMask() : indices() {
+                for (std::size_t i = 0; i < 32; i++) {
+                    const std::size_t inLane = i % 16;
+                    indices[i] = static_cast<byte>(
+                        (inLane / ElementSize) * ElementSize + (ElementSize - 1) -
+                        (inLane % ElementSize));
+                }
+            }
+        };
+
+        MF_BYTES_TARGET("ssse3")
+        static std::size_t swapWithSsse3(
+            const byte* input, byte* output, std::size_t nbBytes, const byte* mask) {
+            const __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(mask));
+
+            std::size_t done = 0;
+            for (; done + 16 <= nbBytes; done += 16) {
+                const __m128i block =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + done));
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(output + done), _mm_shuffle_epi8(block, shuffle));
+            }
+            return done;
+        }
+
+        MF_BYTES_TARGET("avx2")
+        static std::size_t swapWithAvx2(
+            const byte* input, byte* output, std::size_t nbBytes, const byte* mask) {
+            const __m256i shuffle = _mm256_load_si256(reinterpret_cast<const __m256i*>(mask));
+
+            std::size_t done = 0;
+            for (; done + 64 <= nbBytes; done += 64) {
+                const __m256i block0 =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + done));
+                const __m256i block1 =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + done + 32));
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + done),
+                    _mm256_shuffle_epi8(block0, shuffle));
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + done + 32),
+                    _mm256_shuffle_epi8(block1, shuffle));
+            }
+            for (; done + 32 <= nbBytes; done += 32) {
+                const __m256i block =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + done));
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + done), _mm256_shuffle_epi8(block, shuffle));
+            }
+            if (done + 16 <= nbBytes) {
+                const __m128i shuffle128 = _mm256_castsi256_si128(shuffle);
+                const __m128i block =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + done));
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(output + done),
+                    _mm_shuffle_epi8(block, shuffle128));
+                done += 16;
+            }
+            return done;
+        }
+#endif
+
+        static BlockSwapper_t selectBlockSwapper() {
+#if MF_BYTES_SIMD
+            if (getCpuFeatures().avx2) {
+                return swapWithAvx2;
+            }
+            if (getCpuFeatures().ssse3) {
+                return swapWithSsse3;
+            }
+#endif
+            return swapWithNothing;
+        }
+
+        template <typename UInt>
+        static void swapArray(
+            BlockSwapper_t blockSwapper, const byte* input, byte* output, std::size_t count) {
+#if MF_BYTES_SIMD
+            static const ReverseMask<sizeof(UInt)> mask;
+            const byte* maskIndices = mask.indices;
+#else
+            const byte* maskIndices = nullptr;
+#endif
+
+            // Blocks are multiples of 16 bytes, so they always contain whole elements.
+            const std::size_t doneBytes =
+                blockSwapper(input, output, count * sizeof(UInt), maskIndices);
+            swapWithScalar<UInt>(input, output, doneBytes / sizeof(UInt), count);
+        }
+
+        template <typename UInt>
+        static void swapArray(const UInt* input, UInt* output, std::size_t count) {
+            static const BlockSwapper_t blockSwapper = selectBlockSwapper();
+            swapArray<UInt>(
+                blockSwapper, reinterpret_cast<const byte*>(input), reinterpret_cast<byte*>(output),
+                count);
+        }
+
+        void swapBytes(const std::uint16_t* input, std::uint16_t* output, std::size_t count) {
+            swapArray(input, output, count);
+        }
+
+        void swapBytes(const std::uint32_t* input, std::uint32_t* output, std::size_t count) {
+            swapArray(input, output, count);
+        }
+
+        void swapBytes(const std::uint64_t* input, std::uint64_t* output, std::size_t count) {
+            swapArray(input, output, count);
+        }
+
+        namespace detail
+        {
+            bool isSwapKernelSupported(SwapKernel kernel) {
+                switch (kernel) {
+#if MF_BYTES_SIMD
+                    case SwapKernel::SSSE3:
+                        return getCpuFeatures().ssse3;
+                    case SwapKernel::AVX2:
+                        return getCpuFeatures().avx2;
+#endif
+                    case SwapKernel::SCALAR:
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            /// @throws std::invalid_argument if the kernel is not supported.
+            static BlockSwapper_t getBlockSwapper(SwapKernel kernel) {
+                if (!isSwapKernelSupported(kernel)) {
+                    throw std::invalid_argument("The swap kernel is not supported by this CPU.");
+                }
+#if MF_BYTES_SIMD
+                if (kernel == SwapKernel::AVX2) {
+                    return swapWithAvx2;
+                }
+                if (kernel == SwapKernel::SSSE3) {
+                    return swapWithSsse3;
+                }
+#endif
+                return swapWithNothing;
+            }
+
+            template <typename UInt>
+            static void swapArrayWithKernel(
+                SwapKernel kernel, const UInt* input, UInt* output, std::size_t count) {
+                swapArray<UInt>(
+                    getBlockSwapper(kernel), reinterpret_cast<const byte*>(input),
+                    reinterpret_cast<byte*>(output), count);
+            }
+
+            void swapBytesWithKernel(
+                SwapKernel kernel, const std::uint16_t* input, std::uint16_t* output,
+                std::size_t count) {
+                swapArrayWithKernel(kernel, input, output, count);
+            }
+
+            void swapBytesWithKernel(
+                SwapKernel kernel, const std::uint32_t* input, std::uint32_t* output,
+                std::size_t count) {
+                swapArrayWithKernel(kernel, input, output, count);
+            }
+
+            void swapBytesWithKernel(
+                SwapKernel kernel, const std::uint64_t* input, std::uint64_t* output,
+                std::size_t count) {
+                swapArrayWithKernel(kernel, input, output, count);
+            }
+        } // namespace detail
+    } // namespace Bytes
+} // namespace MF
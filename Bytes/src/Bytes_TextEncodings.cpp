@@ -0,0 +1,734 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "BytesCpuHelper.hpp"
+#include "MF/BufferPool.hpp"
+#include "MF/TextEncodings.hpp"
+
+namespace MF
+{
+    namespace Bytes
+    {
+        [[noreturn]] static void throwForInvalidChar(
+            const char* encoding, const char* input, std::size_t index) {
+            throw std::invalid_argument(
+                std::string("Invalid ") + encoding + " input: unexpected char (code " +
+                std::to_string(static_cast<unsigned char>(input[index])) + ") at index " +
+                std::to_string(index) + ".");
+        }
+
+        // ----- BASE64 TABLES ----- //
+
+        struct Base64Tables {
+            char encode[64];
+            /// 6-bits value of each char, -1 for the chars out of the alphabet.
+            std::int8_t decode[256];
+            /// What to add to a 6-bits value to get its char, by range (see encodeBase64Block).
+            alignas(16) std::int8_t encodeOffsets[16];
+            char char62;
+            char char63;
+            bool padding;
+
+            Base64Tables(char char62, char char63, bool padding)
+                : encode(), decode(), encodeOffsets(), char62(char62), char63(char63),
+                  padding(padding) {
+                const char* const letters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+                for (int i = 0; i < 52; i++) {
+                    encode[i] = letters[i];
+                }
+                for (int i = 0; i < 10; i++) {
+                    encode[52 + i] = static_cast<char>('0' + i);
+                }
+                encode[62] = char62;
+                encode[63] = char63;
+
+                for (auto& value : decode) {
+                    value = -1;
+                }
+                for (int i = 0; i < 64; i++) {
+                    decode[static_cast<unsigned char>(encode[i])] = static_cast<std::int8_t>(i);
+                }
+
+                encodeOffsets[0] = 'a' - 26;
+                for (int i = 1; i <= 10; i++) {
+                    encodeOffsets[i] = '0' - 52;
+                }
+                encodeOffsets[11] = static_cast<std::int8_t>(char62 - 62);
+                encodeOffsets[12] = static_cast<std::int8_t>(char63 - 63);
+                encodeOffsets[13] = 'A';
+            }
+        };
+
+        static const Base64Tables& getBase64Tables(Base64Alphabet alphabet) {
+            static const Base64Tables standard('+', '/', true);
+            static const Base64Tables urlSafe('-', '_', false);
+            return (alphabet == Base64Alphabet::URL_SAFE) ? urlSafe : standard;
+        }
+
+        /// Length of the input without its padding. @throws std::invalid_argument if invalid.
+        static std::size_t getBase64DataLength(const char* input, std::size_t inputSize) {
+            std::size_t dataLength = inputSize;
+            while (dataLength > 0 && inputSize - dataLength < 2 && input[dataLength - 1] == '=') {
+                dataLength--;
+            }
+            if (dataLength != inputSize && inputSize % 4 != 0) {
+                throw std::invalid_argument(
+                    "Invalid base64 input: padded input must have a multiple of 4 chars.");
+            }
+            if (dataLength % 4 == 1) {
+                throw std::invalid_argument(
+                    "Invalid base64 input: " + std::to_string(dataLength) +
+                    " chars cannot be decoded.");
+            }
+            return dataLength;
+        }
+
+        // ----- BASE64 SIMD ----- //
+
+        /// Encodes as many whole blocks as possible and returns the number of bytes encoded.
+        using Base64Encoder_t = std::size_t (*)(
+            const byte* input, std::size_t inputSize, char* output, const Base64Tables& tables);
+
+        /**
+         * Decodes as many whole blocks as possible and returns the number of chars decoded.
+         * Stops at the first block with an invalid char: the scalar code reports the error.
+         */
+        using Base64Decoder_t = std::size_t (*)(
+            const char* input, std::size_t inputSize, byte* output, const Base64Tables& tables);
+
+        static std::size_t encodeBase64WithNothing(
+            const byte*, std::size_t, char*, const Base64Tables&) {
+            return 0;
+        }
+
+        static std::size_t decodeBase64WithNothing(
+            const char*, std::size_t, byte*, const Base64Tables&) {
+            return 0;
+        }
+
+#if MF_BYTES_SIMD
+        // The kernels follow "Faster Base64 Encoding and Decoding Using AVX2 Instructions"
+        // (W. Mula, D. Lemire). Each 128-bits lane handles 12 bytes <-> 16 chars.
+
+        /// Spreads 12 bytes into 16 6-bits values, then turns them into chars.
+        MF_BYTES_TARGET("ssse3")
+        static inline __m128i encodeBase64Block(__m128i input, __m128i offsets) {
+            input = _mm_shuffle_epi8(
+                input, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+            const __m128i high =
+                _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)),
+                                _mm_set1_epi32(0x04000040));
+            const __m128i low =
+                _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)),
+                                _mm_set1_epi32(0x01000010));
+            const __m128i values = _mm_or_si128(high, low);
+
+            // Ranges: 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12.
+            __m128i ranges = _mm_subs_epu8(values, _mm_set1_epi8(51));
+            const __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), values);
+            ranges = _mm_or_si128(ranges, _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+            return _mm_add_epi8(values, _mm_shuffle_epi8(offsets, ranges));
+        }
+
+        MF_BYTES_TARGET("avx2")
+        static inline __m256i encodeBase64Block(__m256i input, __m256i offsets) {
+            input = _mm256_shuffle_epi8(
+                input,
+                _mm256_setr_epi8(
+                    1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3, 5, 4, 7,
+                    6, 8, 7, 10, 9, 11, 10));
+            const __m256i high = _mm256_mulhi_epu16(
+                _mm256_and_si256(input, _mm256_set1_epi32(0x0FC0FC00)),
+                _mm256_set1_epi32(0x04000040));
+            const __m256i low = _mm256_mullo_epi16(
+                _mm256_and_si256(input, _mm256_set1_epi32(0x003F03F0)),
+                _mm256_set1_epi32(0x01000010));
+            const __m256i values = _mm256_or_si256(high, low);
+
+            __m256i ranges = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+            const __m256i isUpper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values);
+            ranges = _mm256_or_si256(ranges, _mm256_and_si256(isUpper, _mm256_set1_epi8(13)));
+            return _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, ranges));
+        }
+
+        /// 0xFF for the chars in [first, last], 0 for the others.
+        MF_BYTES_TARGET("ssse3")
+        static inline __m128i isInRange(__m128i chars, char first, char last) {
+            const __m128i shifted =
+                _mm_sub_epi8(chars, _mm_set1_epi8(static_cast<char>(first + 128)));
+            return _mm_cmplt_epi8(
+                shifted, _mm_set1_epi8(static_cast<char>(-128 + (last - first + 1))));
+        }
+
+        MF_BYTES_TARGET("avx2")
+        static inline __m256i isInRange(__m256i chars, char first, char last) {
+            const __m256i shifted =
+                _mm256_sub_epi8(chars, _mm256_set1_epi8(static_cast<char>(first + 128)));
+            return _mm256_cmpgt_epi8(
+                _mm256_set1_epi8(static_cast<char>(-128 + (last - first + 1))), shifted);
+        }
+
+        /// Packs 16 6-bits values into 12 bytes (followed by 4 zeros).
+        MF_BYTES_TARGET("ssse3")
+        static inline __m128i packBase64Block(__m128i values) {
+            const __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+            const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+            return _mm_shuffle_epi8(
+                quads, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        }
+
+        /// Packs 32 6-bits values into 24 bytes (followed by 8 zeros).
+        MF_BYTES_TARGET("avx2")
+        static inline __m256i packBase64Block(__m256i values) {
+            const __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+            const __m256i quads = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+            const __m256i lanes = _mm256_shuffle_epi8(
+                quads,
+                _mm256_setr_epi8(
+                    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10,
+                    9, 8, 14, 13, 12, -1, -1, -1, -1));
+            return _mm256_permutevar8x32_epi32(lanes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        }
+
+        MF_BYTES_TARGET("ssse3")
+        static std::size_t encodeBase64WithSsse3(
+            const byte* input, std::size_t inputSize, char* output, const Base64Tables& tables) {
+            const __m128i offsets =
+                _mm_load_si128(reinterpret_cast<const __m128i*>(tables.encodeOffsets));
+
+            // Loads 16 bytes to encode 12 of them.
+            std::size_t done = 0;
+            for (; done + 16 <= inputSize; done += 12) {
+                const __m128i block =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + done));
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(output + done / 3 * 4),
+                    encodeBase64Block(block, offsets));
+            }
+            return done;
+        }
+
+        MF_BYTES_TARGET("avx2")
+        static std::size_t encodeBase64WithAvx2(
+            const byte* input, std::size_t inputSize, char* output, const Base64Tables& tables) {
+            const __m256i offsets = _mm256_broadcastsi128_si256(
+                _mm_load_si128(reinterpret_cast<const __m128i*>(tables.encodeOffsets)));
+
+            // Each lane loads 16 bytes to encode 12 of them.
+            std::size_t done = 0;
+            for (; done + 28 <= inputSize; done += 24) {
+                const __m256i block = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + done))),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + done + 12)),
+                    1);
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + done / 3 * 4),
+                    encodeBase64Block(block, offsets));
+            }
+            return done + encodeBase64WithSsse3(
+                              input + done, inputSize - done, output + done / 3 * 4, tables);
+        }
+
+        MF_BYTES_TARGET("ssse3")
+        static std::size_t decodeBase64WithSsse3(
+            const char* input, std::size_t inputSize, byte* output, const Base64Tables& tables) {
+            const __m128i char62 = _mm_set1_epi8(tables.char62);
+            const __m128i char63 = _mm_set1_epi8(tables.char63);
+            const __m128i offset62 = _mm_set1_epi8(static_cast<char>(62 - tables.char62));
+            const __m128i offset63 = _mm_set1_epi8(static_cast<char>(63 - tables.char63));
+
+            // Stores 16 bytes to decode 12 of them: stops early enough to stay in the output.
+            std::size_t done = 0;
+            for (; done + 32 <= inputSize; done += 16) {
+                const __m128i chars =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + done));
+                const __m128i isUpper = isInRange(chars, 'A', 'Z');
+                const __m128i isLower = isInRange(chars, 'a', 'z');
+                const __m128i isDigit = isInRange(chars, '0', '9');
+                const __m128i is62 = _mm_cmpeq_epi8(chars, char62);
+                const __m128i is63 = _mm_cmpeq_epi8(chars, char63);
+
+                const __m128i isValid = _mm_or_si128(
+                    _mm_or_si128(_mm_or_si128(isUpper, isLower), _mm_or_si128(isDigit, is62)),
+                    is63);
+                if (_mm_movemask_epi8(isValid) != 0xFFFF) {
+                    break;
+                }
+
+                const __m128i offsets = _mm_or_si128(
+                    _mm_or_si128(
+                        _mm_and_si128(isUpper, _mm_set1_epi8(-'A')),
+                        _mm_and_si128(isLower, _mm_set1_epi8(26 - 'a'))),
+                    _mm_or_si128(
+                        _mm_and_si128(isDigit, _mm_set1_epi8(52 - '0')),
+                        _mm_or_si128(
+                            _mm_and_si128(is62, offset62), _mm_and_si128(is63, offset63))));
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(output + done / 4 * 3),
+                    packBase64Block(_mm_add_epi8(chars, offsets)));
+            }
+            return done;
+        }
+
+        MF_BYTES_TARGET("avx2")
+        static std::size_t decodeBase64WithAvx2(
+            const char* input, std::size_t inputSize, byte* output, const Base64Tables& tables) {
+            const __m256i char62 = _mm256_set1_epi8(tables.char62);
+            const __m256i char63 = _mm256_set1_epi8(tables.char63);
+            const __m256i offset62 = _mm256_set1_epi8(static_cast<char>(62 - tables.char62));
+            const __m256i offset63 = _mm256_set1_epi8(static_cast<char>(63 - tables.char63));
+
+            // Stores 32 bytes to decode 24 of them: stops early enough to stay in the output.
+            std::size_t done = 0;
+            for (; done + 64 <= inputSize; done += 32) {
+                const __m256i chars =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + done));
+                const __m256i isUpper = isInRange(chars, 'A', 'Z');
+                const __m256i isLower = isInRange(chars, 'a', 'z');
+                const __m256i isDigit = isInRange(chars, '0', '9');
+                const __m256i is62 = _mm256_cmpeq_epi8(chars, char62);
+                const __m256i is63 = _mm256_cmpeq_epi8(chars, char63);
+
+                const __m256i isValid = _mm256_or_si256(
+                    _mm256_or_si256(
+                        _mm256_or_si256(isUpper, isLower), _mm256_or_si256(isDigit, is62)),
+                    is63);
+                if (_mm256_movemask_epi8(isValid) != -1) {
+                    break;
+                }
+
+                const __m256i offsets = _mm256_or_si256(
+                    _mm256_or_si256(
+                        _mm256_and_si256(isUpper, _mm256_set1_epi8(-'A')),
+                        _mm256_and_si256(isLower, _mm256_set1_epi8(26 - 'a'))),
+                    _mm256_or_si256(
+                        _mm256_and_si256(isDigit, _mm256_set1_epi8(52 - '0')),
+                        _mm256_or_si256(
+                            _mm256_and_si256(is62, offset62), _mm256_and_si256(is63, offset63))));
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + done / 4 * 3),
+                    packBase64Block(_mm256_add_epi8(chars, offsets)));
+            }
+            return done + decodeBase64WithSsse3(
+                              input + done, inputSize - done, output + done / 4 * 3, tables);
+        }
+#endif
+
+        static Base64Encoder_t selectBase64Encoder() {
+#if MF_BYTES_SIMD
+            if (getCpuFeatures().avx2) {
+                return encodeBase64WithAvx2;
+            }
+            if (getCpuFeatures().ssse3) {
+                return encodeBase64WithSsse3;
+            }
+#endif
+            return encodeBase64WithNothing;
+        }
+
+        static Base64Decoder_t selectBase64Decoder() {
+#if MF_BYTES_SIMD
+            if (getCpuFeatures().avx2) {
+                return decodeBase64WithAvx2;
+            }
+            if (getCpuFeatures().ssse3) {
+                return decodeBase64WithSsse3;
+            }
+#endif
+            return decodeBase64WithNothing;
+        }
+
+        // ----- BASE64 ----- //
+
+        std::size_t getBase64EncodedSize(std::size_t inputSize, Base64Alphabet alphabet) {
+            if (getBase64Tables(alphabet).padding) {
+                return (inputSize + 2) / 3 * 4;
+            }
+            const std::size_t remaining = inputSize % 3;
+            return inputSize / 3 * 4 + ((remaining == 0) ? 0 : remaining + 1);
+        }
+
+        std::size_t getBase64DecodedSize(const char* input, std::size_t inputSize) {
+            const std::size_t dataLength = getBase64DataLength(input, inputSize);
+            const std::size_t remaining = dataLength % 4;
+            return dataLength / 4 * 3 + ((remaining == 0) ? 0 : remaining - 1);
+        }
+
+        std::size_t base64Encode(
+            const void* input, std::size_t inputSize, char* output, Base64Alphabet alphabet) {
+            static const Base64Encoder_t encoder = selectBase64Encoder();
+            const Base64Tables& tables = getBase64Tables(alphabet);
+            const byte* const bytes = static_cast<const byte*>(input);
+
+            std::size_t index = encoder(bytes, inputSize, output, tables);
+            char* current = output + index / 3 * 4;
+            for (; index + 3 <= inputSize; index += 3) {
+                const std::uint32_t bits = (static_cast<std::uint32_t>(bytes[index]) << 16) |
+                                           (static_cast<std::uint32_t>(bytes[index + 1]) << 8) |
+                                           bytes[index + 2];
+                current[0] = tables.encode[bits >> 18];
+                current[1] = tables.encode[(bits >> 12) & 0x3F];
+                current[2] = tables.encode[(bits >> 6) & 0x3F];
+                current[3] = tables.encode[bits & 0x3F];
+                current += 4;
+            }
+
+            const std::size_t remaining = inputSize - index;
+            if (remaining > 0) {
+                std::uint32_t bits = static_cast<std::uint32_t>(bytes[index]) << 16;
+                if (remaining == 2) {
+                    bits |= static_cast<std::uint32_t>(bytes[index + 1]) << 8;
+                }
+                *current++ = tables.encode[bits >> 18];
+                *current++ = tables.encode[(bits >> 12) & 0x3F];
+                if (remaining == 2) {
+                    *current++ = tables.encode[(bits >> 6) & 0x3F];
+                } else if (tables.padding) {
+                    *current++ = '=';
+                }
+                if (tables.padding) {
+                    *current++ = '=';
+                }
+            }
+            return static_cast<std::size_t>(current - output);
+        }
+
+        std::string base64Encode(const Buffer& input, Base64Alphabet alphabet) {
+            std::string result(getBase64EncodedSize(input.getSize(), alphabet), '\0');
+            base64Encode(input.get(), input.getSize(), &result[0], alphabet);
+            return result;
+        }
+
+        [[noreturn]] static void throwForInvalidBase64Chars(
+            const char* input, std::size_t firstIndex, const Base64Tables& tables) {
+            std::size_t index = firstIndex;
+            while (tables.decode[static_cast<unsigned char>(input[index])] >= 0) {
+                index++;
+            }
+            throwForInvalidChar("base64", input, index);
+        }
+
+        std::size_t base64Decode(
+            const char* input, std::size_t inputSize, void* output, Base64Alphabet alphabet) {
+            static const Base64Decoder_t decoder = selectBase64Decoder();
+            const Base64Tables& tables = getBase64Tables(alphabet);
+            const std::size_t dataLength = getBase64DataLength(input, inputSize);
+            byte* const bytes = static_cast<byte*>(output);
+
+            std::size_t index = decoder(input, dataLength, bytes, tables);
+            byte* current = bytes + index / 4 * 3;
+            for (; index + 4 <= dataLength; index += 4) {
+                const std::int8_t* const values = tables.decode;
+                const std::int32_t a = values[static_cast<unsigned char>(input[index])];
+                const std::int32_t b = values[static_cast<unsigned char>(input[index + 1])];
+                const std::int32_t c = values[static_cast<unsigned char>(input[index + 2])];
+                const std::int32_t d = values[static_cast<unsigned char>(input[index + 3])];
+                if ((a | b | c | d) < 0) {
+                    throwForInvalidBase64Chars(input, index, tables);
+                }
+
+                const std::uint32_t bits = static_cast<std::uint32_t>((a << 18) | (b << 12) |
+                                                                      (c << 6) | d);
+                current[0] = static_cast<byte>(bits >> 16);
+                current[1] = static_cast<byte>(bits >> 8);
+                current[2] = static_cast<byte>(bits);
+                current += 3;
+            }
+
+            const std::size_t remaining = dataLength - index;
+            if (remaining > 0) {
+                // 2 or 3 chars, as checked by getBase64DataLength.
+                std::uint32_t bits = 0;
+                for (std::size_t i = 0; i < remaining; i++) {
+                    const std::int8_t value =
+                        tables.decode[static_cast<unsigned char>(input[index + i])];
+                    if (value < 0) {
+                        throwForInvalidChar("base64", input, index + i);
+                    }
+                    bits |= static_cast<std::uint32_t>(value) << (18 - 6 * i);
+                }
+                if ((bits & ((remaining == 2) ? 0xFFFFU : 0xFFU)) != 0) {
+                    throw std::invalid_argument(
+                        "Invalid base64 input: the last char has non-zero unused bits.");
+                }
+
+                *current++ = static_cast<byte>(bits >> 16);
+                if (remaining == 3) {
+                    *current++ = static_cast<byte>(bits >> 8);
+                }
+            }
+            return static_cast<std::size_t>(current - bytes);
+        }
+
+        std::shared_ptr<Buffer> base64Decode(const std::string& input, Base64Alphabet alphabet) {
+            auto result =
+                BufferPool::makeBuffer(getBase64DecodedSize(input.data(), input.size()));
+            base64Decode(input.data(), input.size(), result->get(), alphabet);
+            return result;
+        }
+
+        // ----- HEXADECIMAL TABLES ----- //
+
+        static const char* const HEX_DIGITS = "0123456789abcdef";
+
+        struct HexTables {
+            /// Value of each char, -1 for the non hexadecimal chars.
+            std::int8_t decode[256];
+
+            HexTables() : decode() {
+                for (auto& value : decode) {
+                    value = -1;
+                }
+                for (int i = 0; i < 10; i++) {
+                    decode['0' + i] = static_cast<std::int8_t>(i);
+                }
+                for (int i = 0; i < 6; i++) {
+                    decode['a' + i] = static_cast<std::int8_t>(10 + i);
+                    decode['A' + i] = static_cast<std::int8_t>(10 + i);
+                }
+            }
+        };
+
+        // ----- HEXADECIMAL SIMD ----- //
+
+        /// Encodes as many whole blocks as possible and returns the number of bytes encoded.
+        using HexEncoder_t =
+            std::size_t (*)(const byte* input, std::size_t inputSize, char* output);
+
+        /**
+         * Decodes as many whole blocks as possible and returns the number of chars decoded.
+         * Stops at the first block with an invalid char: the scalar code reports the error.
+         */
+        using HexDecoder_t =
+            std::size_t (*)(const char* input, std::size_t inputSize, byte* output);
+
+        static std::size_t encodeHexWithNothing(const byte*, std::size_t, char*) {
+            return 0;
+        }
+
+        static std::size_t decodeHexWithNothing(const char*, std::size_t, byte*) {
+            return 0;
+        }
+
+#if MF_BYTES_SIMD
+        MF_BYTES_TARGET("ssse3")
+        static std::size_t encodeHexWithSsse3(
+            const byte* input, std::size_t inputSize, char* output) {
+            const __m128i digits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(HEX_DIGITS));
+            const __m128i lowNibble = _mm_set1_epi8(0x0F);
+
+            std::size_t done = 0;
+            for (; done + 16 <= inputSize; done += 16) {
+                const __m128i block =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + done));
+                const __m128i high = _mm_shuffle_epi8(
+                    digits, _mm_and_si128(_mm_srli_epi16(block, 4), lowNibble));
+                const __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(block, lowNibble));
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(output + 2 * done), _mm_unpacklo_epi8(high, low));
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(output + 2 * done + 16),
+                    _mm_unpackhi_epi8(high, low));
+            }
+            return done;
+        }
+
+        MF_BYTES_TARGET("avx2")
+        static std::size_t encodeHexWithAvx2(
+            const byte* input, std::size_t inputSize, char* output) {
+            const __m256i digits = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(HEX_DIGITS)));
+            const __m256i lowNibble = _mm256_set1_epi8(0x0F);
+
+            std::size_t done = 0;
+            for (; done + 32 <= inputSize; done += 32) {
+                const __m256i block =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + done));
+                const __m256i high = _mm256_shuffle_epi8(
+                    digits, _mm256_and_si256(_mm256_srli_epi16(block, 4), lowNibble));
+                const __m256i low =
+                    _mm256_shuffle_epi8(digits, _mm256_and_si256(block, lowNibble));
+                // The unpacks work by lane: bytes 0..7 and 16..23, then 8..15 and 24..31.
+                const __m256i first = _mm256_unpacklo_epi8(high, low);
+                const __m256i second = _mm256_unpackhi_epi8(high, low);
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + 2 * done),
+                    _mm256_permute2x128_si256(first, second, 0x20));
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + 2 * done + 32),
+                    _mm256_permute2x128_si256(first, second, 0x31));
+            }
+            return done + encodeHexWithSsse3(input + done, inputSize - done, output + 2 * done);
+        }
+
+        /// Values of 16 hexadecimal digits. Adds the invalid chars to "invalidMask".
+        MF_BYTES_TARGET("ssse3")
+        static inline __m128i decodeHexDigits(__m128i chars, int& invalidMask) {
+            const __m128i isDigit = isInRange(chars, '0', '9');
+            const __m128i isLower = isInRange(chars, 'a', 'f');
+            const __m128i isUpper = isInRange(chars, 'A', 'F');
+            invalidMask |=
+                ~_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(isDigit, isLower), isUpper));
+
+            const __m128i offsets = _mm_or_si128(
+                _mm_and_si128(isDigit, _mm_set1_epi8(-'0')),
+                _mm_or_si128(
+                    _mm_and_si128(isLower, _mm_set1_epi8(10 - 'a')),
+                    _mm_and_si128(isUpper, _mm_set1_epi8(10 - 'A'))));
+            return _mm_add_epi8(chars, offsets);
+        }
+
+        MF_BYTES_TARGET("avx2")
+        static inline __m256i decodeHexDigits(__m256i chars, int& invalidMask) {
+            const __m256i isDigit = isInRange(chars, '0', '9');
+            const __m256i isLower = isInRange(chars, 'a', 'f');
+            const __m256i isUpper = isInRange(chars, 'A', 'F');
+            invalidMask |= ~_mm256_movemask_epi8(
+                _mm256_or_si256(_mm256_or_si256(isDigit, isLower), isUpper));
+
+            const __m256i offsets = _mm256_or_si256(
+                _mm256_and_si256(isDigit, _mm256_set1_epi8(-'0')),
+                _mm256_or_si256(
+                    _mm256_and_si256(isLower, _mm256_set1_epi8(10 - 'a')),
+                    _mm256_and_si256(isUpper, _mm256_set1_epi8(10 - 'A'))));
+            return _mm256_add_epi8(chars, offsets);
+        }
+
+        MF_BYTES_TARGET("ssse3")
+        static std::size_t decodeHexWithSsse3(
+            const char* input, std::size_t inputSize, byte* output) {
+            // Each 16-bits pair of digits becomes "high * 16 + low".
+            const __m128i weights = _mm_set1_epi16(0x0110);
+
+            std::size_t done = 0;
+            for (; done + 32 <= inputSize; done += 32) {
+                int invalidMask = 0;
+                const __m128i first = decodeHexDigits(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + done)), invalidMask);
+                const __m128i second = decodeHexDigits(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + done + 16)),
+                    invalidMask);
+                if ((invalidMask & 0xFFFF) != 0) {
+                    break;
+                }
+
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(output + done / 2),
+                    _mm_packus_epi16(
+                        _mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights)));
+            }
+            return done;
+        }
+
+        MF_BYTES_TARGET("avx2")
+        static std::size_t decodeHexWithAvx2(
+            const char* input, std::size_t inputSize, byte* output) {
+            const __m256i weights = _mm256_set1_epi16(0x0110);
+
+            std::size_t done = 0;
+            for (; done + 64 <= inputSize; done += 64) {
+                int invalidMask = 0;
+                const __m256i first = decodeHexDigits(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + done)),
+                    invalidMask);
+                const __m256i second = decodeHexDigits(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + done + 32)),
+                    invalidMask);
+                if (invalidMask != 0) {
+                    break;
+                }
+
+                // The pack works by lane: restores the order of the 64-bits quarters.
+                const __m256i packed = _mm256_packus_epi16(
+                    _mm256_maddubs_epi16(first, weights), _mm256_maddubs_epi16(second, weights));
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(output + done / 2),
+                    _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+            }
+            return done + decodeHexWithSsse3(input + done, inputSize - done, output + done / 2);
+        }
+#endif
+
+        static HexEncoder_t selectHexEncoder() {
+#if MF_BYTES_SIMD
+            if (getCpuFeatures().avx2) {
+                return encodeHexWithAvx2;
+            }
+            if (getCpuFeatures().ssse3) {
+                return encodeHexWithSsse3;
+            }
+#endif
+            return encodeHexWithNothing;
+        }
+
+        static HexDecoder_t selectHexDecoder() {
+#if MF_BYTES_SIMD
+            if (getCpuFeatures().avx2) {
+                return decodeHexWithAvx2;
+            }
+            if (getCpuFeatures().ssse3) {
+                return decodeHexWithSsse3;
+            }
+#endif
+            return decodeHexWithNothing;
+        }
+
+        // ----- HEXADECIMAL ----- //
+
+        std::size_t getHexDecodedSize(std::size_t inputSize) {
+            if (inputSize % 2 != 0) {
+                throw std::invalid_argument(
+                    "Invalid hexadecimal input: " + std::to_string(inputSize) +
+                    " chars cannot be decoded.");
+            }
+            return inputSize / 2;
+        }
+
+        std::size_t hexEncode(const void* input, std::size_t inputSize, char* output) {
+            static const HexEncoder_t encoder = selectHexEncoder();
+            const byte* const bytes = static_cast<const byte*>(input);
+
+            for (std::size_t i = encoder(bytes, inputSize, output); i < inputSize; i++) {
+                output[2 * i] = HEX_DIGITS[bytes[i] >> 4];
+                output[2 * i + 1] = HEX_DIGITS[bytes[i] & 0x0F];
+            }
+            return 2 * inputSize;
+        }
+
+        std::string hexEncode(const Buffer& input) {
+            std::string result(getHexEncodedSize(input.getSize()), '\0');
+            hexEncode(input.get(), input.getSize(), &result[0]);
+            return result;
+        }
+
+        std::size_t hexDecode(const char* input, std::size_t inputSize, void* output) {
+            static const HexDecoder_t decoder = selectHexDecoder();
+            static const HexTables tables;
+            const std::size_t outputSize = getHexDecodedSize(inputSize);
+            byte* const bytes = static_cast<byte*>(output);
+
+            for (std::size_t i = decoder(input, inputSize, bytes) / 2; i < outputSize; i++) {
+                const std::int32_t high = tables.decode[static_cast<unsigned char>(input[2 * i])];
+                const std::int32_t low =
+                    tables.decode[static_cast<unsigned char>(input[2 * i + 1])];
+                if ((high | low) < 0) {
+                    throwForInvalidChar("hexadecimal", input, (high < 0) ? 2 * i : 2 * i + 1);
+                }
+                bytes[i] = static_cast<byte>((high << 4) | low);
+            }
+            return outputSize;
+        }
+
+        std::shared_ptr<Buffer> hexDecode(const std::string& input) {
+            auto result = BufferPool::makeBuffer(getHexDecodedSize(input.size()));
+            hexDecode(input.data(), input.size(), result->get());
+            return result;
+        }
+    } // namespace Bytes
+} // namespace MF
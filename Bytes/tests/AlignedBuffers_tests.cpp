@@ -0,0 +1,49 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cstdint>
+
+#include "MF/Bytes.hpp"
+#include "tests_data.hpp"
+
+using namespace MF::Bytes;
+
+static bool isAlignedOn(const Buffer& buffer, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(buffer.get()) % alignment == 0;
+}
+
+static bool isFilledWithZeros(const Buffer& buffer) {
+    return std::all_of(buffer.cbegin(), buffer.cend(), [](byte value) { return value == 0; });
+}
+
+TEST(AlignedBuffers, it_aligns_the_memory) {
+    for (const std::size_t alignment : {1, 2, 8, 64, 4096, 1 << 16}) {
+        for (const std::size_t size : {0, 1, 100, 5000}) {
+            const auto buffer = makeAlignedBuffer(size, alignment);
+            ASSERT_EQ(buffer->getSize(), size);
+            EXPECT_TRUE(isAlignedOn(*buffer, alignment)) << alignment;
+            EXPECT_TRUE(isFilledWithZeros(*buffer));
+            std::fill(buffer->begin(), buffer->end(), 0xAB);
+        }
+    }
+
+    EXPECT_THROW(makeAlignedBuffer(10, 0), std::invalid_argument);
+    EXPECT_THROW(makeAlignedBuffer(10, 48), std::invalid_argument);
+}
+
+TEST(AlignedBuffers, it_gives_huge_page_buffers) {
+    for (const std::size_t size : {0, 1, 3 * 1024 * 1024}) {
+        const auto buffer = makeHugePageBuffer(size);
+        ASSERT_EQ(buffer->getSize(), size);
+        EXPECT_TRUE(isAlignedOn(*buffer, HUGE_PAGE_SIZE));
+        EXPECT_TRUE(isFilledWithZeros(*buffer));
+        std::fill(buffer->begin(), buffer->end(), 0xAB);
+    }
+
+    // The buffers can be sliced like any other.
+    const auto buffer = makeHugePageBuffer(1000);
+    const auto slice = buffer->slice(10, 20);
+    EXPECT_EQ(slice->getWithCast<byte>(), buffer->getWithCast<byte>() + 10);
+}
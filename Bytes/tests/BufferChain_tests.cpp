@@ -0,0 +1,113 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include "Bytes_tests_commons.hpp"
+#include "MF/BufferChain.hpp"
+
+#if MF_UNIX
+#    include <unistd.h>
+#endif
+
+using namespace MF::Bytes;
+
+static std::string chainToString(const BufferChain& chain) {
+    std::string result(chain.getSize(), '\0');
+    chain.copyTo(&result[0]);
+    return result;
+}
+
+class BufferChainTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        chain.append(makeBufferFromString("Hello"));
+        chain.append(makeBufferFromString(", "));
+        chain.append(makeBufferFromString("World"));
+    }
+
+    BufferChain chain;
+};
+
+TEST_F(BufferChainTest, it_appends_and_prepends_without_copy) {
+    auto header = makeBufferFromString("[header]");
+    chain.prepend(header);
+    chain.append(makeBufferWithSize(0));
+    chain.append(makeBufferFromString("!"));
+
+    EXPECT_EQ(chain.getSize(), 21);
+    EXPECT_EQ(chain.getBuffers().size(), 5);
+    EXPECT_EQ(chain.getBuffers().front(), header);
+    EXPECT_EQ(chainToString(chain), "[header]Hello, World!");
+}
+
+TEST_F(BufferChainTest, it_appends_another_chain) {
+    BufferChain other;
+    other.append(makeBufferFromString("<"));
+    other.append(chain);
+    other.prepend(chain);
+    chain.append(chain);
+
+    EXPECT_EQ(chainToString(other), "Hello, World<Hello, World");
+    EXPECT_EQ(chainToString(chain), "Hello, WorldHello, World");
+}
+
+TEST_F(BufferChainTest, it_consumes) {
+    const void* const worldMemory = chain.getBuffers().back()->get();
+
+    chain.consume(3);
+    EXPECT_EQ(chainToString(chain), "lo, World");
+    chain.consume(4);
+    EXPECT_EQ(chainToString(chain), "World");
+    EXPECT_EQ(chain.getBuffers().front()->get(), worldMemory);
+
+    EXPECT_THROW(chain.consume(6), std::out_of_range);
+    chain.consume(5);
+    EXPECT_TRUE(chain.isEmpty());
+    EXPECT_TRUE(chain.getBuffers().empty());
+}
+
+TEST_F(BufferChainTest, it_splits) {
+    BufferChain head = chain.split(6);
+
+    EXPECT_EQ(chainToString(head), "Hello,");
+    EXPECT_EQ(chainToString(chain), " World");
+    EXPECT_EQ(head.getBuffers().size(), 2);
+    EXPECT_EQ(chain.getBuffers().size(), 2);
+
+    EXPECT_THROW(chain.split(7), std::out_of_range);
+    EXPECT_TRUE(chain.split(0).isEmpty());
+}
+
+TEST_F(BufferChainTest, it_flattens) {
+    auto flat = chain.flatten();
+    EXPECT_EQ(std::string(flat->getWithCast<char>(), flat->getSize()), "Hello, World");
+
+    BufferChain single;
+    auto onlyBuffer = makeBufferFromString("only");
+    single.append(onlyBuffer);
+    EXPECT_EQ(single.flatten(), onlyBuffer);
+}
+
+#if MF_UNIX
+TEST_F(BufferChainTest, it_exports_iovecs) {
+    const std::vector<struct iovec> ioVectors = chain.getIovecs();
+
+    ASSERT_EQ(ioVectors.size(), 3);
+    EXPECT_EQ(ioVectors[1].iov_base, chain.getBuffers()[1]->get());
+    EXPECT_EQ(ioVectors[1].iov_len, 2);
+}
+
+TEST_F(BufferChainTest, it_writes_to_a_file_descriptor) {
+    int pipeEnds[2];
+    ASSERT_EQ(pipe(pipeEnds), 0);
+
+    chain.writeTo(pipeEnds[1]);
+    EXPECT_TRUE(chain.isEmpty());
+    close(pipeEnds[1]);
+
+    char received[32] = {0};
+    const ssize_t receivedSize = read(pipeEnds[0], received, sizeof(received));
+    close(pipeEnds[0]);
+    EXPECT_EQ(std::string(received, receivedSize), "Hello, World");
+}
+#endif
@@ -0,0 +1,147 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <limits>
+#include <vector>
+
+#include "MF/BufferCursors.hpp"
+#include "tests_data.hpp"
+
+using namespace MF::Bytes;
+
+TEST(BufferCursors, it_writes_and_reads_back_fixed_size_values) {
+    BufferWriter writer(Endianness::BIG_ENDIAN, 4);
+    writer.write<std::uint32_t>(0x01020304U);
+    writer.write<std::int16_t>(-2, Endianness::LITTLE_ENDIAN);
+    writer.write<double>(1.5);
+    writer.write<std::uint8_t>(9);
+    EXPECT_EQ(writer.getSize(), 15);
+    EXPECT_GE(writer.getCapacity(), 15);
+
+    auto written = writer.finish();
+    EXPECT_EQ(writer.getSize(), 0);
+    ASSERT_EQ(written->getSize(), 15);
+    EXPECT_EQ(written->getAt<byte>(0), 0x01);
+    EXPECT_EQ(written->getAt<byte>(3), 0x04);
+    EXPECT_EQ(written->getAt<byte>(4), 0xFE);
+
+    BufferReader reader(written, Endianness::BIG_ENDIAN);
+    EXPECT_EQ(reader.read<std::uint32_t>(), 0x01020304U);
+    EXPECT_EQ(reader.read<std::int16_t>(Endianness::LITTLE_ENDIAN), -2);
+    EXPECT_EQ(reader.read<double>(), 1.5);
+    EXPECT_EQ(reader.read<std::uint8_t>(), 9);
+    EXPECT_TRUE(reader.isAtEnd());
+    EXPECT_THROW(reader.read<std::uint8_t>(), std::out_of_range);
+}
+
+TEST(BufferCursors, it_supports_unchecked_batches) {
+    BufferWriter writer;
+    writer.reserve(3 * sizeof(std::uint16_t));
+    const std::size_t capacity = writer.getCapacity();
+    writer.writeUnchecked<std::uint16_t>(1);
+    writer.writeUnchecked<std::uint16_t>(2);
+    writer.writeUnchecked<std::uint16_t>(3);
+    EXPECT_EQ(writer.getCapacity(), capacity);
+
+    BufferReader reader(writer.finish());
+    EXPECT_THROW(reader.require(7), std::out_of_range);
+    reader.require(6);
+    EXPECT_EQ(reader.readUnchecked<std::uint16_t>(), 1);
+    EXPECT_EQ(reader.readUnchecked<std::uint16_t>(), 2);
+    EXPECT_EQ(reader.readUnchecked<std::uint16_t>(), 3);
+    EXPECT_EQ(reader.getRemaining(), 0);
+}
+
+TEST(BufferCursors, it_encodes_varints_as_leb128) {
+    BufferWriter writer;
+    writer.writeVarUInt(300);
+    writer.writeVarInt(-1);
+    const BufferSpan written = writer.getWrittenSpan();
+
+    ASSERT_EQ(written.size(), 3);
+    EXPECT_EQ(written[0], 0xAC);
+    EXPECT_EQ(written[1], 0x02);
+    EXPECT_EQ(written[2], 0x01);
+}
+
+TEST(BufferCursors, it_writes_and_reads_back_varints) {
+    const std::vector<std::uint64_t> unsignedValues = {
+        0, 1, 127, 128, 16383, 16384, 0xFFFFFFFFULL, std::numeric_limits<std::uint64_t>::max()};
+    const std::vector<std::int64_t> signedValues = {
+        0, -1, 1, -64, 64, std::numeric_limits<std::int64_t>::min(),
+        std::numeric_limits<std::int64_t>::max()};
+
+    BufferWriter writer(Endianness::LITTLE_ENDIAN, 1);
+    for (const auto value : unsignedValues) {
+        writer.writeVarUInt(value);
+    }
+    for (const auto value : signedValues) {
+        writer.writeVarInt(value);
+    }
+
+    BufferReader reader(writer.finish());
+    for (const auto value : unsignedValues) {
+        EXPECT_EQ(reader.readVarUInt(), value);
+    }
+    for (const auto value : signedValues) {
+        EXPECT_EQ(reader.readVarInt(), value);
+    }
+    EXPECT_TRUE(reader.isAtEnd());
+}
+
+TEST(BufferCursors, it_rejects_invalid_varints) {
+    byte truncated[] = {0x80, 0x80};
+    BufferReader truncatedReader(BufferSpan(truncated, sizeof(truncated)));
+    EXPECT_THROW(truncatedReader.readVarUInt(), std::out_of_range);
+
+    byte tooLong[11];
+    std::fill(std::begin(tooLong), std::end(tooLong), byte(0x80));
+    BufferReader tooLongReader(BufferSpan(tooLong, sizeof(tooLong)));
+    EXPECT_THROW(tooLongReader.readVarUInt(), std::invalid_argument);
+
+    byte overflowing[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02};
+    BufferReader overflowingReader(BufferSpan(overflowing, sizeof(overflowing)));
+    EXPECT_THROW(overflowingReader.readVarUInt(), std::invalid_argument);
+}
+
+TEST(BufferCursors, it_reads_length_prefixed_strings_as_views) {
+    BufferWriter writer;
+    writer.writeLengthPrefixed(std::string("Hello"));
+    writer.writeLengthPrefixed(std::string());
+    writer.writeVarUInt(100);
+    auto written = writer.finish();
+
+    BufferReader reader(written);
+    const BufferSpan hello = reader.readLengthPrefixedSpan();
+    EXPECT_EQ(hello.data(), written->getWithCast<byte>() + 1);
+    EXPECT_EQ(std::string(hello.begin(), hello.end()), "Hello");
+    EXPECT_EQ(reader.readLengthPrefixedString(), "");
+
+    const std::size_t position = reader.getPosition();
+    EXPECT_THROW(reader.readLengthPrefixedSpan(), std::out_of_range);
+    EXPECT_EQ(reader.getPosition(), position);
+}
+
+TEST(BufferCursors, it_reads_and_writes_no_bytes) {
+    // The data of an empty vector may be nullptr.
+    std::vector<byte> empty{};
+    BufferWriter writer(Endianness::BIG_ENDIAN, 0);
+    writer.writeBytes(empty.data(), 0);
+    EXPECT_EQ(writer.getSize(), 0);
+    writer.write<std::uint8_t>(7);
+    writer.writeBytes(empty.data(), 0);
+    auto written = writer.finish();
+    ASSERT_EQ(written->getSize(), 1);
+
+    BufferReader reader(written);
+    reader.readBytes(empty.data(), 0);
+    EXPECT_EQ(reader.getPosition(), 0);
+    EXPECT_EQ(reader.read<std::uint8_t>(), 7);
+    reader.readBytes(empty.data(), 0);
+    EXPECT_TRUE(reader.isAtEnd());
+
+    BufferReader emptyReader{BufferSpan()};
+    emptyReader.readBytes(empty.data(), 0);
+    EXPECT_TRUE(emptyReader.isAtEnd());
+}
@@ -0,0 +1,96 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <thread>
+
+#include "MF/BufferPool.hpp"
+#include "tests_data.hpp"
+
+using namespace MF::Bytes;
+
+TEST(BufferPool, it_recycles_released_blocks) {
+    BufferPool::releaseThreadCache();
+
+    auto buffer = BufferPool::makeBuffer(1000);
+    const void* const firstMemory = buffer->get();
+    EXPECT_EQ(buffer->getSize(), 1000);
+    buffer.reset();
+    EXPECT_EQ(BufferPool::getThreadCachedBlocksCount(), 1);
+
+    // Same size class, so the same block.
+    auto otherBuffer = BufferPool::makeBuffer(1010);
+    EXPECT_EQ(otherBuffer->get(), firstMemory);
+    EXPECT_EQ(BufferPool::getThreadCachedBlocksCount(), 0);
+}
+
+TEST(BufferPool, it_does_not_pool_big_buffers) {
+    BufferPool::releaseThreadCache();
+
+    auto buffer = BufferPool::makeBuffer(BufferPool::MAX_POOLED_BLOCK_SIZE * 2);
+    buffer->getAt<byte>(BufferPool::MAX_POOLED_BLOCK_SIZE * 2 - 1) = 42;
+    buffer.reset();
+    EXPECT_EQ(BufferPool::getThreadCachedBlocksCount(), 0);
+}
+
+TEST(BufferPool, it_gives_aligned_and_writable_memory) {
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    for (std::size_t size : {0, 1, 7, 100, 4096, 100000}) {
+        auto buffer = BufferPool::makeBuffer(size);
+        EXPECT_NE(buffer->get(), nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer->get()) % alignof(std::max_align_t), 0);
+        std::fill(buffer->begin(), buffer->end(), byte(0xAB));
+        buffers.push_back(buffer);
+    }
+    for (const auto& buffer : buffers) {
+        EXPECT_TRUE(std::all_of(buffer->cbegin(), buffer->cend(), [](byte value) {
+            return value == 0xAB;
+        }));
+    }
+}
+
+TEST(BufferPool, it_can_release_in_another_thread) {
+    auto buffer = BufferPool::makeBuffer(300);
+    std::thread otherThread([&buffer]() {
+        buffer.reset();
+        EXPECT_EQ(BufferPool::getThreadCachedBlocksCount(), 1);
+    });
+    otherThread.join();
+    EXPECT_EQ(buffer, nullptr);
+}
+
+TEST(BufferPool, makeBufferWithSize_gives_zeros_even_when_recycling) {
+    auto dirty = makeBufferWithSize(500);
+    std::fill(dirty->begin(), dirty->end(), byte(0xFF));
+    dirty.reset();
+
+    auto buffer = makeBufferWithSize(500);
+    EXPECT_TRUE(std::all_of(buffer->cbegin(), buffer->cend(), [](byte value) {
+        return value == 0;
+    }));
+}
+
+TEST(BufferSpan, it_views_the_buffer) {
+    auto buffer = makeBufferWithSize(16);
+    const BufferSpan span = buffer->getSpan();
+
+    EXPECT_EQ(span.data(), buffer->get());
+    EXPECT_EQ(span.size(), 16);
+    EXPECT_FALSE(span.empty());
+    EXPECT_EQ(span.end() - span.begin(), 16);
+
+    span[3] = 7;
+    EXPECT_EQ(buffer->getAt<byte>(3), 7);
+    span.getAt<std::uint32_t>(3) = 0x01020304U;
+    EXPECT_EQ(buffer->getWithCast<std::uint32_t>()[3], 0x01020304U);
+}
+
+TEST(BufferSpan, it_checks_the_bounds_in_elements) {
+    auto buffer = makeBufferWithSize(10);
+    const BufferSpan span = buffer->getSpan();
+
+    EXPECT_NO_THROW(span.getAt<std::uint32_t>(1));
+    EXPECT_THROW(span.getAt<std::uint32_t>(2), std::out_of_range);
+    EXPECT_THROW(BufferSpan().getAt<byte>(0), std::out_of_range);
+    EXPECT_TRUE(BufferSpan().empty());
+}
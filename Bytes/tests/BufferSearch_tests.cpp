@@ -0,0 +1,133 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <random>
+
+#include "Bytes_tests_commons.hpp"
+#include "MF/BufferSearch.hpp"
+
+using namespace MF::Bytes;
+
+/// Random bytes from a small alphabet, so that the searched values appear often.
+static std::vector<byte> makeRandomBytes(std::size_t size, unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::vector<byte> result(size);
+    for (auto& value : result) {
+        value = static_cast<byte>(0xF8 + generator() % 8);
+    }
+    return result;
+}
+
+static std::size_t toIndex(std::vector<byte>::const_iterator found, const std::vector<byte>& data) {
+    return (found == data.cend()) ? NOT_FOUND : static_cast<std::size_t>(found - data.cbegin());
+}
+
+TEST(BufferSearch, it_finds_and_counts_bytes_like_the_standard_algorithms) {
+    for (unsigned int seed = 0; seed < 20; seed++) {
+        const auto data = makeRandomBytes(seed * 13, seed);
+        for (const byte value : {byte(0xF8), byte(0xFF), byte(0x00)}) {
+            ASSERT_EQ(
+                findByte(data.data(), data.size(), value),
+                toIndex(std::find(data.cbegin(), data.cend(), value), data));
+            ASSERT_EQ(
+                countByte(data.data(), data.size(), value),
+                static_cast<std::size_t>(std::count(data.cbegin(), data.cend(), value)));
+        }
+    }
+
+    // Enough blocks to flush the byte counters of the SIMD count several times.
+    const std::vector<byte> zeros(100000, 0);
+    EXPECT_EQ(countByte(zeros.data(), zeros.size(), 0), zeros.size());
+    EXPECT_EQ(findByte(zeros.data(), zeros.size(), 1), NOT_FOUND);
+}
+
+TEST(BufferSearch, it_finds_any_byte_of_a_set) {
+    const ByteSet set = {0x00, 0x7F, 0x80, 0xFE, '\n'};
+    for (int value = 0; value < 256; value++) {
+        const bool expected = value == 0x00 || value == 0x7F || value == 0x80 || value == 0xFE ||
+                              value == '\n';
+        ASSERT_EQ(set.contains(static_cast<byte>(value)), expected) << value;
+    }
+
+    // Each value alone, at every position of a long input.
+    std::vector<byte> data(100, 'a');
+    for (std::size_t position = 0; position < data.size(); position++) {
+        for (const byte value : {byte(0x00), byte(0x7F), byte(0x80), byte(0xFE)}) {
+            data[position] = value;
+            ASSERT_EQ(findAnyByte(data.data(), data.size(), set), position);
+            data[position] = 0x81;
+            ASSERT_EQ(findAnyByte(data.data(), data.size(), set), NOT_FOUND);
+        }
+    }
+
+    EXPECT_EQ(findAnyByte(data.data(), data.size(), ByteSet()), NOT_FOUND);
+    EXPECT_EQ(findAnyByte(data.data(), data.size(), ByteSet(std::string("\x81"))), 0);
+}
+
+TEST(BufferSearch, it_finds_patterns_like_std_search) {
+    for (unsigned int seed = 0; seed < 30; seed++) {
+        const auto data = makeRandomBytes(20 + seed * 11, seed);
+        for (std::size_t patternSize = 0; patternSize < 6; patternSize++) {
+            const auto pattern = makeRandomBytes(patternSize, seed + 1000);
+            const auto expected = std::search(
+                data.cbegin(), data.cend(), pattern.cbegin(), pattern.cend());
+            ASSERT_EQ(
+                findPattern(data.data(), data.size(), pattern.data(), pattern.size()),
+                toIndex(expected, data))
+                << seed << " " << patternSize;
+        }
+    }
+
+    const std::string text(200, 'x');
+    EXPECT_EQ(findPattern(text.data(), text.size(), "xxy", 3), NOT_FOUND);
+    EXPECT_EQ(findPattern(text.data(), 2, "xxx", 3), NOT_FOUND);
+}
+
+TEST(BufferSearch, it_searches_in_buffers_from_an_index) {
+    const auto buffer = makeBufferFromString("key=value\r\nkey2=value2\r\n");
+    EXPECT_EQ(buffer->find('='), 3);
+    EXPECT_EQ(buffer->find('=', 4), 15);
+    EXPECT_EQ(buffer->find('=', 100), NOT_FOUND);
+    EXPECT_EQ(buffer->find("\r\n"), 9);
+    EXPECT_EQ(buffer->find("\r\n", 10), 22);
+    EXPECT_EQ(buffer->find("", 24), 24);
+    EXPECT_EQ(buffer->find("\r\n", 25), NOT_FOUND);
+    EXPECT_EQ(buffer->findAny(ByteSet{'\r', '='}, 4), 9);
+    EXPECT_EQ(buffer->count('e'), 4);
+}
+
+TEST(BufferSearch, it_finds_the_first_of_several_patterns) {
+    const PatternSet patterns({"\r\n", "\r", "\n"});
+    const std::string text = "ab\ncd\r\nef\r";
+
+    PatternMatch match = patterns.find(text.data(), text.size());
+    EXPECT_EQ(match.position, 2);
+    EXPECT_EQ(match.patternIndex, 2);
+
+    match = patterns.find(*makeBufferFromString(text), 3);
+    EXPECT_EQ(match.position, 5);
+    EXPECT_EQ(match.patternIndex, 0);
+
+    match = patterns.find("abc", 3);
+    EXPECT_EQ(match.position, NOT_FOUND);
+
+    EXPECT_THROW(PatternSet({}), std::invalid_argument);
+    EXPECT_THROW(PatternSet({"a", ""}), std::invalid_argument);
+}
+
+TEST(BufferSearch, it_splits_buffers_into_slices) {
+    const auto buffer = makeBufferFromString("a\r\nbb\n\r\nccc");
+    const auto parts = split(buffer, PatternSet({"\r\n", "\n"}));
+
+    ASSERT_EQ(parts.size(), 4);
+    EXPECT_EQ(toString(*parts[0]), "a");
+    EXPECT_EQ(toString(*parts[1]), "bb");
+    EXPECT_EQ(toString(*parts[2]), "");
+    EXPECT_EQ(toString(*parts[3]), "ccc");
+    EXPECT_EQ(parts[3]->get(), buffer->begin() + 8);
+
+    const auto empty = split(makeBufferWithSize(0), PatternSet({","}));
+    ASSERT_EQ(empty.size(), 1);
+    EXPECT_EQ(empty[0]->getSize(), 0);
+}
@@ -63,3 +63,165 @@ TEST(BytesTestsWithSize, it_can_get_at_index) {
         EXPECT_THROW(buffer->getAt<char>(wrongIndex), std::exception) << "Index=" << wrongIndex;
     }
 }
+
+// Lengths around the SIMD block sizes, to also go through the scalar tails.
+static const std::vector<std::size_t> SWAP_ARRAY_LENGTHS = {
+    0, 1, 3, 7, 8, 15, 16, 17, 31, 33, 1000};
+
+template <typename T>
+static std::vector<T> makeSwapArrayInput(std::size_t length) {
+    std::vector<T> result(length);
+    for (std::size_t i = 0; i < length; i++) {
+        result[i] = static_cast<T>(0x0102030405060708ULL * (i + 1));
+    }
+    return result;
+}
+
+TEST(SwapBytesOfArray, it_swaps_like_the_scalar_version) {
+    for (const std::size_t length : SWAP_ARRAY_LENGTHS) {
+        const auto input16 = makeSwapArrayInput<std::uint16_t>(length);
+        const auto input32 = makeSwapArrayInput<std::uint32_t>(length);
+        const auto input64 = makeSwapArrayInput<std::uint64_t>(length);
+        std::vector<std::uint16_t> output16(length);
+        std::vector<std::uint32_t> output32(length);
+        std::vector<std::uint64_t> output64(length);
+
+        swapBytes(input16.data(), output16.data(), length);
+        swapBytes(input32.data(), output32.data(), length);
+        swapBytes(input64.data(), output64.data(), length);
+
+        for (std::size_t i = 0; i < length; i++) {
+            ASSERT_EQ(output16[i], swapBytes(input16[i])) << "Length=" << length << " i=" << i;
+            ASSERT_EQ(output32[i], swapBytes(input32[i])) << "Length=" << length << " i=" << i;
+            ASSERT_EQ(output64[i], swapBytes(input64[i])) << "Length=" << length << " i=" << i;
+        }
+    }
+}
+
+/// Compares "kernel" with the scalar version, at offsets which break the SIMD alignment.
+template <typename UInt>
+static void checkSwapKernel(detail::SwapKernel kernel) {
+    for (const std::size_t length : SWAP_ARRAY_LENGTHS) {
+        for (std::size_t offset = 0; offset < 4; offset++) {
+            const auto input = makeSwapArrayInput<UInt>(length + offset);
+            std::vector<UInt> output(length + offset);
+            std::vector<UInt> expected(length + offset);
+            const UInt* const begin = input.data() + offset;
+            detail::swapBytesWithKernel(kernel, begin, output.data() + offset, length);
+            detail::swapBytesWithKernel(
+                detail::SwapKernel::SCALAR, begin, expected.data() + offset, length);
+            ASSERT_EQ(output, expected) << "Length=" << length << " offset=" << offset;
+            for (std::size_t i = offset; i < length + offset; i++) {
+                ASSERT_EQ(output[i], swapBytes(input[i])) << "Length=" << length << " i=" << i;
+            }
+        }
+    }
+}
+
+TEST(SwapBytesOfArray, it_swaps_alike_with_each_kernel) {
+    ASSERT_TRUE(detail::isSwapKernelSupported(detail::SwapKernel::SCALAR));
+    for (const auto kernel :
+         {detail::SwapKernel::SCALAR, detail::SwapKernel::SSSE3, detail::SwapKernel::AVX2}) {
+        if (!detail::isSwapKernelSupported(kernel)) {
+            std::uint32_t value = 0;
+            EXPECT_THROW(
+                detail::swapBytesWithKernel(kernel, &value, &value, 1), std::invalid_argument);
+            continue;
+        }
+        checkSwapKernel<std::uint16_t>(kernel);
+        checkSwapKernel<std::uint32_t>(kernel);
+        checkSwapKernel<std::uint64_t>(kernel);
+    }
+}
+
+TEST(SwapBytesOfArray, it_works_in_place_and_on_signed_types) {
+    auto values = makeSwapArrayInput<std::int32_t>(100);
+    const auto original = values;
+
+    swapBytesOfArray(values.data(), values.data(), values.size());
+    EXPECT_EQ(values[5], static_cast<std::int32_t>(swapBytes(std::uint32_t(original[5]))));
+    swapBytesOfArray(values.data(), values.data(), values.size());
+    EXPECT_EQ(values, original);
+}
+
+TEST(SwapBytesInPlace, it_swaps_each_element_of_the_buffer) {
+    auto buffer = makeBufferWithSize(4 * sizeof(std::uint32_t));
+    for (std::size_t i = 0; i < 4; i++) {
+        buffer->getAt<std::uint32_t>(i) = 0x11223344U + std::uint32_t(i);
+    }
+
+    swapBytesInPlace<std::uint32_t>(*buffer);
+
+    for (std::size_t i = 0; i < 4; i++) {
+        EXPECT_EQ(buffer->getAt<std::uint32_t>(i), swapBytes(0x11223344U + std::uint32_t(i)));
+    }
+}
+
+TEST(SwapBytesInPlace, it_throws_if_the_size_does_not_match) {
+    auto buffer = makeBufferWithSize(6);
+    EXPECT_THROW(swapBytesInPlace<std::uint32_t>(*buffer), std::invalid_argument);
+    EXPECT_NO_THROW(swapBytesInPlace<std::uint16_t>(*buffer));
+}
+
+TEST(DataConverterReadArray, it_copies_or_swaps) {
+    const auto input = makeSwapArrayInput<std::uint64_t>(40);
+    std::vector<std::uint64_t> output(input.size());
+
+    DataConverter<Endianness::BIG_ENDIAN, Endianness::BIG_ENDIAN>::readArray(
+        input.data(), output.data(), input.size());
+    EXPECT_EQ(output, input);
+
+    DataConverter<Endianness::BIG_ENDIAN, Endianness::LITTLE_ENDIAN>::readArray(
+        input.data(), output.data(), input.size());
+    for (std::size_t i = 0; i < input.size(); i++) {
+        EXPECT_EQ(output[i], swapBytes(input[i]));
+    }
+}
+
+TEST(BufferGetAt, it_checks_the_bounds_in_elements) {
+    auto buffer = makeBufferWithSize(10);
+
+    EXPECT_NO_THROW(buffer->getAt<std::uint32_t>(1));
+    EXPECT_THROW(buffer->getAt<std::uint32_t>(2), std::out_of_range);
+    EXPECT_NO_THROW(buffer->getAt<std::uint16_t>(4));
+    EXPECT_THROW(buffer->getAt<std::uint16_t>(5), std::out_of_range);
+}
+
+TEST(BufferSlice, it_views_the_parent_without_copy) {
+    auto parent = makeBufferWithSize(TESTS_BUFFER_SIZE);
+    auto slice = parent->slice(10, 20);
+
+    EXPECT_EQ(slice->get(), parent->getWithCast<byte>() + 10);
+    EXPECT_EQ(slice->getSize(), 20);
+    EXPECT_EQ(slice->end() - slice->begin(), 20);
+
+    slice->getAt<byte>(0) = 42;
+    EXPECT_EQ(parent->getAt<byte>(10), 42);
+    EXPECT_THROW(slice->getAt<byte>(20), std::out_of_range);
+}
+
+TEST(BufferSlice, it_keeps_the_parent_alive) {
+    auto parent = makeBufferWithSize(TESTS_BUFFER_SIZE);
+    std::weak_ptr<Buffer> weakParent = parent;
+    parent->getAt<byte>(TESTS_BUFFER_SIZE - 1) = 7;
+
+    auto slice = parent->slice(TESTS_BUFFER_SIZE - 3, 3);
+    auto sliceOfSlice = slice->slice(2, 1);
+    parent.reset();
+    slice.reset();
+
+    EXPECT_FALSE(weakParent.expired());
+    EXPECT_EQ(sliceOfSlice->getAt<byte>(0), 7);
+    sliceOfSlice.reset();
+    EXPECT_TRUE(weakParent.expired());
+}
+
+TEST(BufferSlice, it_rejects_invalid_ranges) {
+    auto parent = makeBufferWithSize(TESTS_BUFFER_SIZE);
+
+    EXPECT_NO_THROW(parent->slice(TESTS_BUFFER_SIZE, 0));
+    EXPECT_NO_THROW(parent->slice(0, TESTS_BUFFER_SIZE));
+    EXPECT_THROW(parent->slice(TESTS_BUFFER_SIZE, 1), std::out_of_range);
+    EXPECT_THROW(parent->slice(1, TESTS_BUFFER_SIZE), std::out_of_range);
+    EXPECT_THROW(parent->slice((std::size_t)-1, 2), std::out_of_range);
+}
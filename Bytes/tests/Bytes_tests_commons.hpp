@@ -0,0 +1,27 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_BYTES_TESTS_COMMONS_HPP
+#define MFRANCESCHI_CPPLIBRARIES_BYTES_TESTS_COMMONS_HPP
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "MF/Bytes.hpp"
+#include "tests_data.hpp"
+
+inline std::shared_ptr<MF::Bytes::Buffer> makeBufferFromString(const std::string& content) {
+    auto buffer = MF::Bytes::makeBufferWithSize(content.size());
+    std::copy(content.cbegin(), content.cend(), buffer->begin());
+    return buffer;
+}
+
+/// The bytes of a Buffer, a CowBuffer... as a string.
+template <typename Container>
+std::string toString(const Container& bytes) {
+    return std::string(bytes.cbegin(), bytes.cend());
+}
+
+#endif // MFRANCESCHI_CPPLIBRARIES_BYTES_TESTS_COMMONS_HPP
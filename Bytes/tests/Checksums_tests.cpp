@@ -0,0 +1,90 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <cstring>
+#include <vector>
+
+#include "MF/Checksums.hpp"
+#include "tests_data.hpp"
+
+using namespace MF::Bytes;
+
+static const char* const CHECK_INPUT = "123456789";
+
+/// 1000 bytes, long enough for the SIMD code paths. The expected values come from zlib and
+/// from reference implementations.
+static std::shared_ptr<Buffer> makeLongInput() {
+    auto buffer = makeBufferWithSize(1000);
+    for (std::size_t i = 0; i < buffer->getSize(); i++) {
+        buffer->getAt<byte>(i) = static_cast<byte>(i * 131 + 7);
+    }
+    return buffer;
+}
+
+/// Feeds the buffer in chunks of growing sizes, as from successive reads.
+template <typename Checksum>
+static void updateByChunks(Checksum& checksum, const Buffer& buffer) {
+    std::size_t offset = 0;
+    for (std::size_t chunkSize = 0; offset < buffer.getSize(); chunkSize++) {
+        const std::size_t size = std::min(chunkSize, buffer.getSize() - offset);
+        checksum.update(buffer.cbegin() + offset, size);
+        offset += size;
+    }
+}
+
+TEST(Checksums, it_computes_the_check_values) {
+    EXPECT_EQ(computeCrc32c(CHECK_INPUT, std::strlen(CHECK_INPUT)), 0xE3069283U);
+    EXPECT_EQ(computeCrc32(CHECK_INPUT, std::strlen(CHECK_INPUT)), 0xCBF43926U);
+    EXPECT_EQ(computeHash64("", 0), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(computeHash64("abc", 3), 0x44BC2CF5AD770999ULL);
+    EXPECT_EQ(computeHash64("abc", 3, 1), 0xBEA9CA8199328908ULL);
+
+    EXPECT_EQ(computeCrc32c(nullptr, 0), 0U);
+    EXPECT_EQ(computeCrc32(nullptr, 0), 0U);
+    const std::vector<byte> empty{};
+    EXPECT_EQ(computeHash64(empty.data(), empty.size()), 0xEF46DB3751D8E999ULL);
+}
+
+TEST(Checksums, it_computes_the_values_of_long_buffers) {
+    const auto input = makeLongInput();
+    EXPECT_EQ(computeCrc32c(*input), 0x8DBA050DU);
+    EXPECT_EQ(computeCrc32(*input), 0x1ED57BB9U);
+    EXPECT_EQ(computeHash64(*input), 0x0BF0BDBCC82EB373ULL);
+    EXPECT_EQ(computeHash64(*input, 42), 0x07C85880FC74F7FFULL);
+}
+
+TEST(Checksums, it_gives_the_same_values_when_streaming) {
+    const auto input = makeLongInput();
+
+    Crc32c crc32c;
+    updateByChunks(crc32c, *input);
+    EXPECT_EQ(crc32c.finalize(), computeCrc32c(*input));
+
+    Crc32 crc32;
+    updateByChunks(crc32, *input);
+    EXPECT_EQ(crc32.finalize(), computeCrc32(*input));
+
+    Hash64 hash(42);
+    updateByChunks(hash, *input);
+    EXPECT_EQ(hash.finalize(), computeHash64(*input, 42));
+}
+
+TEST(Checksums, it_can_finalize_several_times_and_reset) {
+    Hash64 hash;
+    hash.update("ab", 2);
+    const std::uint64_t partial = hash.finalize();
+    EXPECT_EQ(partial, hash.finalize());
+    hash.update("c", 1);
+    EXPECT_EQ(hash.finalize(), computeHash64("abc", 3));
+
+    hash.reset();
+    hash.update("ab", 2);
+    EXPECT_EQ(hash.finalize(), partial);
+
+    Crc32c crc;
+    crc.update(CHECK_INPUT, 4);
+    crc.reset();
+    crc.update(CHECK_INPUT, std::strlen(CHECK_INPUT));
+    EXPECT_EQ(crc.finalize(), 0xE3069283U);
+}
@@ -0,0 +1,233 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <cstring>
+#include <random>
+
+#include "MF/Compression.hpp"
+#include "tests_data.hpp"
+
+using namespace MF::Bytes;
+
+/// Words from a small vocabulary, with random noise: compressible, but not trivially.
+static std::vector<byte> makeTextLikeBytes(std::size_t size, unsigned int seed) {
+    static const char* const words[] = {"buffer ", "stream ", "the ", "of ", "compression ",
+                                        "block\n", "MF::Bytes ", "42 "};
+    std::mt19937 generator(seed);
+    std::vector<byte> result;
+    while (result.size() < size) {
+        if (generator() % 8 == 0) {
+            result.push_back(static_cast<byte>(generator()));
+        } else {
+            const char* const word = words[generator() % 8];
+            result.insert(result.end(), word, word + std::strlen(word));
+        }
+    }
+    result.resize(size);
+    return result;
+}
+
+static std::vector<byte> makeRandomBytes(std::size_t size, unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::vector<byte> result(size);
+    for (auto& value : result) {
+        value = static_cast<byte>(generator());
+    }
+    return result;
+}
+
+static std::shared_ptr<Buffer> toBuffer(const std::vector<byte>& data) {
+    auto result = makeBufferWithSize(data.size());
+    std::copy(data.begin(), data.end(), result->begin());
+    return result;
+}
+
+static std::vector<byte> toVector(const Buffer& buffer) {
+    return std::vector<byte>(buffer.cbegin(), buffer.cend());
+}
+
+static std::vector<byte> compressAndDecompressBlock(
+    const std::vector<byte>& data, std::size_t* compressedSize = nullptr) {
+    std::vector<byte> compressed(getCompressedBlockBound(data.size()));
+    const std::size_t size =
+        compressBlock(data.data(), data.size(), compressed.data(), compressed.size());
+    if (compressedSize != nullptr) {
+        *compressedSize = size;
+    }
+    std::vector<byte> result(data.size());
+    result.resize(decompressBlock(compressed.data(), size, result.data(), result.size()));
+    return result;
+}
+
+TEST(Compression, it_compresses_and_decompresses_blocks) {
+    for (std::size_t size = 0; size < 300; size++) {
+        const auto text = makeTextLikeBytes(size, static_cast<unsigned int>(size));
+        ASSERT_EQ(compressAndDecompressBlock(text), text) << size;
+        const auto random = makeRandomBytes(size, static_cast<unsigned int>(size));
+        ASSERT_EQ(compressAndDecompressBlock(random), random) << size;
+    }
+
+    std::size_t compressedSize = 0;
+    const auto text = makeTextLikeBytes(200000, 1);
+    EXPECT_EQ(compressAndDecompressBlock(text, &compressedSize), text);
+    EXPECT_LT(compressedSize, text.size() / 2);
+
+    // Long runs, which use the extended lengths and the overlapping copies.
+    for (std::size_t period = 1; period < 20; period++) {
+        std::vector<byte> runs(5000);
+        for (std::size_t i = 0; i < runs.size(); i++) {
+            runs[i] = static_cast<byte>(i % period);
+        }
+        ASSERT_EQ(compressAndDecompressBlock(runs, &compressedSize), runs) << period;
+        EXPECT_LT(compressedSize, 100);
+    }
+
+    const auto random = makeRandomBytes(100000, 2);
+    EXPECT_EQ(compressAndDecompressBlock(random, &compressedSize), random);
+    EXPECT_LE(compressedSize, getCompressedBlockBound(random.size()));
+
+    std::vector<byte> output(10);
+    EXPECT_THROW(compressBlock(random.data(), 100, output.data(), 100), std::invalid_argument);
+}
+
+TEST(Compression, it_decodes_the_block_format) {
+    // "abc", then a match of 9 bytes at offset 3, then the literals "hello".
+    const std::vector<byte> block = {0x35, 'a', 'b', 'c', 3, 0, 0x50, 'h', 'e', 'l', 'l', 'o'};
+    std::vector<byte> output(100);
+    const std::size_t size = decompressBlock(block.data(), block.size(), output.data(), 100);
+    EXPECT_EQ(std::string(output.begin(), output.begin() + size), "abcabcabcabchello");
+
+    // The exact room is enough.
+    EXPECT_EQ(decompressBlock(block.data(), block.size(), output.data(), 17), 17);
+}
+
+TEST(Compression, it_rejects_corrupted_blocks) {
+    std::vector<byte> output(100);
+    const auto decompress = [&output](const std::vector<byte>& block) {
+        return decompressBlock(block.data(), block.size(), output.data(), output.size());
+    };
+
+    EXPECT_THROW(decompress({}), std::invalid_argument);
+    // Offset 0, offset before the output, truncated offset, truncated literals.
+    EXPECT_THROW(decompress({0x10, 'a', 0, 0, 0x00}), std::invalid_argument);
+    EXPECT_THROW(decompress({0x10, 'a', 2, 0, 0x00}), std::invalid_argument);
+    EXPECT_THROW(decompress({0x10, 'a', 1}), std::invalid_argument);
+    EXPECT_THROW(decompress({0x30, 'a'}), std::invalid_argument);
+    // Truncated extended length, and match bigger than the output.
+    EXPECT_THROW(decompress({0xF0, 255}), std::invalid_argument);
+    EXPECT_THROW(decompress({0x1F, 'a', 1, 0, 255, 0, 0x00}), std::invalid_argument);
+
+    // Random damages never make it read or write out of bounds.
+    const auto text = makeTextLikeBytes(5000, 3);
+    std::vector<byte> compressed(getCompressedBlockBound(text.size()));
+    compressed.resize(
+        compressBlock(text.data(), text.size(), compressed.data(), compressed.size()));
+    std::mt19937 generator(4);
+    std::vector<byte> decompressed(text.size());
+    for (int i = 0; i < 2000; i++) {
+        auto damaged = compressed;
+        damaged[generator() % damaged.size()] = static_cast<byte>(generator());
+        damaged.resize(damaged.size() - generator() % 3);
+        try {
+            decompressBlock(damaged.data(), damaged.size(), decompressed.data(), text.size());
+        } catch (const std::invalid_argument&) {
+        }
+    }
+}
+
+TEST(Compression, it_compresses_and_decompresses_frames) {
+    for (const std::size_t size : {0, 1, 1000, 1024, 300000}) {
+        const auto text = makeTextLikeBytes(size, 5);
+        const auto compressed = compress(*toBuffer(text), 1024);
+        EXPECT_EQ(toVector(*decompress(*compressed)), text) << size;
+    }
+
+    // Incompressible blocks are stored as is.
+    const auto random = makeRandomBytes(100000, 6);
+    const auto compressed = compress(*toBuffer(random));
+    EXPECT_LE(compressed->getSize(), random.size() + 32);
+    EXPECT_EQ(toVector(*decompress(*compressed)), random);
+
+    EXPECT_THROW(FrameCompressor(1000), std::invalid_argument);
+    EXPECT_THROW(FrameCompressor(512), std::invalid_argument);
+    EXPECT_THROW(FrameCompressor(MAX_COMPRESSION_BLOCK_SIZE * 2), std::invalid_argument);
+}
+
+TEST(Compression, it_streams_frames_by_chunks) {
+    const auto text = makeTextLikeBytes(100000, 7);
+    const auto expected = toVector(*compress(*toBuffer(text), 4096));
+
+    // Chunks of any size give the same frame.
+    FrameCompressor compressor(4096, text.size());
+    std::mt19937 generator(8);
+    for (std::size_t index = 0; index < text.size();) {
+        const std::size_t size = std::min<std::size_t>(generator() % 10000, text.size() - index);
+        compressor.update(text.data() + index, size);
+        index += size;
+    }
+    compressor.finish();
+    EXPECT_EQ(toVector(*compressor.getOutput().flatten()), expected);
+    EXPECT_THROW(compressor.update(text.data(), 1), std::logic_error);
+    EXPECT_THROW(compressor.finish(), std::logic_error);
+
+    // Byte by byte, with the content size unknown.
+    FrameDecompressor decompressor;
+    FrameCompressor unknownSizeCompressor(4096);
+    unknownSizeCompressor.update(text.data(), text.size());
+    unknownSizeCompressor.finish();
+    const auto frame = toVector(*unknownSizeCompressor.getOutput().flatten());
+    for (std::size_t i = 0; i < frame.size(); i++) {
+        EXPECT_FALSE(decompressor.isFinished());
+        decompressor.update(frame.data() + i, 1);
+    }
+    EXPECT_TRUE(decompressor.isFinished());
+    EXPECT_EQ(decompressor.getContentSize(), UNKNOWN_CONTENT_SIZE);
+    EXPECT_EQ(toVector(*decompressor.getOutput().flatten()), text);
+
+    FrameCompressor wrongSizeCompressor(4096, 10);
+    wrongSizeCompressor.update(text.data(), 9);
+    EXPECT_THROW(wrongSizeCompressor.finish(), std::logic_error);
+}
+
+TEST(Compression, it_rejects_corrupted_frames) {
+    const auto text = makeTextLikeBytes(10000, 9);
+    const auto frame = toVector(*compress(*toBuffer(text), 1024));
+    const auto decompressVector = [](const std::vector<byte>& data) {
+        return decompress(*toBuffer(data));
+    };
+
+    // Bad magic, flags and block size.
+    for (const std::size_t index : {0, 4, 5}) {
+        auto damaged = frame;
+        damaged[index] ^= 0x40;
+        EXPECT_THROW(decompressVector(damaged), std::invalid_argument) << index;
+    }
+
+    // A damaged checksum, or a damaged byte of a stored block.
+    auto damaged = frame;
+    damaged.back() ^= 0x01;
+    EXPECT_THROW(decompressVector(damaged), std::invalid_argument);
+    damaged = toVector(*compress(*toBuffer(makeRandomBytes(2000, 10)), 1024));
+    damaged[100] ^= 0x01;
+    EXPECT_THROW(decompressVector(damaged), std::invalid_argument);
+
+    // Any damage is either detected, or harmless (e.g. another offset to the same bytes).
+    for (std::size_t index = 14; index < frame.size(); index += 7) {
+        damaged = frame;
+        damaged[index] ^= 0x01;
+        try {
+            EXPECT_EQ(toVector(*decompressVector(damaged)), text) << index;
+        } catch (const std::invalid_argument&) {
+        }
+    }
+
+    auto truncated = frame;
+    truncated.pop_back();
+    EXPECT_THROW(decompressVector(truncated), std::invalid_argument);
+
+    FrameDecompressor decompressor;
+    decompressor.update(frame.data(), frame.size());
+    EXPECT_EQ(decompressor.getContentSize(), text.size());
+    EXPECT_THROW(decompressor.update(frame.data(), 1), std::invalid_argument);
+}
@@ -0,0 +1,120 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <thread>
+
+#include "Bytes_tests_commons.hpp"
+#include "MF/CowBuffer.hpp"
+
+using namespace MF::Bytes;
+
+static CowBuffer makeCowBuffer(const std::string& content) {
+    return CowBuffer(makeBufferFromString(content));
+}
+
+TEST(CowBuffer, it_shares_the_bytes_for_reads) {
+    const std::size_t copiesBefore = CowBuffer::getCopiesCount();
+    const CowBuffer original = makeCowBuffer("Hello");
+    EXPECT_FALSE(original.isShared());
+
+    std::vector<CowBuffer> consumers(10, original);
+    for (const auto& consumer : consumers) {
+        EXPECT_EQ(consumer.get(), original.get());
+        EXPECT_EQ(consumer.getAt<char>(1), 'e');
+        EXPECT_EQ(toString(consumer), "Hello");
+    }
+    EXPECT_TRUE(original.isShared());
+    EXPECT_EQ(CowBuffer::getCopiesCount(), copiesBefore);
+    EXPECT_THROW(original.getAt<char>(5), std::out_of_range);
+    EXPECT_THROW(CowBuffer(nullptr), std::invalid_argument);
+}
+
+TEST(CowBuffer, it_clones_on_the_first_write_when_shared) {
+    const std::size_t copiesBefore = CowBuffer::getCopiesCount();
+    const CowBuffer original = makeCowBuffer("Hello");
+    CowBuffer writer = original;
+
+    writer.getWritableAt<char>(0) = 'J';
+    EXPECT_EQ(CowBuffer::getCopiesCount(), copiesBefore + 1);
+    EXPECT_EQ(toString(writer), "Jello");
+    EXPECT_EQ(toString(original), "Hello");
+    EXPECT_FALSE(writer.isShared());
+    EXPECT_FALSE(original.isShared());
+
+    // The next writes are in place.
+    const byte* const data = writer.get();
+    writer.getWritableSpan()[4] = 'y';
+    EXPECT_EQ(writer.get(), data);
+    EXPECT_EQ(toString(writer), "Jelly");
+    EXPECT_EQ(CowBuffer::getCopiesCount(), copiesBefore + 1);
+}
+
+TEST(CowBuffer, it_does_not_clone_unique_bytes) {
+    const std::size_t copiesBefore = CowBuffer::getCopiesCount();
+    CowBuffer buffer = makeCowBuffer("abc");
+    {
+        const CowBuffer released = buffer;
+    }
+    CowBuffer moved = std::move(buffer);
+    moved.getWritableAt<char>(2) = 'd';
+    EXPECT_EQ(toString(moved), "abd");
+    EXPECT_EQ(CowBuffer::getCopiesCount(), copiesBefore);
+}
+
+TEST(CowBuffer, it_protects_the_other_owners) {
+    CowBuffer buffer = makeCowBuffer("key=value");
+
+    // A slice or a shared_ptr given away keeps the bytes shared.
+    const auto slice = buffer.getShared()->slice(4, 5);
+    buffer.getWritableAt<char>(4) = 'V';
+    EXPECT_EQ(std::string(slice->cbegin(), slice->cend()), "value");
+    EXPECT_EQ(toString(buffer), "key=Value");
+}
+
+TEST(CowBuffer, it_clones_the_bytes_it_does_not_own) {
+    const std::size_t copiesBefore = CowBuffer::getCopiesCount();
+    const CowBuffer parent = makeCowBuffer("key=value");
+
+    // Only owner of the slice, but not of its bytes, which the parent still reads.
+    CowBuffer slice(parent.getShared()->slice(4, 5));
+    EXPECT_FALSE(slice.isShared());
+    slice.getWritableAt<char>(0) = 'V';
+    EXPECT_EQ(toString(slice), "Value");
+    EXPECT_EQ(toString(parent), "key=value");
+    EXPECT_EQ(CowBuffer::getCopiesCount(), copiesBefore + 1);
+
+    // Memory owned by someone else.
+    char raw[] = "raw";
+    CowBuffer external(makeBuffer(raw, 3));
+    external.getWritableAt<char>(0) = 'w';
+    EXPECT_EQ(toString(external), "waw");
+    EXPECT_EQ(std::string(raw), "raw");
+
+    // Once cloned, the bytes are owned and written in place.
+    const byte* const data = slice.get();
+    slice.getWritableAt<char>(4) = 'E';
+    EXPECT_EQ(slice.get(), data);
+    EXPECT_EQ(CowBuffer::getCopiesCount(), copiesBefore + 2);
+}
+
+TEST(CowBuffer, it_lets_threads_write_their_own_copy) {
+    const CowBuffer original = makeCowBuffer(std::string(1000, 'a'));
+    std::vector<std::thread> threads;
+    std::vector<std::string> results(4);
+    for (std::size_t i = 0; i < results.size(); i++) {
+        threads.emplace_back([copy = original, i, &results]() mutable {
+            const BufferSpan span = copy.getWritableSpan();
+            std::fill(span.begin(), span.end(), static_cast<byte>('b' + i));
+            results[i] = toString(copy);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(toString(original), std::string(1000, 'a'));
+    for (std::size_t i = 0; i < results.size(); i++) {
+        EXPECT_EQ(results[i], std::string(1000, static_cast<char>('b' + i)));
+    }
+}
@@ -0,0 +1,176 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+#include "MF/IntegerCodecs.hpp"
+#include "tests_data.hpp"
+
+using namespace MF::Bytes;
+
+template <typename UInt>
+static std::vector<UInt> makeRandomValues(std::size_t count, unsigned int bitWidth, unsigned seed) {
+    std::mt19937_64 generator(seed);
+    std::vector<UInt> result(count);
+    for (auto& value : result) {
+        const std::uint64_t random = generator();
+        value = static_cast<UInt>((bitWidth >= 64) ? random : random & ((1ULL << bitWidth) - 1));
+    }
+    return result;
+}
+
+static std::shared_ptr<Buffer> toBuffer(const std::vector<std::uint32_t>& values) {
+    auto result = makeBufferWithSize(values.size() * sizeof(std::uint32_t));
+    if (!values.empty()) {
+        std::memcpy(result->get(), values.data(), result->getSize());
+    }
+    return result;
+}
+
+static std::vector<std::uint32_t> toValues(const Buffer& buffer) {
+    std::vector<std::uint32_t> result(buffer.getSize() / sizeof(std::uint32_t));
+    if (!result.empty()) {
+        std::memcpy(result.data(), buffer.get(), buffer.getSize());
+    }
+    return result;
+}
+
+TEST(IntegerCodecs, it_packs_and_unpacks_32_bits_values) {
+    for (unsigned int bitWidth = 0; bitWidth <= 32; bitWidth++) {
+        // Enough values for the SIMD groups, plus a tail.
+        for (const std::size_t count : {0, 1, 7, 8, 100, 1003}) {
+            const auto values = makeRandomValues<std::uint32_t>(count, bitWidth, bitWidth);
+            ASSERT_LE(getRequiredBitWidth(values.data(), count), bitWidth);
+
+            std::vector<byte> packed(getBitPackedSize(count, bitWidth));
+            ASSERT_EQ(bitPack(values.data(), count, bitWidth, packed.data()), packed.size());
+            std::vector<std::uint32_t> unpacked(count);
+            ASSERT_EQ(
+                bitUnpack(packed.data(), packed.size(), count, bitWidth, unpacked.data()),
+                packed.size());
+            ASSERT_EQ(unpacked, values) << bitWidth << " " << count;
+        }
+    }
+}
+
+TEST(IntegerCodecs, it_packs_and_unpacks_64_bits_values) {
+    for (unsigned int bitWidth = 0; bitWidth <= 64; bitWidth++) {
+        for (const std::size_t count : {0, 1, 9, 100}) {
+            const auto values = makeRandomValues<std::uint64_t>(count, bitWidth, bitWidth);
+            std::vector<byte> packed(getBitPackedSize(count, bitWidth));
+            bitPack(values.data(), count, bitWidth, packed.data());
+            std::vector<std::uint64_t> unpacked(count);
+            bitUnpack(packed.data(), packed.size(), count, bitWidth, unpacked.data());
+            ASSERT_EQ(unpacked, values) << bitWidth << " " << count;
+        }
+    }
+}
+
+TEST(IntegerCodecs, it_uses_a_stable_bit_layout) {
+    // 3 bits values, lowest bits first: 0b101, 0b011, 0b111 -> 0b111'011'101.
+    const std::uint32_t values[] = {5, 3, 7};
+    byte packed[2] = {};
+    bitPack(values, 3, 3, packed);
+    EXPECT_EQ(packed[0], 0xDD);
+    EXPECT_EQ(packed[1], 0x01);
+
+    EXPECT_EQ(getRequiredBitWidth(values, 3), 3);
+    EXPECT_THROW(bitPack(values, 3, 2, packed), std::invalid_argument);
+    EXPECT_THROW(bitPack(values, 3, 33, packed), std::invalid_argument);
+    std::uint32_t unpacked[3];
+    EXPECT_THROW(bitUnpack(packed, 1, 3, 3, unpacked), std::invalid_argument);
+}
+
+TEST(IntegerCodecs, it_encodes_and_decodes_delta_zigzag) {
+    const std::vector<std::uint32_t> values = {10, 12, 11, 11, 0, 0xFFFFFFFF, 5};
+    std::vector<std::uint32_t> encoded(values.size());
+    encodeDeltaZigZag(values.data(), values.size(), encoded.data());
+    // +10, +2, -1, 0, -11, -1 (wrapped), +6.
+    EXPECT_EQ(encoded, (std::vector<std::uint32_t>{20, 4, 1, 0, 21, 1, 12}));
+
+    for (const std::size_t count : {0, 3, 4, 1001}) {
+        auto sorted = makeRandomValues<std::uint32_t>(count, 32, 1);
+        std::sort(sorted.begin(), sorted.end());
+        auto buffer = toBuffer(sorted);
+        encodeDeltaZigZag(*buffer);
+        decodeDeltaZigZag(*buffer);
+        ASSERT_EQ(toValues(*buffer), sorted) << count;
+    }
+
+    auto values64 = makeRandomValues<std::uint64_t>(100, 64, 2);
+    const auto original64 = values64;
+    encodeDeltaZigZag(values64.data(), values64.size(), values64.data());
+    decodeDeltaZigZag(values64.data(), values64.size(), values64.data());
+    EXPECT_EQ(values64, original64);
+
+    auto oddSize = makeBufferWithSize(6);
+    EXPECT_THROW(encodeDeltaZigZag(*oddSize), std::invalid_argument);
+}
+
+TEST(IntegerCodecs, it_encodes_and_decodes_streamvbyte) {
+    // 1, 2, 3 and 4 bytes values.
+    const std::vector<std::uint32_t> values = {0x7F, 0x1234, 0x123456, 0x12345678, 0};
+    std::vector<byte> encoded(getStreamVByteMaxEncodedSize(values.size()));
+    ASSERT_EQ(streamVByteEncode(values.data(), values.size(), encoded.data()), 2 + 11);
+    EXPECT_EQ(encoded[0], 0xE4);
+    EXPECT_EQ(encoded[1], 0x00);
+    EXPECT_EQ(encoded[2], 0x7F);
+    EXPECT_EQ(encoded[3], 0x34);
+    EXPECT_EQ(encoded[4], 0x12);
+
+    for (unsigned int bitWidth = 0; bitWidth <= 32; bitWidth += 4) {
+        for (const std::size_t count : {0, 1, 5, 64, 1001}) {
+            const auto random = makeRandomValues<std::uint32_t>(count, bitWidth, bitWidth);
+            const auto buffer = streamVByteEncode(*toBuffer(random));
+            std::vector<byte> expected(getStreamVByteMaxEncodedSize(count));
+            expected.resize(streamVByteEncode(random.data(), count, expected.data()));
+            ASSERT_EQ(buffer->getSize(), expected.size());
+            ASSERT_TRUE(std::equal(buffer->begin(), buffer->end(), expected.begin()));
+            ASSERT_EQ(toValues(*streamVByteDecode(*buffer, count)), random)
+                << bitWidth << " " << count;
+        }
+    }
+
+    // Truncated data, at every length.
+    const auto random = makeRandomValues<std::uint32_t>(100, 32, 3);
+    const auto buffer = streamVByteEncode(*toBuffer(random));
+    std::vector<std::uint32_t> decoded(random.size());
+    for (std::size_t size = 0; size < buffer->getSize(); size++) {
+        EXPECT_THROW(
+            streamVByteDecode(buffer->get(), size, random.size(), decoded.data()),
+            std::invalid_argument);
+    }
+    EXPECT_EQ(
+        streamVByteDecode(buffer->get(), buffer->getSize(), random.size(), decoded.data()),
+        buffer->getSize());
+}
+
+TEST(IntegerCodecs, it_shrinks_small_integers_in_buffers) {
+    // Sorted IDs: delta + zigzag, then bit packing or StreamVByte.
+    std::vector<std::uint32_t> ids(10000);
+    std::mt19937 generator(4);
+    std::uint32_t id = 0;
+    for (auto& value : ids) {
+        id += generator() % 64;
+        value = id;
+    }
+
+    const auto deltas = toBuffer(ids);
+    encodeDeltaZigZag(*deltas);
+    const unsigned int bitWidth =
+        getRequiredBitWidth(deltas->getWithCast<std::uint32_t>(), ids.size());
+    const auto packed = bitPack(*deltas, bitWidth);
+    const auto streamed = streamVByteEncode(*deltas);
+    EXPECT_LT(packed->getSize() * 4, deltas->getSize());
+    EXPECT_LT(streamed->getSize() * 3, deltas->getSize());
+
+    const auto unpacked = bitUnpack(*packed, ids.size(), bitWidth);
+    decodeDeltaZigZag(*unpacked);
+    EXPECT_EQ(toValues(*unpacked), ids);
+    const auto decoded = streamVByteDecode(*streamed, ids.size());
+    decodeDeltaZigZag(*decoded);
+    EXPECT_EQ(toValues(*decoded), ids);
+}
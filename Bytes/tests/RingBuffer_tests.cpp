@@ -0,0 +1,104 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include "MF/RingBuffer.hpp"
+#include "tests_data.hpp"
+
+#if MF_UNIX
+#    include <cstring>
+#    include <thread>
+
+#    include <unistd.h>
+
+using namespace MF::Bytes;
+
+TEST(RingBuffer, it_rounds_the_capacity_to_pages) {
+    const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    EXPECT_EQ(RingBuffer(1).getCapacity(), pageSize);
+    EXPECT_EQ(RingBuffer(pageSize + 1).getCapacity(), 2 * pageSize);
+    EXPECT_EQ(RingBuffer(3 * pageSize).getCapacity(), 4 * pageSize);
+}
+
+TEST(RingBuffer, it_gives_contiguous_spans_across_the_end) {
+    RingBuffer ring(1);
+    const std::size_t capacity = ring.getCapacity();
+
+    // Moves both indices close to the end of the memory.
+    ring.commit(capacity - 3);
+    ring.getReadableSpan();
+    ring.consume(capacity - 3);
+
+    // Only 3 bytes are known to be free until the consumer index is reloaded.
+    EXPECT_EQ(ring.getWritableSpan().size(), 3);
+    const BufferSpan writable = ring.getWritableSpan(capacity);
+    ASSERT_EQ(writable.size(), capacity);
+    std::memcpy(writable.data(), "Hello, World", 12);
+    ring.commit(12);
+
+    const BufferSpan readable = ring.getReadableSpan();
+    ASSERT_EQ(readable.size(), 12);
+    EXPECT_EQ(std::string(readable.begin(), readable.end()), "Hello, World");
+    ring.consume(5);
+
+    char output[16] = {};
+    EXPECT_EQ(ring.tryRead(output, sizeof(output)), 7);
+    EXPECT_STREQ(output, ", World");
+    EXPECT_EQ(ring.getReadableSpan().size(), 0);
+}
+
+TEST(RingBuffer, it_checks_the_sizes) {
+    RingBuffer ring(1);
+    const std::size_t capacity = ring.getCapacity();
+
+    EXPECT_THROW(ring.commit(capacity + 1), std::out_of_range);
+    EXPECT_THROW(ring.consume(1), std::out_of_range);
+
+    const std::vector<byte> data(capacity, 1);
+    EXPECT_FALSE(ring.tryWrite(data.data(), capacity + 1));
+    EXPECT_TRUE(ring.tryWrite(data.data(), capacity - 1));
+    EXPECT_FALSE(ring.tryWrite(data.data(), 2));
+    EXPECT_TRUE(ring.tryWrite(data.data(), 1));
+    EXPECT_EQ(ring.getWritableSpan().size(), 0);
+    EXPECT_THROW(ring.commit(1), std::out_of_range);
+
+    ring.getReadableSpan();
+    ring.consume(10);
+    EXPECT_EQ(ring.getWritableSpan().size(), 10);
+}
+
+TEST(RingBuffer, it_streams_bytes_between_two_threads) {
+    RingBuffer ring(1);
+    const std::size_t total = 8 * ring.getCapacity() + 123;
+
+    std::thread producer([&ring, total]() {
+        std::size_t written = 0;
+        std::size_t batch = 1;
+        while (written < total) {
+            const BufferSpan span = ring.getWritableSpan();
+            const std::size_t size = std::min({span.size(), total - written, batch});
+            for (std::size_t i = 0; i < size; i++) {
+                span[i] = static_cast<byte>((written + i) % 251);
+            }
+            ring.commit(size);
+            written += size;
+            batch = batch % 1000 + 7;
+        }
+    });
+
+    std::size_t read = 0;
+    bool valid = true;
+    while (read < total) {
+        const BufferSpan span = ring.getReadableSpan();
+        for (std::size_t i = 0; i < span.size(); i++) {
+            valid = valid && span[i] == static_cast<byte>((read + i) % 251);
+        }
+        ring.consume(span.size());
+        read += span.size();
+    }
+    producer.join();
+
+    EXPECT_TRUE(valid);
+    EXPECT_EQ(read, total);
+}
+#endif
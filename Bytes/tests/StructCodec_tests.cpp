@@ -0,0 +1,113 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include "MF/StructCodec.hpp"
+#include "tests_data.hpp"
+
+using namespace MF::Bytes;
+
+enum class RecordKind : std::uint16_t { FIRST = 1, SECOND = 0x0203 };
+
+struct Header {
+    std::uint32_t magic;
+    char name[4];
+    std::int16_t version;
+    RecordKind kind;
+    std::uint64_t length;
+    double ratio;
+};
+
+using HeaderCodec = StructCodec<
+    Header,
+    MF_BYTES_FIELD(Header, magic, Endianness::BIG_ENDIAN),
+    MF_BYTES_FIELD(Header, name, Endianness::BIG_ENDIAN),
+    MF_BYTES_FIELD(Header, version, Endianness::LITTLE_ENDIAN),
+    MF_BYTES_FIELD(Header, kind, Endianness::BIG_ENDIAN),
+    StructPadding<3>,
+    MF_BYTES_FIELD(Header, length, Endianness::LITTLE_ENDIAN),
+    MF_BYTES_FIELD(Header, ratio, Endianness::BIG_ENDIAN)>;
+
+static_assert(HeaderCodec::packedSize == 31, "Unexpected packed size.");
+static_assert(HeaderCodec::offsetOf<0>() == 0, "Unexpected offset of 'magic'.");
+static_assert(HeaderCodec::offsetOf<2>() == 8, "Unexpected offset of 'version'.");
+static_assert(HeaderCodec::offsetOf<5>() == 15, "Unexpected offset of 'length'.");
+static_assert(HeaderCodec::offsetOf<6>() == 23, "Unexpected offset of 'ratio'.");
+
+static const byte ENCODED_HEADER[HeaderCodec::packedSize] = {
+    // magic
+    0xCA, 0xFE, 0xBA, 0xBE,
+    // name
+    'M', 'F', 'S', 'C',
+    // version
+    0xFE, 0xFF,
+    // kind
+    0x02, 0x03,
+    // padding
+    0x00, 0x00, 0x00,
+    // length
+    0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01,
+    // ratio = 1.5
+    0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+static void expectDecodedHeader(const Header& header) {
+    EXPECT_EQ(header.magic, 0xCAFEBABEU);
+    EXPECT_EQ(std::string(header.name, 4), "MFSC");
+    EXPECT_EQ(header.version, -2);
+    EXPECT_EQ(header.kind, RecordKind::SECOND);
+    EXPECT_EQ(header.length, 0x0102030405060708ULL);
+    EXPECT_EQ(header.ratio, 1.5);
+}
+
+TEST(StructCodec, it_decodes) {
+    expectDecodedHeader(HeaderCodec::decode(ENCODED_HEADER));
+}
+
+TEST(StructCodec, it_encodes_back_to_the_same_bytes) {
+    const Header header = HeaderCodec::decode(ENCODED_HEADER);
+
+    byte encoded[HeaderCodec::packedSize];
+    std::memset(encoded, 0xAA, sizeof(encoded));
+    HeaderCodec::encode(header, encoded);
+
+    EXPECT_EQ(std::memcmp(encoded, ENCODED_HEADER, sizeof(encoded)), 0);
+}
+
+TEST(StructCodec, it_works_on_buffers_with_bounds_checks) {
+    auto buffer = makeBufferWithSize(HeaderCodec::packedSize + 1);
+    std::memcpy(buffer->getWithCast<byte>() + 1, ENCODED_HEADER, HeaderCodec::packedSize);
+
+    expectDecodedHeader(HeaderCodec::decode(*buffer, 1));
+    EXPECT_THROW(HeaderCodec::decode(*buffer, 2), std::out_of_range);
+    EXPECT_THROW(HeaderCodec::decode(*buffer, (std::size_t)-1), std::out_of_range);
+
+    const Header header = HeaderCodec::decode(*buffer, 1);
+    EXPECT_NO_THROW(HeaderCodec::encode(header, *buffer, 0));
+    EXPECT_EQ(std::memcmp(buffer->get(), ENCODED_HEADER, HeaderCodec::packedSize), 0);
+    EXPECT_THROW(HeaderCodec::encode(header, *buffer, 2), std::out_of_range);
+}
+
+TEST(StructCodec, it_decodes_and_encodes_arrays_of_records) {
+    const std::size_t count = 5;
+    auto buffer = makeBufferWithSize(count * HeaderCodec::packedSize);
+    for (std::size_t i = 0; i < count; i++) {
+        std::memcpy(
+            buffer->getWithCast<byte>() + i * HeaderCodec::packedSize, ENCODED_HEADER,
+            HeaderCodec::packedSize);
+    }
+
+    std::vector<Header> headers(count);
+    HeaderCodec::decodeArray(*buffer, 0, headers.data(), count);
+    for (const Header& header : headers) {
+        expectDecodedHeader(header);
+    }
+    EXPECT_THROW(
+        HeaderCodec::decodeArray(*buffer, 1, headers.data(), count), std::out_of_range);
+    EXPECT_THROW(
+        HeaderCodec::decodeArray(*buffer, 0, headers.data(), (std::size_t)-1),
+        std::out_of_range);
+
+    auto reencoded = makeBufferWithSize(count * HeaderCodec::packedSize);
+    HeaderCodec::encodeArray(headers.data(), count, *reencoded, 0);
+    EXPECT_TRUE(std::equal(buffer->cbegin(), buffer->cend(), reencoded->cbegin()));
+}
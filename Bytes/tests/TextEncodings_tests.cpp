@@ -0,0 +1,143 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <random>
+
+#include "Bytes_tests_commons.hpp"
+#include "MF/TextEncodings.hpp"
+
+using namespace MF::Bytes;
+
+static std::shared_ptr<Buffer> makeRandomBuffer(std::size_t size) {
+    std::mt19937 generator(42);
+    auto buffer = makeBufferWithSize(size);
+    for (auto& value : *buffer) {
+        value = static_cast<byte>(generator());
+    }
+    return buffer;
+}
+
+TEST(Base64, it_encodes_the_rfc_4648_vectors) {
+    const std::vector<std::pair<std::string, std::string>> vectors = {
+        {"", ""},
+        {"f", "Zg=="},
+        {"fo", "Zm8="},
+        {"foo", "Zm9v"},
+        {"foob", "Zm9vYg=="},
+        {"fooba", "Zm9vYmE="},
+        {"foobar", "Zm9vYmFy"}};
+
+    for (const auto& vector : vectors) {
+        EXPECT_EQ(base64Encode(*makeBufferFromString(vector.first)), vector.second);
+        EXPECT_EQ(toString(*base64Decode(vector.second)), vector.first);
+    }
+}
+
+TEST(Base64, it_uses_the_url_safe_alphabet_without_padding) {
+    const std::string bytes = "\xFB\xFF\xBF\x01";
+    EXPECT_EQ(base64Encode(*makeBufferFromString(bytes)), "+/+/AQ==");
+    EXPECT_EQ(base64Encode(*makeBufferFromString(bytes), Base64Alphabet::URL_SAFE), "-_-_AQ");
+    EXPECT_EQ(getBase64EncodedSize(4, Base64Alphabet::URL_SAFE), 6);
+
+    EXPECT_EQ(toString(*base64Decode("-_-_AQ", Base64Alphabet::URL_SAFE)), bytes);
+    EXPECT_EQ(toString(*base64Decode("-_-_AQ==", Base64Alphabet::URL_SAFE)), bytes);
+    EXPECT_EQ(toString(*base64Decode("+/+/AQ")), bytes);
+    EXPECT_THROW(base64Decode("+/+/AQ==", Base64Alphabet::URL_SAFE), std::invalid_argument);
+}
+
+TEST(Base64, it_round_trips_long_inputs_of_all_lengths) {
+    const auto input = makeRandomBuffer(300);
+
+    for (const auto alphabet : {Base64Alphabet::STANDARD, Base64Alphabet::URL_SAFE}) {
+        for (std::size_t size = 0; size <= input->getSize(); size++) {
+            std::string encoded(getBase64EncodedSize(size, alphabet), '\0');
+            ASSERT_EQ(base64Encode(input->get(), size, &encoded[0], alphabet), encoded.size());
+
+            std::vector<byte> decoded(getBase64DecodedSize(encoded.data(), encoded.size()));
+            ASSERT_EQ(decoded.size(), size);
+            ASSERT_EQ(base64Decode(encoded.data(), encoded.size(), decoded.data(), alphabet), size);
+            ASSERT_TRUE(std::equal(decoded.begin(), decoded.end(), input->cbegin())) << size;
+        }
+    }
+}
+
+TEST(Base64, it_gives_the_same_result_with_and_without_simd) {
+    // Groups of 3 bytes are encoded independently, and small inputs do not use SIMD.
+    const auto input = makeRandomBuffer(3 * 100);
+    const std::string whole = base64Encode(*input);
+
+    std::string byGroups;
+    char group[4];
+    for (std::size_t i = 0; i < input->getSize(); i += 3) {
+        base64Encode(input->cbegin() + i, 3, group);
+        byGroups.append(group, sizeof(group));
+    }
+    EXPECT_EQ(whole, byGroups);
+}
+
+TEST(Base64, it_rejects_invalid_inputs) {
+    // Lengths and paddings.
+    EXPECT_THROW(base64Decode("Zm9vY"), std::invalid_argument);
+    EXPECT_THROW(base64Decode("Zg="), std::invalid_argument);
+    EXPECT_THROW(base64Decode("Z==="), std::invalid_argument);
+    EXPECT_THROW(base64Decode("Zg==Zg=="), std::invalid_argument);
+    // Non-zero unused bits.
+    EXPECT_THROW(base64Decode("Zh=="), std::invalid_argument);
+
+    // An invalid char anywhere in a long input, so that each kernel sees it.
+    const std::string valid = base64Encode(*makeRandomBuffer(300));
+    for (std::size_t i = 0; i < valid.size(); i += 7) {
+        std::string invalid = valid;
+        invalid[i] = (i % 2 == 0) ? '*' : '\n';
+        try {
+            base64Decode(invalid);
+            FAIL() << "No exception for an invalid char at index " << i;
+        } catch (const std::invalid_argument& e) {
+            EXPECT_THAT(e.what(), ::testing::HasSubstr("at index " + std::to_string(i)));
+        }
+    }
+}
+
+TEST(Hex, it_encodes_in_lower_case_and_decodes_both_cases) {
+    EXPECT_EQ(hexEncode(*makeBufferFromString("\x01\xAB\xFF")), "01abff");
+    EXPECT_EQ(toString(*hexDecode("01abff")), "\x01\xAB\xFF");
+    EXPECT_EQ(toString(*hexDecode("01ABFF")), "\x01\xAB\xFF");
+    EXPECT_EQ(hexEncode(*makeBufferWithSize(0)), "");
+}
+
+TEST(Hex, it_round_trips_long_inputs_of_all_lengths) {
+    const auto input = makeRandomBuffer(200);
+
+    for (std::size_t size = 0; size <= input->getSize(); size++) {
+        std::string encoded(getHexEncodedSize(size), '\0');
+        ASSERT_EQ(hexEncode(input->get(), size, &encoded[0]), encoded.size());
+        for (std::size_t i = 0; i < size; i++) {
+            const byte value = input->getAt<byte>(i);
+            ASSERT_EQ(encoded[2 * i], "0123456789abcdef"[value >> 4]);
+            ASSERT_EQ(encoded[2 * i + 1], "0123456789abcdef"[value & 0x0F]);
+        }
+
+        std::vector<byte> decoded(getHexDecodedSize(encoded.size()));
+        ASSERT_EQ(hexDecode(encoded.data(), encoded.size(), decoded.data()), size);
+        ASSERT_TRUE(std::equal(decoded.begin(), decoded.end(), input->cbegin())) << size;
+    }
+}
+
+TEST(Hex, it_rejects_invalid_inputs) {
+    EXPECT_THROW(hexDecode("abc"), std::invalid_argument);
+
+    const std::string valid = hexEncode(*makeRandomBuffer(100));
+    for (std::size_t i = 0; i < valid.size(); i += 5) {
+        for (const char invalidChar : {'g', 'G', '/', ':', '@', '`', '\0'}) {
+            std::string invalid = valid;
+            invalid[i] = invalidChar;
+            try {
+                hexDecode(invalid);
+                FAIL() << "No exception for an invalid char at index " << i;
+            } catch (const std::invalid_argument& e) {
+                EXPECT_THAT(e.what(), ::testing::HasSubstr("at index " + std::to_string(i)));
+            }
+        }
+    }
+}
@@ -0,0 +1,91 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_BENCHMARKS_DATA_HPP
+#define MFRANCESCHI_CPPLIBRARIES_BENCHMARKS_DATA_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Defines a group of benchmarks, run by the "main" of MF_Commons_Benchmarks.
+ * Usage: @code MF_BENCHMARK_GROUP(BufferPool) { measure(...); measure(...); }
+ */
+#define MF_BENCHMARK_GROUP(groupName)                                                     \
+    static void groupName##_benchmarkGroup();                                             \
+    static const ::MF::Benchmarks::GroupRegistrar groupName##_benchmarkGroupRegistrar(    \
+        #groupName, groupName##_benchmarkGroup);                                          \
+    static void groupName##_benchmarkGroup()
+
+namespace MF
+{
+    namespace Benchmarks
+    {
+        using BenchmarkGroup_t = void (*)();
+
+        inline std::vector<std::pair<std::string, BenchmarkGroup_t>> &getBenchmarkGroups() {
+            static std::vector<std::pair<std::string, BenchmarkGroup_t>> groups;
+            return groups;
+        }
+
+        struct GroupRegistrar {
+            GroupRegistrar(const char *name, BenchmarkGroup_t group) {
+                getBenchmarkGroups().emplace_back(name, group);
+            }
+        };
+
+        /// Prevents the compiler from optimizing away the computation of "value".
+        template <typename T>
+        inline void doNotOptimize(const T &value) {
+#if defined(__GNUC__)
+            __asm__ __volatile__("" : : "g"(&value) : "memory");
+#else
+            static const volatile void *sink;
+            sink = &value;
+#endif
+        }
+
+        /**
+         * Runs "function" "iterations" times and prints the time taken by one iteration.
+         * When "bytesPerIteration" is not 0, it also prints the throughput.
+         * @return The number of nanoseconds taken by one iteration.
+         */
+        template <typename Function>
+        double measure(
+            const std::string &name,
+            std::size_t iterations,
+            Function &&function,
+            std::size_t bytesPerIteration = 0) {
+            // Warm-up, also useful for the lazy initializations.
+            function();
+
+            const auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < iterations; i++) {
+                function();
+            }
+            const auto end = std::chrono::steady_clock::now();
+
+            const double totalNs = static_cast<double>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            const double nsPerIteration = totalNs / static_cast<double>(iterations);
+
+            if (bytesPerIteration == 0) {
+                std::printf("%-48s %12.2f ns/op\n", name.c_str(), nsPerIteration);
+            } else {
+                const double megabytesPerSecond =
+                    static_cast<double>(bytesPerIteration) / nsPerIteration * 1e9 / 1e6;
+                std::printf(
+                    "%-48s %12.2f ns/op %10.1f MB/s\n", name.c_str(), nsPerIteration,
+                    megabytesPerSecond);
+            }
+            return nsPerIteration;
+        }
+    } // namespace Benchmarks
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_BENCHMARKS_DATA_HPP
@@ -0,0 +1,19 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include "benchmarks_data.hpp"
+
+/// Runs all the benchmark groups, or only those which name contains the first argument.
+int main(int argc, char **argv) {
+    const std::string filter = (argc > 1) ? argv[1] : "";
+
+    for (const auto &group : MF::Benchmarks::getBenchmarkGroups()) {
+        if (group.first.find(filter) == std::string::npos) {
+            continue;
+        }
+        std::printf("----- %s -----\n", group.first.c_str());
+        group.second();
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include "MF/FlatHashMap.hpp"
+#include "benchmarks_data.hpp"
+
+using namespace MF::Containers;
+using MF::Benchmarks::doNotOptimize;
+using MF::Benchmarks::measure;
+
+/// Inserts "keys", then looks up the ones of "lookups", found or not.
+template <typename Map, typename Key>
+static void measureMap(
+    const std::string& name, const std::vector<Key>& keys, const std::vector<Key>& lookups) {
+    const std::size_t iterations = 20;
+    measure(name + ": insert", iterations, [&]() {
+        Map map{};
+        for (const Key& key : keys) {
+            map[key]++;
+        }
+        doNotOptimize(map.size());
+    });
+
+    Map map{};
+    for (const Key& key : keys) {
+        map[key]++;
+    }
+    measure(name + ": find", iterations, [&]() {
+        std::size_t found = 0;
+        for (const Key& key : lookups) {
+            found += map.find(key) != map.end() ? 1 : 0;
+        }
+        doNotOptimize(found);
+    });
+}
+
+MF_BENCHMARK_GROUP(FlatHashMap) {
+    const std::size_t count = 1024 * 1024;
+    std::mt19937 generator(1);
+
+    // 1000 dense small integers, the best case of std::unordered_map, whose identity hash then
+    // has no collision.
+    std::vector<int> denseKeys(count);
+    for (auto& key : denseKeys) {
+        key = static_cast<int>(generator() % 1000);
+    }
+    measureMap<std::unordered_map<int, int>>(
+        "dense keys, std::unordered_map", denseKeys, denseKeys);
+    measureMap<FlatHashMap<int, int>>("dense keys, FlatHashMap", denseKeys, denseKeys);
+
+    // 100k random IDs, half of the lookups are misses: the table does not fit in the L2 cache.
+    std::vector<int> ids(count / 8);
+    for (auto& id : ids) {
+        id = static_cast<int>(generator());
+    }
+    std::vector<int> idLookups(count);
+    for (auto& id : idLookups) {
+        id = generator() % 2 == 0 ? ids[generator() % ids.size()] : static_cast<int>(generator());
+    }
+    measureMap<std::unordered_map<int, int>>("IDs, std::unordered_map", ids, idLookups);
+    measureMap<FlatHashMap<int, int>>("IDs, FlatHashMap", ids, idLookups);
+
+    // Names of 10 to 30 characters.
+    std::vector<std::string> names(count / 8);
+    for (auto& name : names) {
+        name = std::string(10 + generator() % 20, 'a') + std::to_string(generator());
+    }
+    std::vector<std::string> nameLookups(count / 2);
+    for (auto& name : nameLookups) {
+        name = names[generator() % names.size()];
+    }
+    measureMap<std::unordered_map<std::string, int>>(
+        "names, std::unordered_map", names, nameLookups);
+    measureMap<FlatHashMap<std::string, int>>("names, FlatHashMap", names, nameLookups);
+
+    // Lookup of "const char*": std::unordered_map builds a std::string for each one.
+    FlatHashMap<std::string, int> flatNames{};
+    std::unordered_map<std::string, int> stdNames{};
+    for (const auto& name : names) {
+        flatNames[name]++;
+        stdNames[name]++;
+    }
+    std::vector<const char*> cNames{};
+    for (const auto& name : nameLookups) {
+        cNames.push_back(name.c_str());
+    }
+    measure("names, std::unordered_map: find const char*", 20, [&]() {
+        std::size_t found = 0;
+        for (const char* name : cNames) {
+            found += stdNames.find(name) != stdNames.end() ? 1 : 0;
+        }
+        doNotOptimize(found);
+    });
+    measure("names, FlatHashMap: find const char*", 20, [&]() {
+        std::size_t found = 0;
+        for (const char* name : cNames) {
+            found += flatNames.find(name) != flatNames.end() ? 1 : 0;
+        }
+        doNotOptimize(found);
+    });
+}
@@ -0,0 +1,66 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#include <string>
+#include <vector>
+
+#include "MF/SmallVector.hpp"
+#include "benchmarks_data.hpp"
+
+using namespace MF::Containers;
+using MF::Benchmarks::doNotOptimize;
+using MF::Benchmarks::measure;
+
+/// Splits the paths on '/', like the parsing of their components.
+template <typename Components>
+static void measureSplit(const std::string& name, const std::vector<std::string>& paths) {
+    measure(name, 20, [&]() {
+        std::size_t count = 0;
+        for (const std::string& path : paths) {
+            Components components{};
+            std::size_t begin = 0;
+            for (std::size_t end = path.find('/'); end != std::string::npos;
+                 end = path.find('/', begin)) {
+                components.emplace_back(path, begin, end - begin);
+                begin = end + 1;
+            }
+            components.emplace_back(path, begin, path.size() - begin);
+            count += components.size();
+        }
+        doNotOptimize(count);
+    });
+}
+
+/// Builds lists of "size" integers, and keeps them in a vector.
+template <typename List>
+static void measureLists(const std::string& name, std::size_t size) {
+    measure(name, 20, [size]() {
+        std::vector<List> lists{};
+        lists.reserve(100000);
+        for (std::size_t i = 0; i < 100000; i++) {
+            List list{};
+            for (std::size_t j = 0; j < size; j++) {
+                list.push_back(static_cast<int>(i + j));
+            }
+            lists.push_back(std::move(list));
+        }
+        doNotOptimize(lists.data());
+    });
+}
+
+MF_BENCHMARK_GROUP(SmallVector) {
+    // Short components, which fit in the small string optimization.
+    std::vector<std::string> paths{};
+    for (int i = 0; i < 100000; i++) {
+        paths.push_back("usr/lib" + std::to_string(i % 7) + "/mf/file" + std::to_string(i));
+    }
+    measureSplit<std::vector<std::string>>("split path: std::vector", paths);
+    measureSplit<SmallVector<std::string, 8>>("split path: SmallVector<8>", paths);
+
+    measureLists<std::vector<int>>("100k lists of 4 ints: std::vector", 4);
+    measureLists<SmallVector<int, 8>>("100k lists of 4 ints: SmallVector<8>", 4);
+    // Beyond the inline capacity, it allocates like std::vector.
+    measureLists<std::vector<int>>("100k lists of 12 ints: std::vector", 12);
+    measureLists<SmallVector<int, 8>>("100k lists of 12 ints: SmallVector<8>", 12);
+}
@@ -0,0 +1,357 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <unordered_map>
+
+#include "MF/BatchStreams.hpp"
+#include "MF/FusedStreams.hpp"
+#include "MF/Streams.hpp"
+#include "benchmarks_data.hpp"
+
+using namespace MF::Containers;
+using MF::Benchmarks::doNotOptimize;
+using MF::Benchmarks::measure;
+
+static bool isEven(const int& value) {
+    return value % 2 == 0;
+}
+
+static int timesThreePlusOne(const int& value) {
+    return value * 3 + 1;
+}
+
+MF_BENCHMARK_GROUP(Streams) {
+    const std::size_t count = 1024 * 1024;
+    const std::size_t iterations = 50;
+    const std::size_t bytes = count * sizeof(int);
+
+    std::mt19937 generator(1);
+    std::vector<int> values(count);
+    for (auto& value : values) {
+        value = static_cast<int>(generator() % 1000);
+    }
+
+    measure(
+        "filter + size: hand-written loop",
+        iterations,
+        [&]() {
+            std::size_t result = 0;
+            for (const int value : values) {
+                result += isEven(value) ? 1 : 0;
+            }
+            doNotOptimize(result);
+        },
+        bytes);
+    measure(
+        "filter + size: Streams",
+        iterations,
+        [&]() {
+            const auto source = Streams::fromCollection(values);
+            const auto filtered = source->filter(isEven);
+            doNotOptimize(filtered->size());
+        },
+        bytes);
+    measure(
+        "filter + size: FusedStreams",
+        iterations,
+        [&]() { doNotOptimize(FusedStreams::fromCollection(values).filter(isEven).size()); },
+        bytes);
+    measure(
+        "filter + size: FusedStreams, lambda",
+        iterations,
+        [&]() {
+            const auto stream = FusedStreams::fromCollection(values).filter([](int value) {
+                return value % 2 == 0;
+            });
+            doNotOptimize(stream.size());
+        },
+        bytes);
+
+    measure(
+        "filter + map + collect: hand-written loop",
+        iterations,
+        [&]() {
+            std::vector<int> result{};
+            for (const int value : values) {
+                if (isEven(value)) {
+                    result.push_back(timesThreePlusOne(value));
+                }
+            }
+            doNotOptimize(result.data());
+        },
+        bytes);
+    measure(
+        "filter + map + collect: Streams",
+        iterations,
+        [&]() {
+            // The stages refer to the previous ones, which must be kept alive.
+            const auto source = Streams::fromCollection(values);
+            const auto filtered = source->filter(isEven);
+            const auto mapped = filtered->map<int>(timesThreePlusOne);
+            doNotOptimize(mapped->collectToVector().data());
+        },
+        bytes);
+    measure(
+        "filter + map + collect: FusedStreams",
+        iterations,
+        [&]() {
+            const auto result = FusedStreams::fromCollection(values)
+                                    .filter(isEven)
+                                    .map(timesThreePlusOne)
+                                    .collectToVector();
+            doNotOptimize(result.data());
+        },
+        bytes);
+    measure(
+        "filter + map + collect: FusedStreams, lambdas",
+        iterations,
+        [&]() {
+            const auto result = FusedStreams::fromCollection(values)
+                                    .filter([](int value) { return value % 2 == 0; })
+                                    .map([](int value) { return value * 3 + 1; })
+                                    .collectToVector();
+            doNotOptimize(result.data());
+        },
+        bytes);
+
+    measure(
+        "filter + map + collect: FusedStreams, parallel",
+        iterations,
+        [&]() {
+            const auto result = FusedStreams::fromCollection(values)
+                                    .parallel()
+                                    .filter([](int value) { return value % 2 == 0; })
+                                    .map([](int value) { return value * 3 + 1; })
+                                    .collectToVector();
+            doNotOptimize(result.data());
+        },
+        bytes);
+
+    // Arithmetic stages, where the blocks of BatchStreams are vectorized.
+    const auto isSmall = [](int value) { return value < 700; };
+    const auto scale = [](int value) { return value * 3 + 1; };
+    measure(
+        "filter + size: BatchStreams",
+        iterations,
+        [&]() { doNotOptimize(BatchStreams::fromCollection(values).filter(isSmall).size()); },
+        bytes);
+    measure(
+        "filter + map + sum: hand-written loop",
+        iterations,
+        [&]() {
+            int result = 0;
+            for (const int value : values) {
+                if (isSmall(value)) {
+                    result += scale(value);
+                }
+            }
+            doNotOptimize(result);
+        },
+        bytes);
+    measure(
+        "filter + map + sum: FusedStreams",
+        iterations,
+        [&]() {
+            doNotOptimize(FusedStreams::fromCollection(values)
+                              .filter(isSmall)
+                              .map(scale)
+                              .reduce(0, std::plus<>()));
+        },
+        bytes);
+    measure(
+        "filter + map + sum: BatchStreams",
+        iterations,
+        [&]() {
+            doNotOptimize(
+                BatchStreams::fromCollection(values).filter(isSmall).map(scale).sum());
+        },
+        bytes);
+    measure(
+        "map + filter + sum: FusedStreams",
+        iterations,
+        [&]() {
+            doNotOptimize(FusedStreams::fromCollection(values)
+                              .map(scale)
+                              .filter([](int value) { return value % 4 == 0; })
+                              .reduce(0, std::plus<>()));
+        },
+        bytes);
+    measure(
+        "map + filter + sum: BatchStreams",
+        iterations,
+        [&]() {
+            doNotOptimize(BatchStreams::fromCollection(values)
+                              .map(scale)
+                              .filter([](int value) { return value % 4 == 0; })
+                              .sum());
+        },
+        bytes);
+
+    std::vector<double> doubles(values.begin(), values.end());
+    const auto halve = [](double value) { return value * 0.5 + 1.; };
+    measure(
+        "filter + map + sum of doubles: FusedStreams",
+        iterations,
+        [&]() {
+            doNotOptimize(FusedStreams::fromCollection(doubles)
+                              .filter([](double value) { return value < 700.; })
+                              .map(halve)
+                              .reduce(0., std::plus<>()));
+        },
+        bytes * 2);
+    measure(
+        "filter + map + sum of doubles: BatchStreams",
+        iterations,
+        [&]() {
+            doNotOptimize(BatchStreams::fromCollection(doubles)
+                              .filter([](double value) { return value < 700.; })
+                              .map(halve)
+                              .sum());
+        },
+        bytes * 2);
+
+    // Heavier stages, where the threads pay off the most.
+    const auto slowMapper = [](int value) {
+        return std::sqrt(static_cast<double>(value)) * std::log1p(static_cast<double>(value));
+    };
+    measure(
+        "sqrt map + reduce: FusedStreams",
+        iterations,
+        [&]() {
+            doNotOptimize(
+                FusedStreams::fromCollection(values).map(slowMapper).reduce(0., std::plus<>()));
+        },
+        bytes);
+    measure(
+        "sqrt map + reduce: FusedStreams, parallel",
+        iterations,
+        [&]() {
+            doNotOptimize(FusedStreams::fromCollection(values)
+                              .parallel()
+                              .map(slowMapper)
+                              .reduce(0., std::plus<>()));
+        },
+        bytes);
+
+    // Sorts of random integers, where sorted() without comparator is a radix sort.
+    std::vector<int> randomValues(count);
+    for (auto& value : randomValues) {
+        value = static_cast<int>(generator());
+    }
+    const std::size_t sortIterations = 10;
+    measure(
+        "sort: std::sort",
+        sortIterations,
+        [&]() {
+            std::vector<int> result = randomValues;
+            std::sort(result.begin(), result.end());
+            doNotOptimize(result.data());
+        },
+        bytes);
+    measure(
+        "sort: FusedStreams, radix",
+        sortIterations,
+        [&]() {
+            doNotOptimize(
+                FusedStreams::fromCollection(randomValues).sorted().collectToVector().data());
+        },
+        bytes);
+    const auto isLess = [](int left, int right) { return left < right; };
+    measure(
+        "sort: FusedStreams, comparator",
+        sortIterations,
+        [&]() {
+            doNotOptimize(
+                FusedStreams::fromCollection(randomValues).sorted(isLess).collectToVector().data());
+        },
+        bytes);
+    measure(
+        "sort: FusedStreams, comparator, parallel",
+        sortIterations,
+        [&]() {
+            doNotOptimize(FusedStreams::fromCollection(randomValues)
+                              .parallel()
+                              .sorted(isLess)
+                              .collectToVector()
+                              .data());
+        },
+        bytes);
+    measure(
+        "top 10: std::partial_sort",
+        iterations,
+        [&]() {
+            std::vector<int> result = randomValues;
+            std::partial_sort(result.begin(), result.begin() + 10, result.end(), std::greater<>());
+            result.resize(10);
+            doNotOptimize(result.data());
+        },
+        bytes);
+    measure(
+        "top 10: FusedStreams",
+        iterations,
+        [&]() {
+            doNotOptimize(
+                FusedStreams::fromCollection(randomValues).topK(10).collectToVector().data());
+        },
+        bytes);
+    measure(
+        "top 10: FusedStreams, parallel",
+        iterations,
+        [&]() {
+            doNotOptimize(FusedStreams::fromCollection(randomValues)
+                              .parallel()
+                              .topK(10)
+                              .collectToVector()
+                              .data());
+        },
+        bytes);
+
+    // 1000 distinct keys: dense small integers, the best case of std::unordered_map, whose
+    // identity hash then has no collision, and random IDs.
+    std::vector<int> ids(count);
+    std::vector<int> randomIds(1000);
+    for (auto& id : randomIds) {
+        id = static_cast<int>(generator());
+    }
+    for (auto& id : ids) {
+        id = randomIds[generator() % randomIds.size()];
+    }
+    for (const auto& keys : {std::make_pair("dense keys", &values), std::make_pair("IDs", &ids)}) {
+        const std::vector<int>& theValues = *keys.second;
+        measure(
+            std::string("countBy ") + keys.first + ": std::unordered_map loop",
+            iterations,
+            [&]() {
+                std::unordered_map<int, std::size_t> counts{};
+                for (const int value : theValues) {
+                    counts[value]++;
+                }
+                doNotOptimize(counts.size());
+            },
+            bytes);
+        measure(
+            std::string("countBy ") + keys.first + ": FusedStreams",
+            iterations,
+            [&]() {
+                doNotOptimize(FusedStreams::fromCollection(theValues).countBy([](int value) {
+                    return value;
+                }));
+            },
+            bytes);
+        measure(
+            std::string("countBy ") + keys.first + ": FusedStreams, parallel",
+            iterations,
+            [&]() {
+                doNotOptimize(
+                    FusedStreams::fromCollection(theValues).parallel().countBy([](int value) {
+                        return value;
+                    }));
+            },
+            bytes);
+    }
+}
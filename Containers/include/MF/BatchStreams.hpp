@@ -0,0 +1,387 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_BATCHSTREAMS_HPP
+#define MFRANCESCHI_CPPLIBRARIES_BATCHSTREAMS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "MF/FusedStreams.hpp"
+
+namespace MF
+{
+    namespace Containers
+    {
+        /**
+         * Streams of arithmetic values, processed one block of BLOCK_SIZE values at a time, the
+         * way the columnar query engines do it: the stages receive a block of contiguous values
+         * and a selection vector, so that each stage is a tight loop over arrays, which the
+         * compiler vectorizes:
+         * - a filter evaluates its predicate on all the values of a block (vector compares) and
+         *   combines the result with the selection vector;
+         * - a map computes its function on all the values of a block (vector arithmetic), and
+         *   keeps the selection vector.
+         * The unselected values are replaced by a selected one before calling the functors, so
+         * these are only given values of the stream. But they are called on whole blocks, so
+         * they must not have side effects: use FusedStreams for those.
+         * The values of the source are read in place, without copy.
+         * Usage: @code
+         * auto total = BatchStreams::fromCollection(prices).filter(isValid).map(addTax).sum();
+         * @endcode
+         * Like FusedStreams, the stages are template types and a stream is a plain value. The
+         * functors are called as const, from the calling thread.
+         */
+        namespace BatchStreams
+        {
+            constexpr std::size_t BLOCK_SIZE = 1024;
+
+            template <typename T>
+            struct Block {
+                const T* values;
+                std::size_t size;
+                /// 1 for each selected value and 0 for the others, or nullptr if all are selected.
+                const std::uint8_t* selection;
+                std::size_t selectedCount;
+
+                bool isDense() const {
+                    return selection == nullptr;
+                }
+
+                template <typename ValueProcessor>
+                void forEachSelected(ValueProcessor& valueProcessor) const {
+                    for (std::size_t i = 0; i < size; i++) {
+                        if (isDense() || selection[i] != 0) {
+                            valueProcessor(values[i]);
+                        }
+                    }
+                }
+            };
+
+            namespace detail
+            {
+                // A stage has a "value_type" and a "forEachBlock(sink)" const member function,
+                // which calls "sink" with each Block<value_type> with selected values. The sink
+                // returns false to stop, and then "forEachBlock" returns false too.
+
+                /// "Collection" is either a const lvalue reference, or an owned collection.
+                template <typename Collection>
+                struct CollectionStage {
+                    using value_type = typename std::decay_t<Collection>::value_type;
+
+                    Collection collection;
+
+                    template <typename Sink>
+                    bool forEachBlock(Sink& sink) const {
+                        const value_type* const data = collection.data();
+                        const std::size_t size = collection.size();
+                        for (std::size_t begin = 0; begin < size; begin += BLOCK_SIZE) {
+                            const std::size_t blockSize = std::min(BLOCK_SIZE, size - begin);
+                            if (!sink(Block<value_type>{
+                                    data + begin, blockSize, nullptr, blockSize})) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+                };
+
+                template <typename T>
+                struct ArrayStage {
+                    using value_type = T;
+
+                    const T* data;
+                    std::size_t size;
+
+                    template <typename Sink>
+                    bool forEachBlock(Sink& sink) const {
+                        for (std::size_t begin = 0; begin < size; begin += BLOCK_SIZE) {
+                            const std::size_t blockSize = std::min(BLOCK_SIZE, size - begin);
+                            if (!sink(Block<T>{data + begin, blockSize, nullptr, blockSize})) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+                };
+
+                /// "results[i] = function(value i)", with a selected value instead of the others.
+                template <typename T, typename Function, typename Result>
+                void applyToBlock(
+                    const Block<T>& block, const Function& function, Result* results) {
+                    if (block.isDense()) {
+                        for (std::size_t i = 0; i < block.size; i++) {
+                            results[i] = static_cast<Result>(function(block.values[i]));
+                        }
+                    } else {
+                        // The blocks have at least one selected value.
+                        const std::size_t firstSelected = static_cast<std::size_t>(
+                            std::find(block.selection, block.selection + block.size, 1)
+                            - block.selection);
+                        const T substitute = block.values[firstSelected];
+                        for (std::size_t i = 0; i < block.size; i++) {
+                            // Unconditional loads and a select: without branch.
+                            const T value = block.values[i];
+                            const T input = block.selection[i] != 0 ? value : substitute;
+                            results[i] = static_cast<Result>(function(input));
+                        }
+                    }
+                }
+
+                /**
+                 * "selection[i] = 1" if the predicate holds for the value i, else 0. The result
+                 * may be any truthy type (such as "value & 0x100"), so it is converted to bool
+                 * first: the selection is added up and combined with "&".
+                 */
+                template <typename T, typename Predicate>
+                void selectInBlock(
+                    const Block<T>& block, const Predicate& predicate, std::uint8_t* selection) {
+                    const auto isSelected = [&predicate](const T& value) -> std::uint8_t {
+                        return predicate(value) ? 1 : 0;
+                    };
+                    applyToBlock(block, isSelected, selection);
+                }
+
+                template <typename Previous, typename Predicate>
+                struct FilterStage {
+                    using value_type = typename Previous::value_type;
+
+                    Previous previous;
+                    Predicate predicate;
+
+                    template <typename Sink>
+                    bool forEachBlock(Sink& sink) const {
+                        const Predicate& thePredicate = predicate;
+                        auto filteringSink = [&thePredicate,
+                                              &sink](const Block<value_type>& block) {
+                            std::uint8_t selection[BLOCK_SIZE];
+                            selectInBlock(block, thePredicate, selection);
+                            // Narrow: the bytes are cheaper to add up into 16 bits.
+                            std::uint16_t count = 0;
+                            if (block.isDense()) {
+                                for (std::size_t i = 0; i < block.size; i++) {
+                                    count += selection[i];
+                                }
+                            } else {
+                                for (std::size_t i = 0; i < block.size; i++) {
+                                    selection[i] &= block.selection[i];
+                                    count += selection[i];
+                                }
+                            }
+
+                            if (count == 0) {
+                                return true;
+                            }
+                            return sink(Block<value_type>{
+                                block.values, block.size,
+                                count == block.size ? nullptr : selection, count});
+                        };
+                        return previous.forEachBlock(filteringSink);
+                    }
+                };
+
+                template <typename Previous, typename Target, typename Mapper>
+                struct MapStage {
+                    using value_type = Target;
+                    using Source_t = typename Previous::value_type;
+
+                    Previous previous;
+                    Mapper mapper;
+
+                    template <typename Sink>
+                    bool forEachBlock(Sink& sink) const {
+                        const Mapper& theMapper = mapper;
+                        auto mappingSink = [&theMapper, &sink](const Block<Source_t>& block) {
+                            Target values[BLOCK_SIZE];
+                            applyToBlock(block, theMapper, values);
+                            return sink(Block<Target>{
+                                values, block.size, block.selection, block.selectedCount});
+                        };
+                        return previous.forEachBlock(mappingSink);
+                    }
+                };
+            } // namespace detail
+
+            template <typename Stage>
+            class BatchStream {
+               public:
+                using value_type = typename Stage::value_type;
+                static_assert(
+                    std::is_arithmetic<value_type>::value,
+                    "The batch streams only handle arithmetic types.");
+
+                explicit BatchStream(Stage stage) : stage(std::move(stage)) {
+                }
+
+                // ----- STAGES: they copy this stream, or move it when it is an rvalue.
+
+                template <typename Predicate>
+                auto filter(Predicate&& predicate) const& {
+                    return makeFilter(stage, std::forward<Predicate>(predicate));
+                }
+
+                template <typename Predicate>
+                auto filter(Predicate&& predicate) && {
+                    return makeFilter(std::move(stage), std::forward<Predicate>(predicate));
+                }
+
+                /// "Target" may be omitted to use the result type of "mapper".
+                template <typename Target = void, typename Mapper>
+                auto map(Mapper&& mapper) const& {
+                    return makeMap<Target>(stage, std::forward<Mapper>(mapper));
+                }
+
+                template <typename Target = void, typename Mapper>
+                auto map(Mapper&& mapper) && {
+                    return makeMap<Target>(std::move(stage), std::forward<Mapper>(mapper));
+                }
+
+                // ----- TERMINAL OPERATIONS
+
+                /// "blockProcessor(block)" with each non-empty Block<value_type>.
+                template <typename BlockProcessor>
+                void browseBlocks(BlockProcessor&& blockProcessor) const {
+                    auto processingSink = [&blockProcessor](const Block<value_type>& block) {
+                        blockProcessor(block);
+                        return true;
+                    };
+                    stage.forEachBlock(processingSink);
+                }
+
+                template <typename ElementProcessor>
+                void browse(ElementProcessor&& elementProcessor) const {
+                    browseBlocks([&elementProcessor](const Block<value_type>& block) {
+                        block.forEachSelected(elementProcessor);
+                    });
+                }
+
+                std::vector<value_type> collectToVector() const {
+                    std::vector<value_type> result{};
+                    browseBlocks([&result](const Block<value_type>& block) {
+                        const std::size_t previousSize = result.size();
+                        if (block.isDense()) {
+                            result.insert(result.end(), block.values, block.values + block.size);
+                        } else {
+                            // Without branch: the unselected values are overwritten.
+                            result.resize(previousSize + block.size);
+                            value_type* const output = result.data() + previousSize;
+                            std::size_t count = 0;
+                            for (std::size_t i = 0; i < block.size; i++) {
+                                output[count] = block.values[i];
+                                count += block.selection[i];
+                            }
+                            result.resize(previousSize + count);
+                        }
+                    });
+                    return result;
+                }
+
+                std::size_t size() const {
+                    std::size_t result = 0;
+                    browseBlocks([&result](const Block<value_type>& block) {
+                        result += block.selectedCount;
+                    });
+                    return result;
+                }
+
+                /// Folds the elements in order with "accumulator(result, element)".
+                template <typename Accumulator>
+                value_type reduce(value_type identity, const Accumulator& accumulator) const {
+                    browseBlocks([&identity, &accumulator](const Block<value_type>& block) {
+                        auto accumulate = [&identity, &accumulator](value_type value) {
+                            identity = accumulator(identity, value);
+                        };
+                        block.forEachSelected(accumulate);
+                    });
+                    return identity;
+                }
+
+                /**
+                 * The blocks are summed with 8 independent partial sums, which are
+                 * vectorized. The rounding of the floating-point sums then differs from
+                 * reduce(0, std::plus<>()), but the integer sums are the same.
+                 */
+                value_type sum() const {
+                    value_type result = 0;
+                    browseBlocks([&result](const Block<value_type>& block) {
+                        const value_type* values = block.values;
+                        value_type maskedValues[BLOCK_SIZE];
+                        if (!block.isDense()) {
+                            for (std::size_t i = 0; i < block.size; i++) {
+                                const value_type value = block.values[i];
+                                maskedValues[i] = block.selection[i] != 0 ? value : value_type(0);
+                            }
+                            values = maskedValues;
+                        }
+
+                        // Local partial sums, which stay in registers.
+                        value_type partialSums[LANES] = {};
+                        std::size_t i = 0;
+                        for (; i + LANES <= block.size; i += LANES) {
+                            for (std::size_t lane = 0; lane < LANES; lane++) {
+                                partialSums[lane] += values[i + lane];
+                            }
+                        }
+                        for (; i < block.size; i++) {
+                            partialSums[0] += values[i];
+                        }
+                        for (const value_type partialSum : partialSums) {
+                            result += partialSum;
+                        }
+                    });
+                    return result;
+                }
+
+               private:
+                static constexpr std::size_t LANES = 8;
+
+                template <typename TheStage, typename Predicate>
+                static auto makeFilter(TheStage&& theStage, Predicate&& predicate) {
+                    using Filter_t = detail::FilterStage<Stage, std::decay_t<Predicate>>;
+                    return BatchStream<Filter_t>(Filter_t{
+                        std::forward<TheStage>(theStage), std::forward<Predicate>(predicate)});
+                }
+
+                template <typename Target, typename TheStage, typename Mapper>
+                static auto makeMap(TheStage&& theStage, Mapper&& mapper) {
+                    using Target_t =
+                        FusedStreams::detail::MappedType_t<Target, Mapper, value_type>;
+                    using Map_t = detail::MapStage<Stage, Target_t, std::decay_t<Mapper>>;
+                    return BatchStream<Map_t>(
+                        Map_t{std::forward<TheStage>(theStage), std::forward<Mapper>(mapper)});
+                }
+
+                Stage stage;
+            };
+
+            /// The stream refers to "collection", whose values are contiguous ("data()").
+            template <typename Collection>
+            BatchStream<detail::CollectionStage<const Collection&>> fromCollection(
+                const Collection& collection) {
+                return BatchStream<detail::CollectionStage<const Collection&>>({collection});
+            }
+
+            /// The stream owns "collection", which is moved into it.
+            template <
+                typename Collection,
+                typename = std::enable_if_t<!std::is_lvalue_reference<Collection>::value>>
+            BatchStream<detail::CollectionStage<Collection>> fromCollection(
+                Collection&& collection) {
+                return BatchStream<detail::CollectionStage<Collection>>({std::move(collection)});
+            }
+
+            /// The stream refers to the values, which must outlive it.
+            template <typename T>
+            BatchStream<detail::ArrayStage<T>> fromArray(const T* data, std::size_t size) {
+                return BatchStream<detail::ArrayStage<T>>({data, size});
+            }
+        } // namespace BatchStreams
+    } // namespace Containers
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_BATCHSTREAMS_HPP
@@ -0,0 +1,1024 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_FLATHASHMAP_HPP
+#define MFRANCESCHI_CPPLIBRARIES_FLATHASHMAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define MF_CONTAINERS_FLAT_HASH_SSE2 1
+#    include <emmintrin.h>
+#else
+#    define MF_CONTAINERS_FLAT_HASH_SSE2 0
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#    define MF_CONTAINERS_FLAT_HASH_NOINLINE __declspec(noinline)
+#else
+#    define MF_CONTAINERS_FLAT_HASH_NOINLINE __attribute__((noinline))
+#endif
+
+namespace MF
+{
+    namespace Containers
+    {
+        /**
+         * Open addressing hash tables, in the style of the "Swiss tables": one control byte per
+         * slot tells whether it is empty, deleted, or full with 7 bits of the hash of its key.
+         * A lookup compares a whole group of control bytes at once (16 with SSE2, else 8), and
+         * only compares the keys of the slots whose 7 bits match. The slots are contiguous,
+         * without node allocation, and at most 7/8 of them are full.
+         * As with std::unordered_map, the iterators and references are invalidated by the
+         * insertions which grow the table, but not by the erasures. The elements must be
+         * movable without exception.
+         */
+
+        /**
+         * Default hash of the flat hash tables: std::hash, except for std::string, which is
+         * "transparent": it also hashes the "const char*" the same way, so that the tables can
+         * look them up without building a std::string.
+         */
+        template <typename Key>
+        struct FlatHash {
+            std::size_t operator()(const Key& key) const {
+                return std::hash<Key>()(key);
+            }
+        };
+
+        namespace detail
+        {
+            /// Hash of the bytes, 8 at a time.
+            inline std::size_t hashBytes(const char* data, std::size_t size) {
+                constexpr std::uint64_t MULTIPLIER = 0xBF58476D1CE4E5B9ULL;
+                std::uint64_t result = size * 0x9E3779B97F4A7C15ULL;
+                for (; size >= 8; data += 8, size -= 8) {
+                    std::uint64_t word;
+                    std::memcpy(&word, data, 8);
+                    result = (result ^ word) * MULTIPLIER;
+                    result ^= result >> 31;
+                }
+                if (size != 0) {
+                    std::uint64_t word = 0;
+                    std::memcpy(&word, data, size);
+                    result = (result ^ word) * MULTIPLIER;
+                    result ^= result >> 31;
+                }
+                return static_cast<std::size_t>(result);
+            }
+        } // namespace detail
+
+        template <>
+        struct FlatHash<std::string> {
+            using is_transparent = void;
+
+            std::size_t operator()(const std::string& key) const {
+                return detail::hashBytes(key.data(), key.size());
+            }
+
+            std::size_t operator()(const char* key) const {
+                return detail::hashBytes(key, std::strlen(key));
+            }
+        };
+
+        namespace detail
+        {
+            // Control bytes: the full slots have the 7 bits of the hash, in [0, 127].
+            constexpr std::int8_t CONTROL_EMPTY = -128;
+            constexpr std::int8_t CONTROL_DELETED = -2;
+            /// After the last slot, to stop the iterations.
+            constexpr std::int8_t CONTROL_SENTINEL = -1;
+
+            /// Set of positions in a group, one bit per control byte.
+            class BitMask {
+               public:
+                explicit BitMask(std::uint32_t mask) : mask(mask) {
+                }
+
+                bool hasAny() const {
+                    return mask != 0;
+                }
+
+                unsigned getLowest() const {
+#if defined(_MSC_VER) && !defined(__clang__)
+                    unsigned long index;
+                    _BitScanForward(&index, mask);
+                    return static_cast<unsigned>(index);
+#else
+                    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+                }
+
+                void removeLowest() {
+                    mask &= mask - 1;
+                }
+
+               private:
+                std::uint32_t mask;
+            };
+
+#if MF_CONTAINERS_FLAT_HASH_SSE2
+            class Group {
+               public:
+                static constexpr std::size_t WIDTH = 16;
+
+                explicit Group(const std::int8_t* controlBytes)
+                    : controls(_mm_loadu_si128(reinterpret_cast<const __m128i*>(controlBytes))) {
+                }
+
+                BitMask match(std::int8_t control) const {
+                    return toBitMask(_mm_cmpeq_epi8(_mm_set1_epi8(control), controls));
+                }
+
+                BitMask matchEmptyOrDeleted() const {
+                    return toBitMask(_mm_cmpgt_epi8(_mm_set1_epi8(CONTROL_SENTINEL), controls));
+                }
+
+               private:
+                static BitMask toBitMask(__m128i comparison) {
+                    return BitMask(static_cast<std::uint32_t>(_mm_movemask_epi8(comparison)));
+                }
+
+                __m128i controls;
+            };
+#else
+            /// Portable version, one control byte after the other.
+            class Group {
+               public:
+                static constexpr std::size_t WIDTH = 8;
+
+                explicit Group(const std::int8_t* controlBytes) {
+                    std::memcpy(controls, controlBytes, WIDTH);
+                }
+
+                BitMask match(std::int8_t control) const {
+                    std::uint32_t mask = 0;
+                    for (std::size_t i = 0; i < WIDTH; i++) {
+                        mask |= static_cast<std::uint32_t>(controls[i] == control) << i;
+                    }
+                    return BitMask(mask);
+                }
+
+                BitMask matchEmptyOrDeleted() const {
+                    std::uint32_t mask = 0;
+                    for (std::size_t i = 0; i < WIDTH; i++) {
+                        mask |= static_cast<std::uint32_t>(controls[i] < CONTROL_SENTINEL) << i;
+                    }
+                    return BitMask(mask);
+                }
+
+               private:
+                std::int8_t controls[WIDTH];
+            };
+#endif
+
+            template <typename Type>
+            struct HasTransparentMember {
+                template <typename T>
+                static std::true_type test(typename T::is_transparent*);
+
+                template <typename T>
+                static std::false_type test(...);
+
+                static constexpr bool value = decltype(test<Type>(nullptr))::value;
+            };
+
+            /// The controls of the tables without slots: their lookups end at the first group.
+            inline std::int8_t* getEmptyGroup() {
+                struct EmptyGroup {
+                    std::int8_t controls[Group::WIDTH];
+
+                    EmptyGroup() {
+                        std::fill(controls, controls + Group::WIDTH, CONTROL_EMPTY);
+                        controls[0] = CONTROL_SENTINEL;
+                    }
+                };
+                // Never written: the tables allocate their slots before the first insertion.
+                static EmptyGroup emptyGroup{};
+                return emptyGroup.controls;
+            }
+
+            template <typename Key, typename Value>
+            struct FlatMapPolicy {
+                using key_type = Key;
+                using value_type = std::pair<const Key, Value>;
+                using iterator_value_type = value_type;
+
+                static const Key& getKey(const value_type& value) {
+                    return value.first;
+                }
+
+                /// Moves the key too, from a slot of the table which is about to be destroyed.
+                static void moveConstruct(value_type* target, value_type& source) {
+                    ::new (static_cast<void*>(target)) value_type(
+                        std::move(const_cast<Key&>(source.first)), std::move(source.second));
+                }
+            };
+
+            template <typename Key>
+            struct FlatSetPolicy {
+                using key_type = Key;
+                using value_type = Key;
+                /// The elements of a set are its keys: they are not modifiable.
+                using iterator_value_type = const Key;
+
+                static const Key& getKey(const value_type& value) {
+                    return value;
+                }
+
+                static void moveConstruct(value_type* target, value_type& source) {
+                    ::new (static_cast<void*>(target)) value_type(std::move(source));
+                }
+            };
+
+            template <typename Value>
+            class FlatHashIterator {
+               public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = std::remove_const_t<Value>;
+                using difference_type = std::ptrdiff_t;
+                using pointer = Value*;
+                using reference = Value&;
+
+                FlatHashIterator() = default;
+
+                /// Skips the empty and deleted slots, up to the sentinel.
+                FlatHashIterator(const std::int8_t* control, Value* slot)
+                    : control(control), slot(slot) {
+                    skipFreeSlots();
+                }
+
+                /// From the iterator to the const iterator.
+                template <
+                    typename Other,
+                    typename = std::enable_if_t<std::is_same<const Other, Value>::value>>
+                FlatHashIterator(const FlatHashIterator<Other>& other)
+                    : control(other.control), slot(other.slot) {
+                }
+
+                reference operator*() const {
+                    return *slot;
+                }
+
+                pointer operator->() const {
+                    return slot;
+                }
+
+                FlatHashIterator& operator++() {
+                    ++control;
+                    ++slot;
+                    skipFreeSlots();
+                    return *this;
+                }
+
+                FlatHashIterator operator++(int) {
+                    FlatHashIterator result = *this;
+                    ++*this;
+                    return result;
+                }
+
+                bool operator==(const FlatHashIterator& other) const {
+                    return control == other.control;
+                }
+
+                bool operator!=(const FlatHashIterator& other) const {
+                    return control != other.control;
+                }
+
+               private:
+                template <typename>
+                friend class FlatHashIterator;
+                template <typename, typename, typename>
+                friend class FlatHashTable;
+
+                void skipFreeSlots() {
+                    while (*control < CONTROL_SENTINEL) {
+                        ++control;
+                        ++slot;
+                    }
+                }
+
+                const std::int8_t* control = nullptr;
+                Value* slot = nullptr;
+            };
+
+            /// Common part of FlatHashMap and FlatHashSet, the "Policy" tells what a slot holds.
+            template <typename Policy, typename Hash, typename Equal>
+            class FlatHashTable {
+               public:
+                using key_type = typename Policy::key_type;
+                using value_type = typename Policy::value_type;
+                using size_type = std::size_t;
+                using difference_type = std::ptrdiff_t;
+                using hasher = Hash;
+                using key_equal = Equal;
+                using reference = value_type&;
+                using const_reference = const value_type&;
+                using iterator = FlatHashIterator<typename Policy::iterator_value_type>;
+                using const_iterator = FlatHashIterator<const value_type>;
+
+               private:
+                struct NotAnIterator {};
+
+                /// The sets have no mutable iterator.
+                using MutableIterator_t = std::conditional_t<
+                    std::is_same<iterator, const_iterator>::value,
+                    NotAnIterator,
+                    iterator>;
+
+               public:
+
+                // ----- Constructors & destructors
+
+                FlatHashTable() = default;
+
+                /// Already has room for "size" elements.
+                explicit FlatHashTable(
+                    std::size_t size, const Hash& hash = Hash(), const Equal& equal = Equal())
+                    : hash(hash), equal(equal) {
+                    reserve(size);
+                }
+
+                FlatHashTable(
+                    std::initializer_list<value_type> values,
+                    const Hash& hash = Hash(),
+                    const Equal& equal = Equal())
+                    : FlatHashTable(values.size(), hash, equal) {
+                    insert(values.begin(), values.end());
+                }
+
+                FlatHashTable(const FlatHashTable& other)
+                    : FlatHashTable(other.size(), other.hash, other.equal) {
+                    insert(other.begin(), other.end());
+                }
+
+                FlatHashTable(FlatHashTable&& other) noexcept
+                    : controls(other.controls),
+                      slots(other.slots),
+                      capacity(other.capacity),
+                      elementsCount(other.elementsCount),
+                      growthLeft(other.growthLeft),
+                      hash(std::move(other.hash)),
+                      equal(std::move(other.equal)) {
+                    other.releaseStorage();
+                }
+
+                FlatHashTable& operator=(const FlatHashTable& other) {
+                    if (this != &other) {
+                        FlatHashTable copy(other);
+                        swap(copy);
+                    }
+                    return *this;
+                }
+
+                FlatHashTable& operator=(FlatHashTable&& other) noexcept {
+                    FlatHashTable moved(std::move(other));
+                    swap(moved);
+                    return *this;
+                }
+
+                FlatHashTable& operator=(std::initializer_list<value_type> values) {
+                    clear();
+                    insert(values.begin(), values.end());
+                    return *this;
+                }
+
+                ~FlatHashTable() {
+                    destroySlots();
+                    deallocate(controls, slots, capacity);
+                }
+
+                // ----- Iterators
+
+                iterator begin() {
+                    return {controls, slots};
+                }
+
+                const_iterator begin() const {
+                    return {controls, slots};
+                }
+
+                const_iterator cbegin() const {
+                    return begin();
+                }
+
+                iterator end() {
+                    return makeIterator(capacity);
+                }
+
+                const_iterator end() const {
+                    return makeIterator(capacity);
+                }
+
+                const_iterator cend() const {
+                    return end();
+                }
+
+                // ----- Capacity
+
+                bool empty() const {
+                    return elementsCount == 0;
+                }
+
+                std::size_t size() const {
+                    return elementsCount;
+                }
+
+                /// Number of slots.
+                std::size_t bucket_count() const {
+                    return capacity;
+                }
+
+                float load_factor() const {
+                    return capacity == 0 ? 0.f : float(elementsCount) / float(capacity);
+                }
+
+                /// The table grows when it would be fuller: fixed.
+                float max_load_factor() const {
+                    return 0.875f;
+                }
+
+                /// Makes room for "size" elements, so that their insertions do not grow the table.
+                void reserve(std::size_t size) {
+                    if (size > elementsCount + growthLeft) {
+                        resize(normalizeCapacity(growthToCapacity(size)));
+                    }
+                }
+
+                /**
+                 * Resizes the table to at least "slotsCount" slots, but enough for its elements.
+                 * rehash(0) shrinks it to fit, and frees its memory when it is empty.
+                 */
+                void rehash(std::size_t slotsCount) {
+                    if (slotsCount == 0 && elementsCount == 0) {
+                        destroySlots();
+                        deallocate(controls, slots, capacity);
+                        releaseStorage();
+                        return;
+                    }
+                    const std::size_t newCapacity = normalizeCapacity(
+                        std::max(slotsCount, growthToCapacity(elementsCount)));
+                    if (slotsCount == 0 || newCapacity > capacity) {
+                        resize(newCapacity);
+                    }
+                }
+
+                // ----- Modifiers
+
+                /// Keeps the memory of the slots.
+                void clear() {
+                    destroySlots();
+                    if (capacity != 0) {
+                        resetControls(controls, capacity);
+                    }
+                    elementsCount = 0;
+                    growthLeft = capacityToGrowth(capacity);
+                }
+
+                std::pair<iterator, bool> insert(const value_type& value) {
+                    return emplaceWithKey(Policy::getKey(value), value);
+                }
+
+                std::pair<iterator, bool> insert(value_type&& value) {
+                    return emplaceWithKey(Policy::getKey(value), std::move(value));
+                }
+
+                template <typename InputIterator>
+                void insert(InputIterator first, InputIterator last) {
+                    for (; first != last; ++first) {
+                        insert(*first);
+                    }
+                }
+
+                void insert(std::initializer_list<value_type> values) {
+                    insert(values.begin(), values.end());
+                }
+
+                /// The element is built first, to get its key, and moved into its slot.
+                template <typename... Arguments>
+                std::pair<iterator, bool> emplace(Arguments&&... arguments) {
+                    // Raw storage, so that the key can be moved from it like from the slots.
+                    struct alignas(value_type) Storage {
+                        unsigned char bytes[sizeof(value_type)];
+                    } storage;
+                    auto value = reinterpret_cast<value_type*>(&storage);
+                    ::new (static_cast<void*>(value))
+                        value_type(std::forward<Arguments>(arguments)...);
+                    struct Destroyer {
+                        value_type* value;
+
+                        ~Destroyer() {
+                            value->~value_type();
+                        }
+                    } destroyer{value};
+
+                    const std::size_t keyHash = hashKey(Policy::getKey(*value));
+                    const std::size_t found = findIndex(Policy::getKey(*value), keyHash);
+                    if (found != capacity) {
+                        return {makeIterator(found), false};
+                    }
+                    const std::size_t index = prepareInsert(keyHash);
+                    Policy::moveConstruct(slots + index, *value);
+                    commitInsert(index, keyHash);
+                    return {makeIterator(index), true};
+                }
+
+                /// @returns The iterator to the next element.
+                iterator erase(const_iterator position) {
+                    const auto index = static_cast<std::size_t>(position.control - controls);
+                    eraseAt(index);
+                    return {controls + index + 1, slots + index + 1};
+                }
+
+                iterator erase(MutableIterator_t position) {
+                    return erase(const_iterator(position));
+                }
+
+                iterator erase(const_iterator first, const_iterator last) {
+                    while (first != last) {
+                        first = erase(first);
+                    }
+                    return makeIterator(static_cast<std::size_t>(last.control - controls));
+                }
+
+                /// @returns The number of erased elements, 0 or 1.
+                template <typename K = key_type>
+                std::size_t erase(const K& key) {
+                    const std::size_t index = findIndex(asLookupKey<K>(key));
+                    if (index == capacity) {
+                        return 0;
+                    }
+                    eraseAt(index);
+                    return 1;
+                }
+
+                void swap(FlatHashTable& other) noexcept {
+                    using std::swap;
+                    swap(controls, other.controls);
+                    swap(slots, other.slots);
+                    swap(capacity, other.capacity);
+                    swap(elementsCount, other.elementsCount);
+                    swap(growthLeft, other.growthLeft);
+                    swap(hash, other.hash);
+                    swap(equal, other.equal);
+                }
+
+                // ----- Lookup: the keys of other types are converted to key_type, except when
+                // "Hash" and "Equal" are both transparent (like the default ones of std::string).
+
+                template <typename K = key_type>
+                iterator find(const K& key) {
+                    return makeIterator(findIndex(asLookupKey<K>(key)));
+                }
+
+                template <typename K = key_type>
+                const_iterator find(const K& key) const {
+                    return makeIterator(findIndex(asLookupKey<K>(key)));
+                }
+
+                template <typename K = key_type>
+                bool contains(const K& key) const {
+                    return findIndex(asLookupKey<K>(key)) != capacity;
+                }
+
+                template <typename K = key_type>
+                std::size_t count(const K& key) const {
+                    return contains(key) ? 1 : 0;
+                }
+
+                hasher hash_function() const {
+                    return hash;
+                }
+
+                key_equal key_eq() const {
+                    return equal;
+                }
+
+                /// Same elements, whatever their order.
+                bool operator==(const FlatHashTable& other) const {
+                    if (size() != other.size()) {
+                        return false;
+                    }
+                    for (const value_type& value : *this) {
+                        const auto found = other.find(Policy::getKey(value));
+                        if (found == other.end() || !(*found == value)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                bool operator!=(const FlatHashTable& other) const {
+                    return !(*this == other);
+                }
+
+               protected:
+                template <typename K>
+                using IsTransparent_t = std::integral_constant<
+                    bool,
+                    std::is_same<K, key_type>::value
+                        || (HasTransparentMember<Hash>::value
+                            && HasTransparentMember<Equal>::value)>;
+
+                /// "key" when it can be looked up as it is, else converted to key_type.
+                template <typename K>
+                using LookupKey_t = std::conditional_t<IsTransparent_t<K>::value, K, key_type>;
+
+                template <typename K>
+                static const LookupKey_t<K>& asLookupKey(const LookupKey_t<K>& key) {
+                    return key;
+                }
+
+                /**
+                 * Inserts the element built from "arguments" if "key" is not in the table yet.
+                 * The arguments are not used when it is.
+                 */
+                template <typename K, typename... Arguments>
+                std::pair<iterator, bool> emplaceWithKey(const K& key, Arguments&&... arguments) {
+                    const std::size_t keyHash = hashKey(key);
+                    const std::size_t found = findIndex(key, keyHash);
+                    if (found != capacity) {
+                        return {makeIterator(found), false};
+                    }
+                    return insertNew(keyHash, std::forward<Arguments>(arguments)...);
+                }
+
+                /**
+                 * Not inlined: in the loops which mostly find their keys, the code of the
+                 * insertion made the lookups several times slower.
+                 */
+                template <typename... Arguments>
+                MF_CONTAINERS_FLAT_HASH_NOINLINE std::pair<iterator, bool> insertNew(
+                    std::size_t keyHash, Arguments&&... arguments) {
+                    const std::size_t index = prepareInsert(keyHash);
+                    ::new (static_cast<void*>(slots + index))
+                        value_type(std::forward<Arguments>(arguments)...);
+                    commitInsert(index, keyHash);
+                    return {makeIterator(index), true};
+                }
+
+                template <typename K>
+                std::size_t findIndex(const K& key) const {
+                    return findIndex(key, hashKey(key));
+                }
+
+                /// @returns The index of the slot of "key", else "capacity".
+                template <typename K>
+                std::size_t findIndex(const K& key, std::size_t keyHash) const {
+                    const auto control = getControlHash(keyHash);
+                    for (ProbeSequence probe(getPositionHash(keyHash), capacity);; probe.next()) {
+                        const Group group(controls + probe.offset);
+                        for (BitMask matches = group.match(control); matches.hasAny();
+                             matches.removeLowest()) {
+                            const std::size_t index = probe.getIndex(matches.getLowest());
+                            if (equal(Policy::getKey(slots[index]), key)) {
+                                return index;
+                            }
+                        }
+                        if (group.match(CONTROL_EMPTY).hasAny()) {
+                            return capacity;
+                        }
+                    }
+                }
+
+                iterator makeIterator(std::size_t index) {
+                    iterator result{};
+                    result.control = controls + index;
+                    result.slot = slots + index;
+                    return result;
+                }
+
+                const_iterator makeIterator(std::size_t index) const {
+                    const_iterator result{};
+                    result.control = controls + index;
+                    result.slot = slots + index;
+                    return result;
+                }
+
+                /// @returns The index of the free slot where the element of "keyHash" goes.
+                std::size_t prepareInsert(std::size_t keyHash) {
+                    std::size_t index = findFreeSlot(controls, capacity, keyHash);
+                    // The deleted slots can be reused without reducing the room left.
+                    if (growthLeft == 0 && controls[index] != CONTROL_DELETED) {
+                        grow();
+                        index = findFreeSlot(controls, capacity, keyHash);
+                    }
+                    return index;
+                }
+
+                /// Once the element is built in its slot: on exception, nothing changed.
+                void commitInsert(std::size_t index, std::size_t keyHash) {
+                    if (controls[index] == CONTROL_EMPTY) {
+                        growthLeft--;
+                    }
+                    setControl(controls, capacity, index, getControlHash(keyHash));
+                    elementsCount++;
+                }
+
+               private:
+                /**
+                 * Visits the groups starting at each position of the table, with a quadratic
+                 * step of whole groups. "capacity + 1" being a power of 2, all are visited.
+                 */
+                struct ProbeSequence {
+                    ProbeSequence(std::size_t positionHash, std::size_t mask)
+                        : mask(mask), offset(positionHash & mask) {
+                    }
+
+                    void next() {
+                        step += Group::WIDTH;
+                        offset = (offset + step) & mask;
+                    }
+
+                    /// The groups overflow on the copies of the first control bytes.
+                    std::size_t getIndex(std::size_t positionInGroup) const {
+                        return (offset + positionInGroup) & mask;
+                    }
+
+                    std::size_t mask;
+                    std::size_t offset;
+                    std::size_t step = 0;
+                };
+
+                template <typename K>
+                std::size_t hashKey(const K& key) const {
+                    // Spreads the identity hashes of the integers over all the bits.
+                    const std::uint64_t result =
+                        static_cast<std::uint64_t>(hash(key)) * 0x9E3779B97F4A7C15ULL;
+                    return static_cast<std::size_t>(result ^ (result >> 32));
+                }
+
+                static std::size_t getPositionHash(std::size_t keyHash) {
+                    return keyHash >> 7;
+                }
+
+                static std::int8_t getControlHash(std::size_t keyHash) {
+                    return static_cast<std::int8_t>(keyHash & 0x7F);
+                }
+
+                /// 2^n - 1 slots, at least "slotsCount".
+                static std::size_t normalizeCapacity(std::size_t slotsCount) {
+                    std::size_t result = 1;
+                    while (result < slotsCount) {
+                        result = result * 2 + 1;
+                    }
+                    return result;
+                }
+
+                /// Up to 7/8 of the slots are full.
+                static std::size_t capacityToGrowth(std::size_t slotsCount) {
+                    if (Group::WIDTH == 8 && slotsCount == 7) {
+                        return 6;
+                    }
+                    return slotsCount - slotsCount / 8;
+                }
+
+                static std::size_t growthToCapacity(std::size_t size) {
+                    if (Group::WIDTH == 8 && size == 7) {
+                        return 8;
+                    }
+                    return size == 0 ? 0 : size + (size - 1) / 7;
+                }
+
+                static std::size_t getControlsSize(std::size_t slotsCount) {
+                    // The sentinel, then the copies of the first "WIDTH - 1" control bytes.
+                    return slotsCount + Group::WIDTH;
+                }
+
+                static void resetControls(std::int8_t* theControls, std::size_t slotsCount) {
+                    std::fill(
+                        theControls, theControls + getControlsSize(slotsCount), CONTROL_EMPTY);
+                    theControls[slotsCount] = CONTROL_SENTINEL;
+                }
+
+                /// Also updates the copy, when the control byte is in the first group.
+                static void setControl(
+                    std::int8_t* theControls,
+                    std::size_t slotsCount,
+                    std::size_t index,
+                    std::int8_t control) {
+                    constexpr std::size_t COPIES_COUNT = Group::WIDTH - 1;
+                    theControls[index] = control;
+                    const std::size_t copyIndex =
+                        ((index - COPIES_COUNT) & slotsCount) + (COPIES_COUNT & slotsCount);
+                    theControls[copyIndex] = control;
+                }
+
+                static std::size_t findFreeSlot(
+                    const std::int8_t* theControls, std::size_t slotsCount, std::size_t keyHash) {
+                    for (ProbeSequence probe(getPositionHash(keyHash), slotsCount);;
+                         probe.next()) {
+                        const BitMask freeSlots = Group(theControls + probe.offset)
+                                                      .matchEmptyOrDeleted();
+                        if (freeSlots.hasAny()) {
+                            return probe.getIndex(freeSlots.getLowest());
+                        }
+                    }
+                }
+
+                static void deallocate(
+                    std::int8_t* theControls, value_type* theSlots, std::size_t slotsCount) {
+                    if (slotsCount != 0) {
+                        std::allocator<std::int8_t>().deallocate(
+                            theControls, getControlsSize(slotsCount));
+                        std::allocator<value_type>().deallocate(theSlots, slotsCount);
+                    }
+                }
+
+                /// Rebuilds the table without the deleted slots when it has enough room.
+                void grow() {
+                    if (capacity > Group::WIDTH && elementsCount * 32 <= capacity * 25) {
+                        resize(capacity);
+                    } else {
+                        resize(capacity * 2 + 1);
+                    }
+                }
+
+                void resize(std::size_t newCapacity) {
+                    std::int8_t* newControls =
+                        std::allocator<std::int8_t>().allocate(getControlsSize(newCapacity));
+                    value_type* newSlots;
+                    try {
+                        newSlots = std::allocator<value_type>().allocate(newCapacity);
+                    } catch (...) {
+                        std::allocator<std::int8_t>().deallocate(
+                            newControls, getControlsSize(newCapacity));
+                        throw;
+                    }
+                    resetControls(newControls, newCapacity);
+                    for (std::size_t index = 0; index < capacity; index++) {
+                        if (controls[index] >= 0) {
+                            const std::size_t keyHash = hashKey(Policy::getKey(slots[index]));
+                            const std::size_t newIndex =
+                                findFreeSlot(newControls, newCapacity, keyHash);
+                            setControl(
+                                newControls, newCapacity, newIndex, getControlHash(keyHash));
+                            Policy::moveConstruct(newSlots + newIndex, slots[index]);
+                            slots[index].~value_type();
+                        }
+                    }
+                    deallocate(controls, slots, capacity);
+                    controls = newControls;
+                    slots = newSlots;
+                    capacity = newCapacity;
+                    growthLeft = capacityToGrowth(newCapacity) - elementsCount;
+                }
+
+                void eraseAt(std::size_t index) {
+                    slots[index].~value_type();
+                    // The slot may be in the probe sequences of other keys: they must go on.
+                    setControl(controls, capacity, index, CONTROL_DELETED);
+                    elementsCount--;
+                }
+
+                void destroySlots() {
+                    if (std::is_trivially_destructible<value_type>::value) {
+                        return;
+                    }
+                    for (std::size_t index = 0; index < capacity; index++) {
+                        if (controls[index] >= 0) {
+                            slots[index].~value_type();
+                        }
+                    }
+                }
+
+                /// Back to the empty table, without freeing the storage.
+                void releaseStorage() {
+                    controls = getEmptyGroup();
+                    slots = nullptr;
+                    capacity = 0;
+                    elementsCount = 0;
+                    growthLeft = 0;
+                }
+
+                std::int8_t* controls = getEmptyGroup();
+                value_type* slots = nullptr;
+                /// 0, or 2^n - 1.
+                std::size_t capacity = 0;
+                std::size_t elementsCount = 0;
+                /// Number of insertions in the empty slots before the table grows.
+                std::size_t growthLeft = 0;
+                Hash hash;
+                Equal equal;
+            };
+        } // namespace detail
+
+        /**
+         * Hash map with the interface of std::unordered_map (without the buckets and the node
+         * handles), in a flat hash table.
+         * With the default "Hash" and "Equal", a FlatHashMap<std::string, Value> finds the
+         * "const char*" keys without building a std::string.
+         */
+        template <
+            typename Key,
+            typename Value,
+            typename Hash = FlatHash<Key>,
+            typename Equal = std::equal_to<>>
+        class FlatHashMap
+            : public detail::FlatHashTable<detail::FlatMapPolicy<Key, Value>, Hash, Equal> {
+            using Base_t = detail::FlatHashTable<detail::FlatMapPolicy<Key, Value>, Hash, Equal>;
+
+           public:
+            using mapped_type = Value;
+            using typename Base_t::const_iterator;
+            using typename Base_t::iterator;
+            using typename Base_t::key_type;
+            using typename Base_t::value_type;
+
+            using Base_t::Base_t;
+            using Base_t::operator=;
+
+            FlatHashMap() = default;
+
+            /**
+             * Inserts the value built from "arguments" if "key" is not in the map yet. The
+             * arguments are not used when it is.
+             */
+            template <typename K, typename... Arguments>
+            std::pair<iterator, bool> try_emplace(K&& key, Arguments&&... arguments) {
+                return this->emplaceWithKey(
+                    Base_t::template asLookupKey<std::decay_t<K>>(key),
+                    std::piecewise_construct,
+                    std::forward_as_tuple(std::forward<K>(key)),
+                    std::forward_as_tuple(std::forward<Arguments>(arguments)...));
+            }
+
+            /// Inserts the value, or assigns it to the one of "key".
+            template <typename K, typename V>
+            std::pair<iterator, bool> insert_or_assign(K&& key, V&& value) {
+                auto result = try_emplace(std::forward<K>(key), std::forward<V>(value));
+                if (!result.second) {
+                    result.first->second = std::forward<V>(value);
+                }
+                return result;
+            }
+
+            /// Inserts a value-initialized "Value" if "key" is not in the map yet.
+            template <typename K = key_type>
+            Value& operator[](K&& key) {
+                return try_emplace(std::forward<K>(key)).first->second;
+            }
+
+            /// @throws std::out_of_range if "key" is not in the map.
+            template <typename K = key_type>
+            Value& at(const K& key) {
+                const auto found = this->find(key);
+                if (found == this->end()) {
+                    throw std::out_of_range("The key is not in the FlatHashMap.");
+                }
+                return found->second;
+            }
+
+            template <typename K = key_type>
+            const Value& at(const K& key) const {
+                const auto found = this->find(key);
+                if (found == this->end()) {
+                    throw std::out_of_range("The key is not in the FlatHashMap.");
+                }
+                return found->second;
+            }
+        };
+
+        /// Hash set with the interface of std::unordered_set, in a flat hash table.
+        template <typename Key, typename Hash = FlatHash<Key>, typename Equal = std::equal_to<>>
+        class FlatHashSet : public detail::FlatHashTable<detail::FlatSetPolicy<Key>, Hash, Equal> {
+            using Base_t = detail::FlatHashTable<detail::FlatSetPolicy<Key>, Hash, Equal>;
+
+           public:
+            using Base_t::Base_t;
+            using Base_t::operator=;
+
+            FlatHashSet() = default;
+        };
+
+        template <typename Key, typename Value, typename Hash, typename Equal>
+        void swap(
+            FlatHashMap<Key, Value, Hash, Equal>& left,
+            FlatHashMap<Key, Value, Hash, Equal>& right) noexcept {
+            left.swap(right);
+        }
+
+        template <typename Key, typename Hash, typename Equal>
+        void swap(
+            FlatHashSet<Key, Hash, Equal>& left, FlatHashSet<Key, Hash, Equal>& right) noexcept {
+            left.swap(right);
+        }
+    } // namespace Containers
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_FLATHASHMAP_HPP
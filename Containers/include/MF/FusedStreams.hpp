@@ -0,0 +1,1444 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_FUSEDSTREAMS_HPP
+#define MFRANCESCHI_CPPLIBRARIES_FUSEDSTREAMS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "MF/Optionals.hpp"
+#include "MF/WorkStealingPool.hpp"
+
+namespace MF
+{
+    namespace Containers
+    {
+        /**
+         * Same vocabulary as the streams of "MF/Streams.hpp", but the stages are template types:
+         * each stage holds the previous one and its functor by value, and passes the elements to
+         * the next one through a lambda. The compiler sees the whole chain and fuses it into one
+         * loop, without std::function, virtual call nor allocation.
+         * Usage: @code
+         * auto result = FusedStreams::fromCollection(vec).filter(isEven).map(invert).size();
+         * @endcode
+         * A stream is a plain value: it can be copied, stored and returned, and every operation
+         * returns a new stream. It only refers to its source collection when the collection was
+         * given as an lvalue, and then must not outlive it.
+         * The functors are called as const, and from the calling thread, unless the stream is
+         * parallel.
+         *
+         * A stream whose source is random access can be made "parallel": the source is then
+         * split into chunks of "grainSize" elements, which run through the stages on the threads
+         * of WorkStealingPool::getDefault(). The terminal operations compute one result per chunk
+         * and merge them in the order of the chunks, so the results are the sequential ones.
+         * The functors are then called concurrently, and must be thread-safe.
+         */
+        namespace FusedStreams
+        {
+            template <typename Stage>
+            class FusedStream;
+
+            constexpr std::size_t DEFAULT_GRAIN_SIZE = 16 * 1024;
+
+            /// Result of "getKnownSize()" when the size is only known by browsing the stream.
+            constexpr std::size_t UNKNOWN_SIZE = std::numeric_limits<std::size_t>::max();
+
+            namespace detail
+            {
+                // A stage has a "value_type", and a "forEach(sink)" const member function which
+                // calls "sink" with each element, as an lvalue or an rvalue of "value_type".
+                // The sink returns false to stop, and then "forEach" returns false too.
+                // "getKnownSize()" gives the number of elements when it is known without browsing
+                // them, else UNKNOWN_SIZE.
+                // When "IsRandomAccess_t" is true, it also has "getSourceSize()" and
+                // "forEachInRange(begin, end, sink)", which only browses the elements coming
+                // from the source elements [begin, end).
+
+                template <typename Iterator>
+                using IsRandomAccessIterator_t = std::is_base_of<
+                    std::random_access_iterator_tag,
+                    typename std::iterator_traits<Iterator>::iterator_category>;
+
+                template <typename Iterator>
+                struct RangeStage {
+                    using value_type = typename std::iterator_traits<Iterator>::value_type;
+                    using IsRandomAccess_t = IsRandomAccessIterator_t<Iterator>;
+
+                    Iterator first;
+                    Iterator last;
+
+                    template <typename Sink>
+                    bool forEach(Sink& sink) const {
+                        for (Iterator it = first; it != last; ++it) {
+                            if (!sink(*it)) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                    std::size_t getKnownSize() const {
+                        return getKnownSize(IsRandomAccess_t());
+                    }
+
+                    std::size_t getSourceSize() const {
+                        return static_cast<std::size_t>(last - first);
+                    }
+
+                    template <typename Sink>
+                    bool forEachInRange(std::size_t begin, std::size_t end, Sink& sink) const {
+                        for (Iterator it = first + begin; it != first + end; ++it) {
+                            if (!sink(*it)) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                   private:
+                    std::size_t getKnownSize(std::true_type) const {
+                        return getSourceSize();
+                    }
+
+                    std::size_t getKnownSize(std::false_type) const {
+                        return UNKNOWN_SIZE;
+                    }
+                };
+
+                template <typename Collection>
+                auto getCollectionSize(const Collection& collection, int)
+                    -> decltype(static_cast<std::size_t>(collection.size())) {
+                    return static_cast<std::size_t>(collection.size());
+                }
+
+                /// For the collections without "size()", like std::forward_list.
+                template <typename Collection>
+                std::size_t getCollectionSize(const Collection&, long) {
+                    return UNKNOWN_SIZE;
+                }
+
+                /// "Collection" is either a const lvalue reference, or an owned collection.
+                template <typename Collection>
+                struct CollectionStage {
+                    using value_type = typename std::decay_t<Collection>::value_type;
+                    using IsRandomAccess_t = IsRandomAccessIterator_t<
+                        typename std::decay_t<Collection>::const_iterator>;
+
+                    Collection collection;
+
+                    template <typename Sink>
+                    bool forEach(Sink& sink) const {
+                        for (const auto& element : collection) {
+                            if (!sink(element)) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                    std::size_t getKnownSize() const {
+                        return getCollectionSize(collection, 0);
+                    }
+
+                    std::size_t getSourceSize() const {
+                        return collection.size();
+                    }
+
+                    template <typename Sink>
+                    bool forEachInRange(std::size_t begin, std::size_t end, Sink& sink) const {
+                        const auto first = collection.cbegin();
+                        for (auto it = first + begin; it != first + end; ++it) {
+                            if (!sink(*it)) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+                };
+
+                template <typename Previous, typename Predicate>
+                struct FilterStage {
+                    using value_type = typename Previous::value_type;
+                    using IsRandomAccess_t = typename Previous::IsRandomAccess_t;
+
+                    Previous previous;
+                    Predicate predicate;
+
+                    template <typename Sink>
+                    bool forEach(Sink& sink) const {
+                        auto filteringSink = makeSink(sink);
+                        return previous.forEach(filteringSink);
+                    }
+
+                    std::size_t getKnownSize() const {
+                        return UNKNOWN_SIZE;
+                    }
+
+                    std::size_t getSourceSize() const {
+                        return previous.getSourceSize();
+                    }
+
+                    template <typename Sink>
+                    bool forEachInRange(std::size_t begin, std::size_t end, Sink& sink) const {
+                        auto filteringSink = makeSink(sink);
+                        return previous.forEachInRange(begin, end, filteringSink);
+                    }
+
+                   private:
+                    template <typename Sink>
+                    auto makeSink(Sink& sink) const {
+                        const Predicate& thePredicate = predicate;
+                        return [&thePredicate, &sink](auto&& element) {
+                            if (thePredicate(static_cast<const value_type&>(element))) {
+                                return sink(std::forward<decltype(element)>(element));
+                            }
+                            return true;
+                        };
+                    }
+                };
+
+                template <typename Previous, typename Target, typename Mapper>
+                struct MapStage {
+                    using value_type = Target;
+                    using IsRandomAccess_t = typename Previous::IsRandomAccess_t;
+
+                    Previous previous;
+                    Mapper mapper;
+
+                    template <typename Sink>
+                    bool forEach(Sink& sink) const {
+                        auto mappingSink = makeSink(sink);
+                        return previous.forEach(mappingSink);
+                    }
+
+                    std::size_t getKnownSize() const {
+                        return previous.getKnownSize();
+                    }
+
+                    std::size_t getSourceSize() const {
+                        return previous.getSourceSize();
+                    }
+
+                    template <typename Sink>
+                    bool forEachInRange(std::size_t begin, std::size_t end, Sink& sink) const {
+                        auto mappingSink = makeSink(sink);
+                        return previous.forEachInRange(begin, end, mappingSink);
+                    }
+
+                   private:
+                    template <typename Sink>
+                    auto makeSink(Sink& sink) const {
+                        const Mapper& theMapper = mapper;
+                        return [&theMapper, &sink](auto&& element) {
+                            return sink(static_cast<Target>(
+                                theMapper(std::forward<decltype(element)>(element))));
+                        };
+                    }
+                };
+
+                /// Unbounded: "next(value)" gives the following value.
+                template <typename T, typename Next>
+                struct IterateStage {
+                    using value_type = T;
+                    using IsRandomAccess_t = std::false_type;
+
+                    T seed;
+                    Next next;
+
+                    template <typename Sink>
+                    bool forEach(Sink& sink) const {
+                        T value = seed;
+                        while (sink(static_cast<const T&>(value))) {
+                            value = next(static_cast<const T&>(value));
+                        }
+                        return false;
+                    }
+
+                    std::size_t getKnownSize() const {
+                        return UNKNOWN_SIZE;
+                    }
+                };
+
+                // The following stages depend on the order of the elements, so they and the
+                // stages after them always run sequentially.
+
+                template <typename Previous>
+                struct LimitStage {
+                    using value_type = typename Previous::value_type;
+                    using IsRandomAccess_t = std::false_type;
+
+                    Previous previous;
+                    std::size_t maxSize;
+
+                    template <typename Sink>
+                    bool forEach(Sink& sink) const {
+                        if (maxSize == 0) {
+                            return true;
+                        }
+                        const std::size_t theMaxSize = maxSize;
+                        std::size_t count = 0;
+                        bool sinkStopped = false;
+                        auto limitingSink = [theMaxSize, &count, &sinkStopped, &sink](
+                                                auto&& element) {
+                            if (!sink(std::forward<decltype(element)>(element))) {
+                                sinkStopped = true;
+                                return false;
+                            }
+                            return ++count < theMaxSize;
+                        };
+                        previous.forEach(limitingSink);
+                        return !sinkStopped;
+                    }
+
+                    std::size_t getKnownSize() const {
+                        const std::size_t previousSize = previous.getKnownSize();
+                        return previousSize == UNKNOWN_SIZE ? UNKNOWN_SIZE
+                                                            : std::min(previousSize, maxSize);
+                    }
+                };
+
+                template <typename Previous>
+                struct SkipStage {
+                    using value_type = typename Previous::value_type;
+                    using IsRandomAccess_t = std::false_type;
+
+                    Previous previous;
+                    std::size_t skippedCount;
+
+                    template <typename Sink>
+                    bool forEach(Sink& sink) const {
+                        std::size_t remaining = skippedCount;
+                        auto skippingSink = [&remaining, &sink](auto&& element) {
+                            if (remaining != 0) {
+                                remaining--;
+                                return true;
+                            }
+                            return sink(std::forward<decltype(element)>(element));
+                        };
+                        return previous.forEach(skippingSink);
+                    }
+
+                    std::size_t getKnownSize() const {
+                        const std::size_t previousSize = previous.getKnownSize();
+                        return previousSize == UNKNOWN_SIZE
+                                   ? UNKNOWN_SIZE
+                                   : previousSize - std::min(previousSize, skippedCount);
+                    }
+                };
+
+                template <typename Previous, typename Predicate>
+                struct TakeWhileStage {
+                    using value_type = typename Previous::value_type;
+                    using IsRandomAccess_t = std::false_type;
+
+                    Previous previous;
+                    Predicate predicate;
+
+                    template <typename Sink>
+                    bool forEach(Sink& sink) const {
+                        const Predicate& thePredicate = predicate;
+                        bool sinkStopped = false;
+                        auto takingSink = [&thePredicate, &sinkStopped, &sink](auto&& element) {
+                            if (!thePredicate(static_cast<const value_type&>(element))) {
+                                return false;
+                            }
+                            if (!sink(std::forward<decltype(element)>(element))) {
+                                sinkStopped = true;
+                                return false;
+                            }
+                            return true;
+                        };
+                        previous.forEach(takingSink);
+                        return !sinkStopped;
+                    }
+
+                    std::size_t getKnownSize() const {
+                        return UNKNOWN_SIZE;
+                    }
+                };
+
+                template <typename Previous, typename Predicate>
+                struct DropWhileStage {
+                    using value_type = typename Previous::value_type;
+                    using IsRandomAccess_t = std::false_type;
+
+                    Previous previous;
+                    Predicate predicate;
+
+                    template <typename Sink>
+                    bool forEach(Sink& sink) const {
+                        const Predicate& thePredicate = predicate;
+                        bool dropping = true;
+                        auto droppingSink = [&thePredicate, &dropping, &sink](auto&& element) {
+                            if (dropping) {
+                                if (thePredicate(static_cast<const value_type&>(element))) {
+                                    return true;
+                                }
+                                dropping = false;
+                            }
+                            return sink(std::forward<decltype(element)>(element));
+                        };
+                        return previous.forEach(droppingSink);
+                    }
+
+                    std::size_t getKnownSize() const {
+                        return UNKNOWN_SIZE;
+                    }
+                };
+
+                /// "Target" when given, else the decayed result type of "mapper(element)".
+                template <typename Target, typename Mapper, typename Source>
+                using MappedType_t = std::conditional_t<
+                    std::is_void<Target>::value,
+                    std::decay_t<decltype(std::declval<const std::decay_t<Mapper>&>()(
+                        std::declval<const Source&>()))>,
+                    Target>;
+
+                /**
+                 * Hash table used by the aggregating terminal operations: the entries are stored
+                 * contiguously, in insertion order, and an open addressing index with linear
+                 * probing refers to them. Each element updates its entry in place, and the
+                 * result is the vector of entries, without node allocation nor reordering.
+                 */
+                template <typename Key, typename Value, typename Hash, typename Equal>
+                class AggregationTable {
+                   public:
+                    using Entry_t = std::pair<Key, Value>;
+
+                    AggregationTable(const Hash& hash, const Equal& equal)
+                        : hash(hash), equal(equal) {
+                    }
+
+                    /// "create()" gives the value of a new key, else "update(value)" is called.
+                    template <typename KeyArgument, typename Create, typename Update>
+                    void aggregate(KeyArgument&& key, const Create& create, const Update& update) {
+                        // At most 1/4 full: the probes are rarely more than one.
+                        if (entries.size() * 4 >= slots.size()) {
+                            grow();
+                        }
+                        const std::uint64_t keyHash = mixHash(hash(key));
+                        const std::uint32_t tag = getTag(keyHash);
+                        const std::size_t mask = slots.size() - 1;
+                        for (auto position = static_cast<std::size_t>(keyHash);; position++) {
+                            Slot& slot = slots[position & mask];
+                            if (slot.tag == tag && equal(entries[slot.entry].first, key)) {
+                                update(entries[slot.entry].second);
+                                return;
+                            }
+                            if (slot.tag == 0) {
+                                entries.emplace_back(std::forward<KeyArgument>(key), create());
+                                slot.tag = tag;
+                                slot.entry = static_cast<std::uint32_t>(entries.size() - 1);
+                                return;
+                            }
+                        }
+                    }
+
+                    /// Adds the entries of "other" in their order, "merge(value, otherValue)".
+                    template <typename Merge>
+                    void mergeFrom(AggregationTable&& other, const Merge& merge) {
+                        for (auto& entry : other.entries) {
+                            aggregate(
+                                std::move(entry.first),
+                                [&entry]() { return std::move(entry.second); },
+                                [&entry, &merge](Value& value) {
+                                    merge(value, std::move(entry.second));
+                                });
+                        }
+                    }
+
+                    std::vector<Entry_t>& getEntries() {
+                        return entries;
+                    }
+
+                   private:
+                    struct Slot {
+                        /// High bits of the hash, never 0, or 0 for a free slot.
+                        std::uint32_t tag;
+                        std::uint32_t entry;
+                    };
+
+                    /// Spreads the identity hashes of the integers over the low bits.
+                    static std::uint64_t mixHash(std::size_t keyHash) {
+                        const std::uint64_t result = keyHash * 0x9E3779B97F4A7C15ULL;
+                        return result ^ (result >> 32);
+                    }
+
+                    static std::uint32_t getTag(std::uint64_t keyHash) {
+                        return static_cast<std::uint32_t>(keyHash >> 32) | 1U;
+                    }
+
+                    void grow() {
+                        if (entries.size() >= UINT32_MAX) {
+                            throw std::length_error("Too many keys to aggregate.");
+                        }
+                        slots.assign(std::max<std::size_t>(64, 2 * slots.size()), Slot{0, 0});
+                        const std::size_t mask = slots.size() - 1;
+                        for (std::size_t entry = 0; entry < entries.size(); entry++) {
+                            const std::uint64_t keyHash = mixHash(hash(entries[entry].first));
+                            auto position = static_cast<std::size_t>(keyHash);
+                            while (slots[position & mask].tag != 0) {
+                                position++;
+                            }
+                            slots[position & mask] = Slot{
+                                getTag(keyHash), static_cast<std::uint32_t>(entry)};
+                        }
+                    }
+
+                    Hash hash;
+                    Equal equal;
+                    std::vector<Entry_t> entries;
+                    std::vector<Slot> slots;
+                };
+
+                template <typename KeyFunction, typename Source>
+                using KeyType_t = std::decay_t<decltype(std::declval<const KeyFunction&>()(
+                    std::declval<const Source&>()))>;
+
+                /**
+                 * Runs a terminal operation: "accumulate(state, element)" is called with each
+                 * element, and returns false to stop. The states of the chunks are merged in
+                 * order with "merge(state, std::move(nextState))", up to the first chunk which
+                 * stopped: the following ones are skipped. Each chunk starts with the state
+                 * "makeIdentity()", so the states need not be copyable. Only the random access
+                 * stages can run in parallel.
+                 */
+                template <bool IsRandomAccess>
+                struct Evaluator {
+                    template <
+                        typename Stage,
+                        typename MakeIdentity,
+                        typename Accumulate,
+                        typename Merge,
+                        typename State = std::decay_t<decltype(std::declval<MakeIdentity&>()())>>
+                    static State evaluate(
+                        const Stage& stage,
+                        std::size_t,
+                        const MakeIdentity& makeIdentity,
+                        const Accumulate& accumulate,
+                        const Merge&) {
+                        State state = makeIdentity();
+                        auto accumulatingSink = [&state, &accumulate](auto&& element) {
+                            return accumulate(state, std::forward<decltype(element)>(element));
+                        };
+                        stage.forEach(accumulatingSink);
+                        return state;
+                    }
+                };
+
+                template <>
+                struct Evaluator<true> {
+                    template <
+                        typename Stage,
+                        typename MakeIdentity,
+                        typename Accumulate,
+                        typename Merge,
+                        typename State = std::decay_t<decltype(std::declval<MakeIdentity&>()())>>
+                    static State evaluate(
+                        const Stage& stage,
+                        std::size_t grainSize,
+                        const MakeIdentity& makeIdentity,
+                        const Accumulate& accumulate,
+                        const Merge& merge) {
+                        const std::size_t sourceSize = stage.getSourceSize();
+                        if (grainSize == 0 || sourceSize <= grainSize) {
+                            return Evaluator<false>::evaluate(
+                                stage, grainSize, makeIdentity, accumulate, merge);
+                        }
+
+                        // Also avoids the specialization of std::vector<bool>.
+                        struct ChunkState {
+                            State state;
+                            bool stopped;
+                        };
+                        const std::size_t chunksCount = (sourceSize + grainSize - 1) / grainSize;
+                        std::vector<ChunkState> states{};
+                        states.reserve(chunksCount);
+                        for (std::size_t chunk = 0; chunk < chunksCount; chunk++) {
+                            states.push_back(ChunkState{makeIdentity(), false});
+                        }
+                        std::atomic<std::size_t> firstStoppedChunk(chunksCount);
+                        WorkStealingPool::getDefault().parallelFor(
+                            chunksCount, [&](std::size_t chunk) {
+                                if (chunk > firstStoppedChunk.load(std::memory_order_relaxed)) {
+                                    return;
+                                }
+                                State& state = states[chunk].state;
+                                auto accumulatingSink = [&state, &accumulate](auto&& element) {
+                                    return accumulate(
+                                        state, std::forward<decltype(element)>(element));
+                                };
+                                const std::size_t begin = chunk * grainSize;
+                                const std::size_t end = std::min(begin + grainSize, sourceSize);
+                                if (stage.forEachInRange(begin, end, accumulatingSink)) {
+                                    return;
+                                }
+                                states[chunk].stopped = true;
+                                std::size_t stopped = firstStoppedChunk.load();
+                                while (chunk < stopped &&
+                                       !firstStoppedChunk.compare_exchange_weak(stopped, chunk)) {
+                                }
+                            });
+
+                        State result = std::move(states[0].state);
+                        for (std::size_t chunk = 1; chunk < chunksCount; chunk++) {
+                            if (states[chunk - 1].stopped) {
+                                break;
+                            }
+                            merge(result, std::move(states[chunk].state));
+                        }
+                        return result;
+                    }
+                };
+
+                template <typename Stage, typename Allocator>
+                std::vector<typename Stage::value_type, Allocator> collect(
+                    const Stage& stage, std::size_t grainSize, const Allocator& allocator) {
+                    using Vector_t = std::vector<typename Stage::value_type, Allocator>;
+                    const std::size_t knownSize = stage.getKnownSize();
+                    // In parallel, the chunks have at most "grainSize" elements. The stages without
+                    // random access are evaluated sequentially, in a single chunk.
+                    const bool isChunked = grainSize != 0 && Stage::IsRandomAccess_t::value;
+                    const std::size_t chunkCapacity =
+                        isChunked ? std::min(knownSize, grainSize) : knownSize;
+                    return Evaluator<Stage::IsRandomAccess_t::value>::evaluate(
+                        stage,
+                        grainSize,
+                        [&allocator, knownSize, chunkCapacity]() {
+                            Vector_t result(allocator);
+                            if (knownSize != UNKNOWN_SIZE) {
+                                result.reserve(chunkCapacity);
+                            }
+                            return result;
+                        },
+                        [](Vector_t& result, auto&& element) {
+                            result.push_back(std::forward<decltype(element)>(element));
+                            return true;
+                        },
+                        [knownSize](Vector_t& result, Vector_t&& next) {
+                            if (knownSize != UNKNOWN_SIZE && result.capacity() < knownSize) {
+                                result.reserve(knownSize);
+                            }
+                            result.insert(
+                                result.end(), std::make_move_iterator(next.begin()),
+                                std::make_move_iterator(next.end()));
+                        });
+                }
+
+                /**
+                 * Stable merge sort: the runs of "grainSize" elements are sorted, then merged two
+                 * by two, each step on the threads of WorkStealingPool::getDefault(). The last
+                 * merges have less parallelism, as there are fewer runs.
+                 */
+                template <typename T, typename Compare>
+                void sortValues(
+                    std::vector<T>& values, const Compare& compare, std::size_t grainSize) {
+                    const std::size_t size = values.size();
+                    if (grainSize == 0 || size <= grainSize) {
+                        std::stable_sort(values.begin(), values.end(), compare);
+                        return;
+                    }
+
+                    WorkStealingPool& pool = WorkStealingPool::getDefault();
+                    const auto first = values.begin();
+                    pool.parallelFor((size + grainSize - 1) / grainSize, [&](std::size_t run) {
+                        const std::size_t begin = run * grainSize;
+                        std::stable_sort(
+                            first + begin, first + std::min(begin + grainSize, size), compare);
+                    });
+                    for (std::size_t width = grainSize; width < size; width *= 2) {
+                        const std::size_t pairsCount = (size + 2 * width - 1) / (2 * width);
+                        pool.parallelFor(pairsCount, [&](std::size_t pair) {
+                            const std::size_t begin = pair * 2 * width;
+                            std::inplace_merge(
+                                first + begin,
+                                first + std::min(begin + width, size),
+                                first + std::min(begin + 2 * width, size),
+                                compare);
+                        });
+                    }
+                }
+
+                template <typename T>
+                using IsRadixSortable_t = std::integral_constant<
+                    bool,
+                    std::is_integral<T>::value && !std::is_same<T, bool>::value>;
+
+                /**
+                 * The integers in their natural order: LSD radix sort, one byte per pass, and the
+                 * passes where all the elements have the same byte are skipped. Sequential: it
+                 * already sorts faster than the merge sort on several threads.
+                 */
+                template <typename T>
+                std::enable_if_t<IsRadixSortable_t<T>::value> sortValues(
+                    std::vector<T>& values, const std::less<>& compare, std::size_t) {
+                    constexpr std::size_t MIN_RADIX_SIZE = 1024;
+                    if (values.size() < MIN_RADIX_SIZE) {
+                        std::sort(values.begin(), values.end(), compare);
+                        return;
+                    }
+
+                    using Unsigned_t = std::make_unsigned_t<T>;
+                    // The sign bit is flipped, so that the negative values come first.
+                    const auto signFlip = static_cast<Unsigned_t>(
+                        std::is_signed<T>::value ? Unsigned_t(1) << (sizeof(T) * 8 - 1) : 0);
+                    std::vector<T> buffer(values.size());
+                    T* source = values.data();
+                    T* target = buffer.data();
+                    const std::size_t size = values.size();
+                    for (std::size_t shift = 0; shift < sizeof(T) * 8; shift += 8) {
+                        const auto getDigit = [signFlip, shift](T value) {
+                            return static_cast<std::size_t>(
+                                (static_cast<Unsigned_t>(static_cast<Unsigned_t>(value) ^ signFlip)
+                                 >> shift)
+                                & 0xFF);
+                        };
+                        std::size_t offsets[256] = {};
+                        for (std::size_t i = 0; i < size; i++) {
+                            offsets[getDigit(source[i])]++;
+                        }
+                        if (offsets[getDigit(source[0])] == size) {
+                            continue;
+                        }
+                        std::size_t offset = 0;
+                        for (std::size_t& digitOffset : offsets) {
+                            const std::size_t count = digitOffset;
+                            digitOffset = offset;
+                            offset += count;
+                        }
+                        for (std::size_t i = 0; i < size; i++) {
+                            target[offsets[getDigit(source[i])]++] = source[i];
+                        }
+                        std::swap(source, target);
+                    }
+                    if (source != values.data()) {
+                        std::copy(source, source + size, values.data());
+                    }
+                }
+
+                template <typename Compare>
+                struct ReversedCompare {
+                    Compare compare;
+
+                    template <typename T>
+                    bool operator()(const T& left, const T& right) const {
+                        return compare(right, left);
+                    }
+                };
+
+                /**
+                 * The first "maxSize" elements of the stable sort of the pushed ones, in a heap
+                 * whose top is the last of them: the other elements are dropped as they come.
+                 */
+                template <typename T, typename Compare>
+                class BoundedHeap {
+                   public:
+                    BoundedHeap(std::size_t maxSize, const Compare& compare)
+                        : maxSize(maxSize), compare(compare) {
+                    }
+
+                    template <typename Value>
+                    void push(Value&& value) {
+                        // Most elements are dropped once the heap is full: first check that.
+                        if (entries.size() == maxSize
+                            && (maxSize == 0 || !compare(value, entries.front().value))) {
+                            return;
+                        }
+                        pushEntry(std::forward<Value>(value), keptCount);
+                    }
+
+                    /// The elements of "other" come after the ones pushed in this heap.
+                    void mergeFrom(BoundedHeap&& other) {
+                        const std::uint64_t firstSequence = keptCount;
+                        for (Entry& entry : other.entries) {
+                            pushEntry(std::move(entry.value), firstSequence + entry.sequence);
+                        }
+                        keptCount = firstSequence + other.keptCount;
+                    }
+
+                    std::vector<T> takeSorted() {
+                        std::sort_heap(entries.begin(), entries.end(), makeEntryCompare());
+                        std::vector<T> result{};
+                        result.reserve(entries.size());
+                        for (Entry& entry : entries) {
+                            result.push_back(std::move(entry.value));
+                        }
+                        entries.clear();
+                        return result;
+                    }
+
+                   private:
+                    struct Entry {
+                        T value;
+                        /// Order of arrival among the kept elements, which breaks the ties.
+                        std::uint64_t sequence;
+                    };
+
+                    /// Whether (value, sequence) comes before "entry" in the stable sort.
+                    bool isBefore(
+                        const T& value, std::uint64_t sequence, const Entry& entry) const {
+                        if (compare(value, entry.value)) {
+                            return true;
+                        }
+                        return !compare(entry.value, value) && sequence < entry.sequence;
+                    }
+
+                    auto makeEntryCompare() const {
+                        return [this](const Entry& left, const Entry& right) {
+                            return isBefore(left.value, left.sequence, right);
+                        };
+                    }
+
+                    template <typename Value>
+                    void pushEntry(Value&& value, std::uint64_t sequence) {
+                        keptCount = std::max(keptCount, sequence + 1);
+                        if (entries.size() < maxSize) {
+                            entries.push_back(Entry{std::forward<Value>(value), sequence});
+                            std::push_heap(entries.begin(), entries.end(), makeEntryCompare());
+                        } else if (maxSize != 0 && isBefore(value, sequence, entries.front())) {
+                            // The sequences break the ties: the merged entries do not come in
+                            // the order of their sequences.
+                            std::pop_heap(entries.begin(), entries.end(), makeEntryCompare());
+                            entries.back() = Entry{std::forward<Value>(value), sequence};
+                            std::push_heap(entries.begin(), entries.end(), makeEntryCompare());
+                        }
+                    }
+
+                    std::size_t maxSize;
+                    Compare compare;
+                    std::vector<Entry> entries;
+                    /**
+                     * Counts the elements kept, even for a moment, rather than the pushed ones: a
+                     * counter updated on each push would slow down the dropping of the others.
+                     */
+                    std::uint64_t keptCount = 0;
+                };
+
+                // The sorting stages pull all the elements of the previous stage, in parallel when
+                // the stream is, before giving the first one.
+
+                template <typename Previous, typename Compare>
+                struct SortedStage {
+                    using value_type = typename Previous::value_type;
+                    using IsRandomAccess_t = std::false_type;
+
+                    Previous previous;
+                    Compare compare;
+                    std::size_t grainSize;
+
+                    template <typename Sink>
+                    bool forEach(Sink& sink) const {
+                        auto values = collect(previous, grainSize, std::allocator<value_type>());
+                        sortValues(values, compare, grainSize);
+                        for (auto& value : values) {
+                            if (!sink(std::move(value))) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                    std::size_t getKnownSize() const {
+                        return previous.getKnownSize();
+                    }
+                };
+
+                template <typename Previous, typename Compare>
+                struct BottomKStage {
+                    using value_type = typename Previous::value_type;
+                    using IsRandomAccess_t = std::false_type;
+
+                    Previous previous;
+                    std::size_t maxSize;
+                    Compare compare;
+                    std::size_t grainSize;
+
+                    template <typename Sink>
+                    bool forEach(Sink& sink) const {
+                        using Heap_t = BoundedHeap<value_type, Compare>;
+                        const std::size_t theMaxSize = maxSize;
+                        const Compare& theCompare = compare;
+                        auto heap = Evaluator<Previous::IsRandomAccess_t::value>::evaluate(
+                            previous,
+                            grainSize,
+                            [theMaxSize, &theCompare]() { return Heap_t(theMaxSize, theCompare); },
+                            [](Heap_t& theHeap, auto&& element) {
+                                theHeap.push(std::forward<decltype(element)>(element));
+                                return true;
+                            },
+                            [](Heap_t& theHeap, Heap_t&& next) {
+                                theHeap.mergeFrom(std::move(next));
+                            });
+                        for (auto& value : heap.takeSorted()) {
+                            if (!sink(std::move(value))) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+
+                    std::size_t getKnownSize() const {
+                        const std::size_t previousSize = previous.getKnownSize();
+                        return previousSize == UNKNOWN_SIZE ? UNKNOWN_SIZE
+                                                            : std::min(previousSize, maxSize);
+                    }
+                };
+            } // namespace detail
+
+            template <typename Stage>
+            class FusedStream {
+               public:
+                using value_type = typename Stage::value_type;
+
+                /// "grainSize" is 0 for a sequential stream.
+                explicit FusedStream(Stage stage, std::size_t grainSize = 0)
+                    : stage(std::move(stage)), grainSize(grainSize) {
+                }
+
+                // ----- STAGES: they copy this stream, or move it when it is an rvalue.
+
+                template <typename Predicate>
+                auto filter(Predicate&& predicate) const& {
+                    return makeFilter<detail::FilterStage>(
+                        stage, std::forward<Predicate>(predicate));
+                }
+
+                template <typename Predicate>
+                auto filter(Predicate&& predicate) && {
+                    return makeFilter<detail::FilterStage>(
+                        std::move(stage), std::forward<Predicate>(predicate));
+                }
+
+                /// "Target" may be omitted to use the result type of "mapper".
+                template <typename Target = void, typename Mapper>
+                auto map(Mapper&& mapper) const& {
+                    return makeMap<Target>(stage, std::forward<Mapper>(mapper));
+                }
+
+                template <typename Target = void, typename Mapper>
+                auto map(Mapper&& mapper) && {
+                    return makeMap<Target>(std::move(stage), std::forward<Mapper>(mapper));
+                }
+
+                // ----- ORDER DEPENDENT STAGES: they and the next ones run sequentially.
+
+                /// Stops pulling elements after the first "maxSize" ones.
+                FusedStream<detail::LimitStage<Stage>> limit(std::size_t maxSize) const& {
+                    return makeStage<detail::LimitStage<Stage>>(stage, maxSize);
+                }
+
+                FusedStream<detail::LimitStage<Stage>> limit(std::size_t maxSize) && {
+                    return makeStage<detail::LimitStage<Stage>>(std::move(stage), maxSize);
+                }
+
+                FusedStream<detail::SkipStage<Stage>> skip(std::size_t count) const& {
+                    return makeStage<detail::SkipStage<Stage>>(stage, count);
+                }
+
+                FusedStream<detail::SkipStage<Stage>> skip(std::size_t count) && {
+                    return makeStage<detail::SkipStage<Stage>>(std::move(stage), count);
+                }
+
+                /// Stops pulling elements at the first one which does not match.
+                template <typename Predicate>
+                auto takeWhile(Predicate&& predicate) const& {
+                    return makeFilter<detail::TakeWhileStage>(
+                        stage, std::forward<Predicate>(predicate));
+                }
+
+                template <typename Predicate>
+                auto takeWhile(Predicate&& predicate) && {
+                    return makeFilter<detail::TakeWhileStage>(
+                        std::move(stage), std::forward<Predicate>(predicate));
+                }
+
+                template <typename Predicate>
+                auto dropWhile(Predicate&& predicate) const& {
+                    return makeFilter<detail::DropWhileStage>(
+                        stage, std::forward<Predicate>(predicate));
+                }
+
+                template <typename Predicate>
+                auto dropWhile(Predicate&& predicate) && {
+                    return makeFilter<detail::DropWhileStage>(
+                        std::move(stage), std::forward<Predicate>(predicate));
+                }
+
+                // ----- SORTING STAGES: they pull all the elements before giving the first one,
+                // then run sequentially. They compare with "compare(left, right)", which is a
+                // "less than", and keep the order of the equal elements.
+
+                /**
+                 * Parallel merge sort when the stream is parallel, and radix sort for the
+                 * integers in their natural order (without "compare").
+                 */
+                template <typename Compare = std::less<>>
+                auto sorted(Compare&& compare = Compare()) const& {
+                    return makeStage<detail::SortedStage<Stage, std::decay_t<Compare>>>(
+                        stage, std::forward<Compare>(compare), grainSize);
+                }
+
+                template <typename Compare = std::less<>>
+                auto sorted(Compare&& compare = Compare()) && {
+                    return makeStage<detail::SortedStage<Stage, std::decay_t<Compare>>>(
+                        std::move(stage), std::forward<Compare>(compare), grainSize);
+                }
+
+                /**
+                 * The first "count" elements of sorted(compare), in that order, but only
+                 * "count" elements are kept at a time (per chunk in parallel), in a heap.
+                 */
+                template <typename Compare = std::less<>>
+                auto bottomK(std::size_t count, Compare&& compare = Compare()) const& {
+                    return makeStage<detail::BottomKStage<Stage, std::decay_t<Compare>>>(
+                        stage, count, std::forward<Compare>(compare), grainSize);
+                }
+
+                template <typename Compare = std::less<>>
+                auto bottomK(std::size_t count, Compare&& compare = Compare()) && {
+                    return makeStage<detail::BottomKStage<Stage, std::decay_t<Compare>>>(
+                        std::move(stage), count, std::forward<Compare>(compare), grainSize);
+                }
+
+                /**
+                 * The first "count" elements of the stable sort by the reversed compare: the
+                 * greatest first, and equal elements in stream order.
+                 */
+                template <typename Compare = std::less<>>
+                auto topK(std::size_t count, Compare&& compare = Compare()) const& {
+                    return bottomK(
+                        count,
+                        detail::ReversedCompare<std::decay_t<Compare>>{
+                            std::forward<Compare>(compare)});
+                }
+
+                template <typename Compare = std::less<>>
+                auto topK(std::size_t count, Compare&& compare = Compare()) && {
+                    return std::move(*this).bottomK(
+                        count,
+                        detail::ReversedCompare<std::decay_t<Compare>>{
+                            std::forward<Compare>(compare)});
+                }
+
+                // ----- EXECUTION: the following stages keep it.
+
+                /// @throws std::invalid_argument if "grainSize" is 0.
+                FusedStream parallel(std::size_t grainSize = DEFAULT_GRAIN_SIZE) const& {
+                    return FusedStream(stage, checkGrainSize(grainSize));
+                }
+
+                FusedStream parallel(std::size_t grainSize = DEFAULT_GRAIN_SIZE) && {
+                    return FusedStream(std::move(stage), checkGrainSize(grainSize));
+                }
+
+                FusedStream sequential() const& {
+                    return FusedStream(stage);
+                }
+
+                FusedStream sequential() && {
+                    return FusedStream(std::move(stage));
+                }
+
+                bool isParallel() const {
+                    return grainSize != 0;
+                }
+
+                std::size_t getGrainSize() const {
+                    return grainSize;
+                }
+
+                /// The number of elements if it is known without browsing them, else UNKNOWN_SIZE.
+                std::size_t getKnownSize() const {
+                    return stage.getKnownSize();
+                }
+
+                // ----- TERMINAL OPERATIONS
+
+                /// In parallel, "elementProcessor" is called concurrently and in no order.
+                template <typename ElementProcessor>
+                void browse(ElementProcessor&& elementProcessor) const {
+                    struct Nothing {};
+                    evaluate(
+                        Nothing{},
+                        [&elementProcessor](Nothing&, auto&& element) {
+                            elementProcessor(std::forward<decltype(element)>(element));
+                            return true;
+                        },
+                        [](Nothing&, Nothing&&) {});
+                }
+
+                /**
+                 * The result is reserved up front when the size of the stream is known without
+                 * browsing it: a source of known size, followed by maps, limits and skips only.
+                 * The elements given as rvalues (made by a map, or from a std::move_iterator) are
+                 * moved into it, so "value_type" may be move-only, like std::unique_ptr.
+                 */
+                template <typename Allocator = std::allocator<value_type>>
+                std::vector<value_type, Allocator> collectToVector(
+                    const Allocator& allocator = Allocator()) const {
+                    return detail::collect(stage, grainSize, allocator);
+                }
+
+                std::size_t size() const {
+                    return evaluate(
+                        std::size_t(0),
+                        [](std::size_t& result, const value_type&) {
+                            result++;
+                            return true;
+                        },
+                        [](std::size_t& result, std::size_t next) { result += next; });
+                }
+
+                /**
+                 * Folds the elements with "accumulator(result, element)", starting from
+                 * "identity". In parallel, each chunk starts from "identity", and the results of
+                 * the chunks are folded in order with "accumulator" too: it must be associative,
+                 * and "identity" must be neutral.
+                 */
+                template <typename Accumulator>
+                value_type reduce(value_type identity, const Accumulator& accumulator) const {
+                    return evaluate(
+                        std::move(identity),
+                        [&accumulator](value_type& result, auto&& element) {
+                            result = accumulator(
+                                std::move(result), std::forward<decltype(element)>(element));
+                            return true;
+                        },
+                        [&accumulator](value_type& result, value_type&& next) {
+                            result = accumulator(std::move(result), std::move(next));
+                        });
+                }
+
+                // ----- AGGREGATING TERMINAL OPERATIONS
+                // The elements are aggregated by key in a hash table while they are streamed.
+                // The entries come in the order of the first occurrence of their key, also in
+                // parallel: each chunk fills its own table, and the tables are merged in order.
+                // "hash" and "equal" apply to the keys.
+
+                /// The elements grouped by "keyFunction(element)", in their order.
+                template <
+                    typename KeyFunction,
+                    typename Key = detail::KeyType_t<KeyFunction, value_type>,
+                    typename Hash = std::hash<Key>,
+                    typename Equal = std::equal_to<Key>>
+                std::vector<std::pair<Key, std::vector<value_type>>> groupBy(
+                    const KeyFunction& keyFunction,
+                    const Hash& hash = Hash(),
+                    const Equal& equal = Equal()) const {
+                    using Group_t = std::vector<value_type>;
+                    return aggregate<Key, Group_t>(
+                        keyFunction, hash, equal,
+                        [](auto&& element) {
+                            Group_t group{};
+                            group.push_back(std::forward<decltype(element)>(element));
+                            return group;
+                        },
+                        [](Group_t& group, auto&& element) {
+                            group.push_back(std::forward<decltype(element)>(element));
+                        },
+                        [](Group_t& group, Group_t&& next) {
+                            group.insert(
+                                group.end(), std::make_move_iterator(next.begin()),
+                                std::make_move_iterator(next.end()));
+                        });
+                }
+
+                /// The number of elements for each "keyFunction(element)".
+                template <
+                    typename KeyFunction,
+                    typename Key = detail::KeyType_t<KeyFunction, value_type>,
+                    typename Hash = std::hash<Key>,
+                    typename Equal = std::equal_to<Key>>
+                std::vector<std::pair<Key, std::size_t>> countBy(
+                    const KeyFunction& keyFunction,
+                    const Hash& hash = Hash(),
+                    const Equal& equal = Equal()) const {
+                    return aggregate<Key, std::size_t>(
+                        keyFunction, hash, equal,
+                        [](const value_type&) { return std::size_t(1); },
+                        [](std::size_t& count, const value_type&) { count++; },
+                        [](std::size_t& count, std::size_t next) { count += next; });
+                }
+
+                /// The first occurrence of each element.
+                template <
+                    typename Hash = std::hash<value_type>,
+                    typename Equal = std::equal_to<value_type>>
+                std::vector<value_type> distinct(
+                    const Hash& hash = Hash(), const Equal& equal = Equal()) const {
+                    struct Nothing {};
+                    auto entries = aggregate<value_type, Nothing>(
+                        [](const value_type& element) -> const value_type& { return element; },
+                        hash, equal, [](const value_type&) { return Nothing{}; },
+                        [](Nothing&, const value_type&) {}, [](Nothing&, Nothing&&) {});
+                    std::vector<value_type> result{};
+                    result.reserve(entries.size());
+                    for (auto& entry : entries) {
+                        result.push_back(std::move(entry.first));
+                    }
+                    return result;
+                }
+
+                /// Like "reduce", for each "keyFunction(element)".
+                template <
+                    typename KeyFunction,
+                    typename Accumulator,
+                    typename Key = detail::KeyType_t<KeyFunction, value_type>,
+                    typename Hash = std::hash<Key>,
+                    typename Equal = std::equal_to<Key>>
+                std::vector<std::pair<Key, value_type>> reduceBy(
+                    const KeyFunction& keyFunction,
+                    const value_type& identity,
+                    const Accumulator& accumulator,
+                    const Hash& hash = Hash(),
+                    const Equal& equal = Equal()) const {
+                    return aggregate<Key, value_type>(
+                        keyFunction, hash, equal,
+                        [&identity, &accumulator](auto&& element) -> value_type {
+                            return accumulator(
+                                identity, std::forward<decltype(element)>(element));
+                        },
+                        [&accumulator](value_type& result, auto&& element) {
+                            result = accumulator(
+                                std::move(result), std::forward<decltype(element)>(element));
+                        },
+                        [&accumulator](value_type& result, value_type&& next) {
+                            result = accumulator(std::move(result), std::move(next));
+                        });
+                }
+
+                /// @throws std::invalid_argument if two elements have the same key.
+                template <
+                    typename KeyFunction,
+                    typename ValueFunction,
+                    typename Key = detail::KeyType_t<KeyFunction, value_type>,
+                    typename Value = detail::KeyType_t<ValueFunction, value_type>>
+                std::unordered_map<Key, Value> toMap(
+                    const KeyFunction& keyFunction, const ValueFunction& valueFunction) const {
+                    const auto throwForDuplicate = [](Value&&, Value&&) -> Value {
+                        throw std::invalid_argument("Two elements have the same key.");
+                    };
+                    return toMap(
+                        keyFunction, valueFunction, throwForDuplicate, std::hash<Key>(),
+                        std::equal_to<Key>());
+                }
+
+                /// The values of the same key are merged with "merge(value, nextValue)".
+                template <
+                    typename KeyFunction,
+                    typename ValueFunction,
+                    typename Merge,
+                    typename Key = detail::KeyType_t<KeyFunction, value_type>,
+                    typename Value = detail::KeyType_t<ValueFunction, value_type>,
+                    typename Hash = std::hash<Key>,
+                    typename Equal = std::equal_to<Key>>
+                std::unordered_map<Key, Value, Hash, Equal> toMap(
+                    const KeyFunction& keyFunction,
+                    const ValueFunction& valueFunction,
+                    const Merge& merge,
+                    const Hash& hash = Hash(),
+                    const Equal& equal = Equal()) const {
+                    auto entries = aggregate<Key, Value>(
+                        keyFunction, hash, equal,
+                        [&valueFunction](auto&& element) -> Value {
+                            return valueFunction(std::forward<decltype(element)>(element));
+                        },
+                        [&valueFunction, &merge](Value& value, auto&& element) {
+                            value = merge(
+                                std::move(value),
+                                valueFunction(std::forward<decltype(element)>(element)));
+                        },
+                        [&merge](Value& value, Value&& next) {
+                            value = merge(std::move(value), std::move(next));
+                        });
+                    std::unordered_map<Key, Value, Hash, Equal> result(
+                        entries.size(), hash, equal);
+                    for (auto& entry : entries) {
+                        result.emplace(std::move(entry.first), std::move(entry.second));
+                    }
+                    return result;
+                }
+
+                // ----- SHORT-CIRCUITING TERMINAL OPERATIONS: they stop at the first answer.
+
+                /// A copy of the first element, or an empty optional.
+                Optionals::OptionalPtr<value_type> findFirst() const {
+                    using Result_t = Optionals::OptionalPtr<value_type>;
+                    return evaluate(
+                        Optionals::empty<value_type>(),
+                        [](Result_t& result, const value_type& element) {
+                            result = Optionals::ofLvalue(element);
+                            return false;
+                        },
+                        [](Result_t& result, Result_t&& next) { result = std::move(next); });
+                }
+
+                /// False for an empty stream.
+                template <typename Predicate>
+                bool anyMatch(const Predicate& predicate) const {
+                    return evaluate(
+                        false,
+                        [&predicate](bool& result, const value_type& element) {
+                            result = predicate(element);
+                            return !result;
+                        },
+                        [](bool& result, bool next) { result = next; });
+                }
+
+                /// True for an empty stream.
+                template <typename Predicate>
+                bool allMatch(const Predicate& predicate) const {
+                    return evaluate(
+                        true,
+                        [&predicate](bool& result, const value_type& element) {
+                            result = predicate(element);
+                            return result;
+                        },
+                        [](bool& result, bool next) { result = next; });
+                }
+
+                /// True for an empty stream.
+                template <typename Predicate>
+                bool noneMatch(const Predicate& predicate) const {
+                    return !anyMatch(predicate);
+                }
+
+               private:
+                static std::size_t checkGrainSize(std::size_t grainSize) {
+                    static_assert(
+                        Stage::IsRandomAccess_t::value,
+                        "Only the streams with a random access source, and without order "
+                        "dependent stage, can be parallel.");
+                    if (grainSize == 0) {
+                        throw std::invalid_argument("The grain size is 0.");
+                    }
+                    return grainSize;
+                }
+
+                template <typename State, typename Accumulate, typename Merge>
+                State evaluate(
+                    const State& identity, const Accumulate& accumulate, const Merge& merge) const {
+                    return evaluateFrom([&identity]() { return identity; }, accumulate, merge);
+                }
+
+                template <typename MakeIdentity, typename Accumulate, typename Merge>
+                auto evaluateFrom(
+                    const MakeIdentity& makeIdentity,
+                    const Accumulate& accumulate,
+                    const Merge& merge) const {
+                    return detail::Evaluator<Stage::IsRandomAccess_t::value>::evaluate(
+                        stage, grainSize, makeIdentity, accumulate, merge);
+                }
+
+                template <
+                    typename Key,
+                    typename Value,
+                    typename KeyFunction,
+                    typename Hash,
+                    typename Equal,
+                    typename Create,
+                    typename Update,
+                    typename Merge>
+                std::vector<std::pair<Key, Value>> aggregate(
+                    const KeyFunction& keyFunction,
+                    const Hash& hash,
+                    const Equal& equal,
+                    const Create& create,
+                    const Update& update,
+                    const Merge& merge) const {
+                    using Table_t = detail::AggregationTable<Key, Value, Hash, Equal>;
+                    auto table = evaluate(
+                        Table_t(hash, equal),
+                        [&keyFunction, &create, &update](Table_t& theTable, auto&& element) {
+                            theTable.aggregate(
+                                keyFunction(static_cast<const value_type&>(element)),
+                                [&create, &element]() {
+                                    return create(std::forward<decltype(element)>(element));
+                                },
+                                [&update, &element](Value& value) {
+                                    update(value, std::forward<decltype(element)>(element));
+                                });
+                            return true;
+                        },
+                        [&merge](Table_t& theTable, Table_t&& next) {
+                            theTable.mergeFrom(std::move(next), merge);
+                        });
+                    return std::move(table.getEntries());
+                }
+
+                template <typename NewStage, typename... Arguments>
+                FusedStream<NewStage> makeStage(Arguments&&... arguments) const {
+                    return FusedStream<NewStage>(
+                        NewStage{std::forward<Arguments>(arguments)...}, grainSize);
+                }
+
+                template <
+                    template <typename, typename> class NewStage,
+                    typename TheStage,
+                    typename Predicate>
+                auto makeFilter(TheStage&& theStage, Predicate&& predicate) const {
+                    return makeStage<NewStage<Stage, std::decay_t<Predicate>>>(
+                        std::forward<TheStage>(theStage), std::forward<Predicate>(predicate));
+                }
+
+                template <typename Target, typename TheStage, typename Mapper>
+                auto makeMap(TheStage&& theStage, Mapper&& mapper) const {
+                    using Target_t = detail::MappedType_t<Target, Mapper, value_type>;
+                    return makeStage<detail::MapStage<Stage, Target_t, std::decay_t<Mapper>>>(
+                        std::forward<TheStage>(theStage), std::forward<Mapper>(mapper));
+                }
+
+                Stage stage;
+                std::size_t grainSize;
+            };
+
+            /// The stream refers to "collection", which must outlive it.
+            template <typename Collection>
+            FusedStream<detail::CollectionStage<const Collection&>> fromCollection(
+                const Collection& collection) {
+                return FusedStream<detail::CollectionStage<const Collection&>>({collection});
+            }
+
+            /// The stream owns "collection", which is moved into it.
+            template <
+                typename Collection,
+                typename = std::enable_if_t<!std::is_lvalue_reference<Collection>::value>>
+            FusedStream<detail::CollectionStage<Collection>> fromCollection(
+                Collection&& collection) {
+                return FusedStream<detail::CollectionStage<Collection>>({std::move(collection)});
+            }
+
+            /// Unbounded stream: "seed", "next(seed)", "next(next(seed))"...
+            template <typename T, typename Next>
+            FusedStream<detail::IterateStage<T, std::decay_t<Next>>> iterate(
+                T seed, Next&& next) {
+                return FusedStream<detail::IterateStage<T, std::decay_t<Next>>>(
+                    {std::move(seed), std::forward<Next>(next)});
+            }
+
+            /**
+             * The stream refers to the elements, which must outlive it. With std::move_iterator,
+             * the elements are moved out of the range: the stream can then only be browsed once.
+             */
+            template <typename Iterator>
+            FusedStream<detail::RangeStage<Iterator>> fromRange(Iterator first, Iterator last) {
+                return FusedStream<detail::RangeStage<Iterator>>({first, last});
+            }
+        } // namespace FusedStreams
+    } // namespace Containers
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_FUSEDSTREAMS_HPP
@@ -0,0 +1,622 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_SMALLVECTOR_HPP
+#define MFRANCESCHI_CPPLIBRARIES_SMALLVECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace MF
+{
+    namespace Containers
+    {
+        /**
+         * Whether a "T" can be moved to another address by copying its bytes, without calling
+         * its move constructor nor its destructor. True for the trivially copyable types, and
+         * can be specialized for the others which do not point to themselves.
+         */
+        template <typename T>
+        struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+        template <typename T>
+        struct IsTriviallyRelocatable<std::unique_ptr<T>> : std::true_type {};
+
+        /**
+         * Vector with the interface of std::vector (without allocator), which keeps up to
+         * "N" elements inside itself, and only allocates on the heap beyond. The iterators are
+         * pointers. As with std::vector, they are invalidated by the growth of the capacity,
+         * but also by the moves of the vector while the elements are inline.
+         */
+        template <typename T, std::size_t N>
+        class SmallVector {
+            static_assert(N > 0, "Without inline elements, use a std::vector.");
+
+           public:
+            // ----- MEMBER TYPES ----- //
+            using value_type = T;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using reference = T&;
+            using const_reference = const T&;
+            using pointer = T*;
+            using const_pointer = const T*;
+            using iterator = T*;
+            using const_iterator = const T*;
+            using reverse_iterator = std::reverse_iterator<iterator>;
+            using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+            static constexpr std::size_t INLINE_CAPACITY = N;
+
+            // ----- MEMBER FUNCTIONS ----- //
+
+            // ----- Constructors & destructors
+            SmallVector() : elements(getInlineElements()), elementsCount(0), capacityValue(N) {
+            }
+
+            /// "count" value-initialized elements.
+            explicit SmallVector(std::size_t count) : SmallVector() {
+                resize(count);
+            }
+
+            SmallVector(std::size_t count, const T& value) : SmallVector() {
+                assign(count, value);
+            }
+
+            template <
+                typename InputIterator,
+                typename = std::enable_if_t<!std::is_integral<InputIterator>::value>>
+            SmallVector(InputIterator first, InputIterator last) : SmallVector() {
+                assign(first, last);
+            }
+
+            SmallVector(std::initializer_list<T> values) : SmallVector() {
+                assign(values.begin(), values.end());
+            }
+
+            SmallVector(const SmallVector& other) : SmallVector() {
+                assign(other.begin(), other.end());
+            }
+
+            /// Takes the heap storage of "other", else moves its inline elements.
+            SmallVector(SmallVector&& other) noexcept(
+                std::is_nothrow_move_constructible<T>::value)
+                : SmallVector() {
+                takeElements(other);
+            }
+
+            SmallVector& operator=(const SmallVector& other) {
+                if (this != &other) {
+                    assign(other.begin(), other.end());
+                }
+                return *this;
+            }
+
+            SmallVector& operator=(SmallVector&& other) noexcept(
+                std::is_nothrow_move_constructible<T>::value) {
+                if (this != &other) {
+                    clear();
+                    releaseHeapStorage();
+                    takeElements(other);
+                }
+                return *this;
+            }
+
+            SmallVector& operator=(std::initializer_list<T> values) {
+                assign(values.begin(), values.end());
+                return *this;
+            }
+
+            ~SmallVector() {
+                destroy(elements, elements + elementsCount);
+                releaseHeapStorage();
+            }
+
+            // ----- Member functions
+
+            void assign(std::size_t count, const T& value) {
+                // "value" may be one of the elements.
+                const T copy(value);
+                clear();
+                reserve(count);
+                std::uninitialized_fill_n(elements, count, copy);
+                elementsCount = count;
+            }
+
+            template <
+                typename InputIterator,
+                typename = std::enable_if_t<!std::is_integral<InputIterator>::value>>
+            void assign(InputIterator first, InputIterator last) {
+                clear();
+                insert(end(), first, last);
+            }
+
+            void assign(std::initializer_list<T> values) {
+                assign(values.begin(), values.end());
+            }
+
+            // ----- Element access
+
+            /// @throws std::out_of_range if "index" is not lower than size().
+            reference at(std::size_t index) {
+                checkIndex(index);
+                return elements[index];
+            }
+
+            const_reference at(std::size_t index) const {
+                checkIndex(index);
+                return elements[index];
+            }
+
+            reference operator[](std::size_t index) {
+                return elements[index];
+            }
+
+            const_reference operator[](std::size_t index) const {
+                return elements[index];
+            }
+
+            reference front() {
+                return elements[0];
+            }
+
+            const_reference front() const {
+                return elements[0];
+            }
+
+            reference back() {
+                return elements[elementsCount - 1];
+            }
+
+            const_reference back() const {
+                return elements[elementsCount - 1];
+            }
+
+            T* data() noexcept {
+                return elements;
+            }
+
+            const T* data() const noexcept {
+                return elements;
+            }
+
+            // ----- Iterators
+
+            iterator begin() noexcept {
+                return elements;
+            }
+
+            const_iterator begin() const noexcept {
+                return elements;
+            }
+
+            const_iterator cbegin() const noexcept {
+                return elements;
+            }
+
+            iterator end() noexcept {
+                return elements + elementsCount;
+            }
+
+            const_iterator end() const noexcept {
+                return elements + elementsCount;
+            }
+
+            const_iterator cend() const noexcept {
+                return end();
+            }
+
+            reverse_iterator rbegin() noexcept {
+                return reverse_iterator(end());
+            }
+
+            const_reverse_iterator rbegin() const noexcept {
+                return const_reverse_iterator(end());
+            }
+
+            const_reverse_iterator crbegin() const noexcept {
+                return rbegin();
+            }
+
+            reverse_iterator rend() noexcept {
+                return reverse_iterator(begin());
+            }
+
+            const_reverse_iterator rend() const noexcept {
+                return const_reverse_iterator(begin());
+            }
+
+            const_reverse_iterator crend() const noexcept {
+                return rend();
+            }
+
+            // ----- Capacity
+
+            bool empty() const noexcept {
+                return elementsCount == 0;
+            }
+
+            std::size_t size() const noexcept {
+                return elementsCount;
+            }
+
+            std::size_t max_size() const noexcept {
+                return std::numeric_limits<std::size_t>::max() / sizeof(T);
+            }
+
+            std::size_t capacity() const noexcept {
+                return capacityValue;
+            }
+
+            /// Whether the elements are inside the vector, rather than on the heap.
+            bool isInline() const noexcept {
+                return elements == getInlineElements();
+            }
+
+            void reserve(std::size_t newCapacity) {
+                if (newCapacity > capacityValue) {
+                    reallocate(newCapacity);
+                }
+            }
+
+            /// Moves the elements back inline when they fit.
+            void shrink_to_fit() {
+                if (isInline() || elementsCount == capacityValue) {
+                    return;
+                }
+                if (elementsCount <= N) {
+                    T* const heapElements = elements;
+                    const std::size_t heapCapacity = capacityValue;
+                    relocate(heapElements, heapElements + elementsCount, getInlineElements());
+                    elements = getInlineElements();
+                    capacityValue = N;
+                    std::allocator<T>().deallocate(heapElements, heapCapacity);
+                } else {
+                    reallocate(elementsCount);
+                }
+            }
+
+            // ----- Modifiers
+
+            /// Keeps the capacity.
+            void clear() noexcept {
+                destroy(elements, elements + elementsCount);
+                elementsCount = 0;
+            }
+
+            iterator insert(const_iterator position, const T& value) {
+                return emplace(position, value);
+            }
+
+            iterator insert(const_iterator position, T&& value) {
+                return emplace(position, std::move(value));
+            }
+
+            iterator insert(const_iterator position, std::size_t count, const T& value) {
+                const auto index = static_cast<std::size_t>(position - begin());
+                const T copy(value);
+                if (elementsCount + count > capacityValue) {
+                    reallocate(getGrownCapacity(elementsCount + count));
+                }
+                std::uninitialized_fill_n(end(), count, copy);
+                elementsCount += count;
+                std::rotate(begin() + index, end() - count, end());
+                return begin() + index;
+            }
+
+            /// The iterators must not point into this vector.
+            template <
+                typename InputIterator,
+                typename = std::enable_if_t<!std::is_integral<InputIterator>::value>>
+            iterator insert(const_iterator position, InputIterator first, InputIterator last) {
+                const auto index = static_cast<std::size_t>(position - begin());
+                const std::size_t oldSize = elementsCount;
+                reserveFor(
+                    first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+                std::rotate(begin() + index, begin() + oldSize, end());
+                return begin() + index;
+            }
+
+            iterator insert(const_iterator position, std::initializer_list<T> values) {
+                return insert(position, values.begin(), values.end());
+            }
+
+            template <typename... Arguments>
+            iterator emplace(const_iterator position, Arguments&&... arguments) {
+                const auto index = static_cast<std::size_t>(position - begin());
+                if (index == elementsCount) {
+                    emplace_back(std::forward<Arguments>(arguments)...);
+                    return begin() + index;
+                }
+                // The arguments may refer to the elements which are about to move.
+                T value(std::forward<Arguments>(arguments)...);
+                emplace_back(std::move(back()));
+                std::move_backward(begin() + index, end() - 2, end() - 1);
+                elements[index] = std::move(value);
+                return begin() + index;
+            }
+
+            iterator erase(const_iterator position) {
+                return erase(position, position + 1);
+            }
+
+            iterator erase(const_iterator first, const_iterator last) {
+                const auto index = static_cast<std::size_t>(first - begin());
+                const auto erasedCount = static_cast<std::size_t>(last - first);
+                if (erasedCount != 0) {
+                    T* const newEnd =
+                        std::move(begin() + index + erasedCount, end(), begin() + index);
+                    destroy(newEnd, end());
+                    elementsCount -= erasedCount;
+                }
+                return begin() + index;
+            }
+
+            void push_back(const T& value) {
+                emplace_back(value);
+            }
+
+            void push_back(T&& value) {
+                emplace_back(std::move(value));
+            }
+
+            template <typename... Arguments>
+            reference emplace_back(Arguments&&... arguments) {
+                if (elementsCount == capacityValue) {
+                    return emplaceBackWithGrowth(std::forward<Arguments>(arguments)...);
+                }
+                T* const element = elements + elementsCount;
+                ::new (static_cast<void*>(element)) T(std::forward<Arguments>(arguments)...);
+                elementsCount++;
+                return *element;
+            }
+
+            void pop_back() {
+                elementsCount--;
+                elements[elementsCount].~T();
+            }
+
+            /// The new elements are value-initialized.
+            void resize(std::size_t count) {
+                resizeWith(count, [](T* element) { ::new (static_cast<void*>(element)) T(); });
+            }
+
+            void resize(std::size_t count, const T& value) {
+                const T copy(value);
+                resizeWith(count, [&copy](T* element) {
+                    ::new (static_cast<void*>(element)) T(copy);
+                });
+            }
+
+            void swap(SmallVector& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+                if (!isInline() && !other.isInline()) {
+                    std::swap(elements, other.elements);
+                    std::swap(elementsCount, other.elementsCount);
+                    std::swap(capacityValue, other.capacityValue);
+                    return;
+                }
+                SmallVector moved(std::move(other));
+                other = std::move(*this);
+                *this = std::move(moved);
+            }
+
+            // ----- Operators
+
+            bool operator==(const SmallVector& other) const {
+                return elementsCount == other.elementsCount
+                       && std::equal(begin(), end(), other.begin());
+            }
+
+            bool operator!=(const SmallVector& other) const {
+                return !(*this == other);
+            }
+
+            bool operator<(const SmallVector& other) const {
+                return std::lexicographical_compare(begin(), end(), other.begin(), other.end());
+            }
+
+            bool operator>(const SmallVector& other) const {
+                return other < *this;
+            }
+
+            bool operator<=(const SmallVector& other) const {
+                return !(other < *this);
+            }
+
+            bool operator>=(const SmallVector& other) const {
+                return !(*this < other);
+            }
+
+           private:
+            T* getInlineElements() noexcept {
+                return reinterpret_cast<T*>(inlineStorage);
+            }
+
+            const T* getInlineElements() const noexcept {
+                return reinterpret_cast<const T*>(inlineStorage);
+            }
+
+            void checkIndex(std::size_t index) const {
+                if (index >= elementsCount) {
+                    throw std::out_of_range("The index is out of the SmallVector.");
+                }
+            }
+
+            static void destroy(T* first, T* last) noexcept {
+                if (!std::is_trivially_destructible<T>::value) {
+                    for (; first != last; ++first) {
+                        first->~T();
+                    }
+                }
+            }
+
+            /**
+             * Moves the elements to the uninitialized "target", and destroys them. Copies them
+             * instead when their move could throw, so that "[first, last)" is unchanged when
+             * it throws.
+             */
+            static void relocate(T* first, T* last, T* target) {
+                relocate(first, last, target, IsTriviallyRelocatable<T>());
+            }
+
+            static void relocate(T* first, T* last, T* target, std::true_type) noexcept {
+                if (first != last) {
+                    std::memcpy(
+                        static_cast<void*>(target),
+                        static_cast<const void*>(first),
+                        static_cast<std::size_t>(last - first) * sizeof(T));
+                }
+            }
+
+            static void relocate(T* first, T* last, T* target, std::false_type) {
+                using Move_t = std::integral_constant<
+                    bool,
+                    std::is_nothrow_move_constructible<T>::value
+                        || !std::is_copy_constructible<T>::value>;
+                relocateByConstruction(first, last, target, Move_t());
+                destroy(first, last);
+            }
+
+            static void relocateByConstruction(T* first, T* last, T* target, std::true_type) {
+                std::uninitialized_copy(
+                    std::make_move_iterator(first), std::make_move_iterator(last), target);
+            }
+
+            static void relocateByConstruction(T* first, T* last, T* target, std::false_type) {
+                std::uninitialized_copy(first, last, target);
+            }
+
+            std::size_t getGrownCapacity(std::size_t minCapacity) const {
+                return std::max(minCapacity, 2 * capacityValue);
+            }
+
+            void reallocate(std::size_t newCapacity) {
+                T* const newElements = std::allocator<T>().allocate(newCapacity);
+                try {
+                    relocate(elements, elements + elementsCount, newElements);
+                } catch (...) {
+                    std::allocator<T>().deallocate(newElements, newCapacity);
+                    throw;
+                }
+                releaseHeapStorage();
+                elements = newElements;
+                capacityValue = newCapacity;
+            }
+
+            /// The new element is built first, as the arguments may refer to the old ones.
+            template <typename... Arguments>
+            reference emplaceBackWithGrowth(Arguments&&... arguments) {
+                const std::size_t newCapacity = getGrownCapacity(elementsCount + 1);
+                T* const newElements = std::allocator<T>().allocate(newCapacity);
+                T* const element = newElements + elementsCount;
+                try {
+                    ::new (static_cast<void*>(element)) T(std::forward<Arguments>(arguments)...);
+                } catch (...) {
+                    std::allocator<T>().deallocate(newElements, newCapacity);
+                    throw;
+                }
+                try {
+                    relocate(elements, elements + elementsCount, newElements);
+                } catch (...) {
+                    element->~T();
+                    std::allocator<T>().deallocate(newElements, newCapacity);
+                    throw;
+                }
+                releaseHeapStorage();
+                elements = newElements;
+                capacityValue = newCapacity;
+                elementsCount++;
+                return *element;
+            }
+
+            template <typename ForwardIterator>
+            void reserveFor(
+                ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+                const auto count = static_cast<std::size_t>(std::distance(first, last));
+                if (elementsCount + count > capacityValue) {
+                    reallocate(getGrownCapacity(elementsCount + count));
+                }
+            }
+
+            /// The input iterators can be read only once.
+            template <typename InputIterator>
+            void reserveFor(InputIterator, InputIterator, std::input_iterator_tag) {
+            }
+
+            template <typename Construct>
+            void resizeWith(std::size_t count, const Construct& construct) {
+                if (count <= elementsCount) {
+                    destroy(elements + count, elements + elementsCount);
+                    elementsCount = count;
+                    return;
+                }
+                reserve(count);
+                for (; elementsCount < count; elementsCount++) {
+                    construct(elements + elementsCount);
+                }
+            }
+
+            /// "this" is empty and inline, "other" becomes so.
+            void takeElements(SmallVector& other) {
+                if (!other.isInline()) {
+                    elements = other.elements;
+                    capacityValue = other.capacityValue;
+                    other.elements = other.getInlineElements();
+                    other.capacityValue = N;
+                } else {
+                    relocateInline(other, IsTriviallyRelocatable<T>());
+                }
+                elementsCount = other.elementsCount;
+                other.elementsCount = 0;
+            }
+
+            void relocateInline(SmallVector& other, std::true_type) {
+                relocate(other.elements, other.elements + other.elementsCount, elements);
+            }
+
+            /// Moved even when the move could throw: the moved-from vector is lost anyway.
+            void relocateInline(SmallVector& other, std::false_type) {
+                T* const otherEnd = other.elements + other.elementsCount;
+                relocateByConstruction(other.elements, otherEnd, elements, std::true_type());
+                destroy(other.elements, otherEnd);
+            }
+
+            void releaseHeapStorage() noexcept {
+                if (!isInline()) {
+                    std::allocator<T>().deallocate(elements, capacityValue);
+                    elements = getInlineElements();
+                    capacityValue = N;
+                }
+            }
+
+            T* elements;
+            std::size_t elementsCount;
+            std::size_t capacityValue;
+            alignas(T) unsigned char inlineStorage[sizeof(T) * N];
+        };
+
+        template <typename T, std::size_t N>
+        constexpr std::size_t SmallVector<T, N>::INLINE_CAPACITY;
+
+        template <typename T, std::size_t N>
+        void swap(SmallVector<T, N>& left, SmallVector<T, N>& right) noexcept(
+            std::is_nothrow_move_constructible<T>::value) {
+            left.swap(right);
+        }
+    } // namespace Containers
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_SMALLVECTOR_HPP
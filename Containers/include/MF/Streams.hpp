@@ -22,6 +22,8 @@ namespace MF
 
         namespace Streams
         {
+            constexpr std::size_t UNKNOWN_SIZE = static_cast<std::size_t>(-1);
+
             template <typename T>
             using ElementProcessor_t = std::function<void(const T &)>;
 
@@ -58,6 +60,14 @@ namespace MF
 
             virtual void browse(const Streams::ElementProcessor_t<T> &elementProcessor) = 0;
 
+            /**
+             * The number of elements when it is known without browsing them, else UNKNOWN_SIZE.
+             * Not pure, so that the implementations outside of this library still compile.
+             */
+            virtual std::size_t getKnownSize() {
+                return Streams::UNKNOWN_SIZE;
+            }
+
             // virtual ~Stream() = default;
         };
 
@@ -83,8 +93,16 @@ namespace MF
                     return std::make_shared<StreamFromFilter<T>>(this, predicate);
                 }
 
+                std::size_t getKnownSize() override {
+                    return UNKNOWN_SIZE;
+                }
+
                 std::vector<T> collectToVector() override {
                     std::vector<T> result{};
+                    const std::size_t knownSize = this->getKnownSize();
+                    if (knownSize != UNKNOWN_SIZE) {
+                        result.reserve(knownSize);
+                    }
                     this->browse([&result](const T &element) {
                         result.push_back(element);
                     });
@@ -139,6 +157,10 @@ namespace MF
                     previous->browse(nestedElementProcessor);
                 }
 
+                std::size_t getKnownSize() override {
+                    return previous->getKnownSize();
+                }
+
                private:
                 Stream<Source> *const previous;
                 const _Mapper_t mapper;
@@ -151,13 +173,17 @@ namespace MF
                 }
 
                 std::vector<T> collectToVector() override {
-                    return std::vector<T>(collection);
+                    return std::vector<T>(collection.begin(), collection.end());
                 }
 
                 std::size_t size() override {
                     return collection.size();
                 }
 
+                std::size_t getKnownSize() override {
+                    return collection.size();
+                }
+
                 void browse(const Streams::ElementProcessor_t<T> &elementProcessor) override {
                     for (const auto &element : collection) {
                         elementProcessor(element);
@@ -0,0 +1,70 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_WORKSTEALINGPOOL_HPP
+#define MFRANCESCHI_CPPLIBRARIES_WORKSTEALINGPOOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MF
+{
+    namespace Containers
+    {
+        /**
+         * Threads running chunked loops. Each thread taking part in a loop starts with a
+         * contiguous range of chunks, and when it runs out of them, it steals the upper half of
+         * the biggest remaining range. Uneven chunks are balanced without a shared queue.
+         * The calling thread takes part in its loops, so loops can be nested, and a pool without
+         * worker runs them on the calling thread only.
+         */
+        class WorkStealingPool {
+           public:
+            explicit WorkStealingPool(std::size_t workersCount);
+
+            WorkStealingPool(const WorkStealingPool&) = delete;
+
+            WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+            /// Joins the workers. No loop may be running.
+            ~WorkStealingPool();
+
+            std::size_t getWorkersCount() const {
+                return workers.size();
+            }
+
+            /**
+             * Calls "chunkFunction" once with each index in [0, chunksCount), from the calling
+             * thread and from the free workers, and returns when all the calls are done.
+             * @throws The first exception thrown by "chunkFunction", once the running calls are
+             * done. The chunks which were not started are skipped.
+             */
+            void parallelFor(
+                std::size_t chunksCount, const std::function<void(std::size_t)>& chunkFunction);
+
+            /// Shared pool with one worker less than the hardware threads, created on first use.
+            static WorkStealingPool& getDefault();
+
+           private:
+            struct Job;
+
+            void runWorker();
+
+            std::mutex mutex;
+            std::condition_variable jobsAvailable;
+            /// The jobs which still have free places.
+            std::deque<std::shared_ptr<Job>> pendingJobs;
+            bool stopping = false;
+            std::vector<std::thread> workers;
+        };
+    } // namespace Containers
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_WORKSTEALINGPOOL_HPP
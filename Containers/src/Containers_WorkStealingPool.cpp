@@ -0,0 +1,193 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+#include "MF/WorkStealingPool.hpp"
+
+namespace MF
+{
+    namespace Containers
+    {
+        namespace
+        {
+            /// Chunks not started yet by one participant of a job.
+            struct ChunksRange {
+                std::mutex mutex;
+                std::size_t begin = 0;
+                std::size_t end = 0;
+            };
+        } // namespace
+
+        struct WorkStealingPool::Job {
+            Job(std::size_t chunksCount,
+                std::size_t placesCount,
+                const std::function<void(std::size_t)>& chunkFunction)
+                : chunkFunction(chunkFunction), ranges(placesCount), remainingChunks(chunksCount) {
+                for (std::size_t place = 0; place < placesCount; place++) {
+                    ranges[place].begin = chunksCount * place / placesCount;
+                    ranges[place].end = chunksCount * (place + 1) / placesCount;
+                }
+            }
+
+            const std::function<void(std::size_t)>& chunkFunction;
+            std::vector<ChunksRange> ranges;
+            /// Guarded by the mutex of the pool. The place 0 is the one of the calling thread.
+            std::size_t nextPlace = 1;
+
+            std::atomic<std::size_t> remainingChunks;
+            std::atomic<bool> failed{false};
+            std::mutex doneMutex;
+            std::condition_variable done;
+            std::exception_ptr exception;
+
+            bool takeChunk(std::size_t place, std::size_t& chunk) {
+                ChunksRange& own = ranges[place];
+                {
+                    std::lock_guard<std::mutex> lock(own.mutex);
+                    if (own.begin < own.end) {
+                        chunk = own.begin++;
+                        return true;
+                    }
+                }
+
+                // One lock at a time: the stolen chunks are invisible until they are moved.
+                while (true) {
+                    ChunksRange* victim = nullptr;
+                    std::size_t victimSize = 0;
+                    for (auto& range : ranges) {
+                        std::lock_guard<std::mutex> lock(range.mutex);
+                        if (range.end - range.begin > victimSize) {
+                            victim = &range;
+                            victimSize = range.end - range.begin;
+                        }
+                    }
+                    if (victim == nullptr) {
+                        return false;
+                    }
+
+                    std::size_t stolenBegin;
+                    std::size_t stolenEnd;
+                    {
+                        std::lock_guard<std::mutex> lock(victim->mutex);
+                        if (victim->begin == victim->end) {
+                            continue;
+                        }
+                        stolenBegin = victim->begin + (victim->end - victim->begin) / 2;
+                        stolenEnd = victim->end;
+                        victim->end = stolenBegin;
+                    }
+
+                    std::lock_guard<std::mutex> lock(own.mutex);
+                    chunk = stolenBegin;
+                    own.begin = stolenBegin + 1;
+                    own.end = stolenEnd;
+                    return true;
+                }
+            }
+
+            void participate(std::size_t place) {
+                std::size_t chunk;
+                while (takeChunk(place, chunk)) {
+                    if (!failed.load(std::memory_order_relaxed)) {
+                        try {
+                            chunkFunction(chunk);
+                        } catch (...) {
+                            std::lock_guard<std::mutex> lock(doneMutex);
+                            if (!failed.load(std::memory_order_relaxed)) {
+                                exception = std::current_exception();
+                                failed.store(true, std::memory_order_relaxed);
+                            }
+                        }
+                    }
+                    if (remainingChunks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        std::lock_guard<std::mutex> lock(doneMutex);
+                        done.notify_all();
+                    }
+                }
+            }
+        };
+
+        WorkStealingPool::WorkStealingPool(std::size_t workersCount) {
+            workers.reserve(workersCount);
+            for (std::size_t i = 0; i < workersCount; i++) {
+                workers.emplace_back([this]() { runWorker(); });
+            }
+        }
+
+        WorkStealingPool::~WorkStealingPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            jobsAvailable.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        void WorkStealingPool::parallelFor(
+            std::size_t chunksCount, const std::function<void(std::size_t)>& chunkFunction) {
+            const std::size_t placesCount = std::min(chunksCount, workers.size() + 1);
+            if (placesCount <= 1) {
+                for (std::size_t chunk = 0; chunk < chunksCount; chunk++) {
+                    chunkFunction(chunk);
+                }
+                return;
+            }
+
+            const auto job = std::make_shared<Job>(chunksCount, placesCount, chunkFunction);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                pendingJobs.push_back(job);
+            }
+            jobsAvailable.notify_all();
+
+            job->participate(0);
+            {
+                // The workers busy with other jobs are not needed anymore.
+                std::lock_guard<std::mutex> lock(mutex);
+                const auto it = std::find(pendingJobs.begin(), pendingJobs.end(), job);
+                if (it != pendingJobs.end()) {
+                    pendingJobs.erase(it);
+                }
+            }
+
+            std::unique_lock<std::mutex> lock(job->doneMutex);
+            job->done.wait(lock, [&job]() {
+                return job->remainingChunks.load(std::memory_order_acquire) == 0;
+            });
+            if (job->exception != nullptr) {
+                std::rethrow_exception(job->exception);
+            }
+        }
+
+        WorkStealingPool& WorkStealingPool::getDefault() {
+            static WorkStealingPool pool(std::max(std::thread::hardware_concurrency(), 1U) - 1);
+            return pool;
+        }
+
+        void WorkStealingPool::runWorker() {
+            while (true) {
+                std::shared_ptr<Job> job;
+                std::size_t place;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    jobsAvailable.wait(lock, [this]() { return stopping || !pendingJobs.empty(); });
+                    if (stopping) {
+                        return;
+                    }
+                    job = pendingJobs.front();
+                    place = job->nextPlace++;
+                    if (job->nextPlace == job->ranges.size()) {
+                        pendingJobs.pop_front();
+                    }
+                }
+                job->participate(place);
+            }
+        }
+    } // namespace Containers
+} // namespace MF
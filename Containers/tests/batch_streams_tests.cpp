@@ -0,0 +1,135 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+
+#include "MF/BatchStreams.hpp"
+#include "MF/FusedStreams.hpp"
+#include "tests_data.hpp"
+
+using namespace MF::Containers;
+
+static std::vector<int> makeValues(std::size_t count) {
+    std::vector<int> values{};
+    for (std::size_t i = 0; i < count; i++) {
+        values.push_back(int(i * 7919 % 1000) - 300);
+    }
+    return values;
+}
+
+TEST(BatchStreams, it_filters_and_maps_like_fused_streams) {
+    const std::vector<int> vecint{2, 22, 7, 987, -2, 0};
+
+    const auto streamA = BatchStreams::fromCollection(vecint);
+    EXPECT_EQ(streamA.collectToVector(), vecint);
+    EXPECT_EQ(streamA.size(), 6);
+    EXPECT_EQ(streamA.sum(), 1016);
+
+    const auto streamB = streamA.filter([](int value) { return value % 2 == 0; });
+    EXPECT_EQ(streamB.collectToVector(), (std::vector<int>{2, 22, -2, 0}));
+
+    const auto streamC = streamB.filter([](int value) { return value != 0; });
+    EXPECT_EQ(streamC.collectToVector(), (std::vector<int>{2, 22, -2}));
+    EXPECT_EQ(streamC.size(), 3);
+
+    // The mapper is not called with the value filtered out.
+    const auto streamD = streamC.map([](int value) { return 100 / value * 0.5; });
+    EXPECT_EQ(streamD.collectToVector(), (std::vector<double>{25., 2., -25.}));
+    EXPECT_EQ(streamC.map<std::int8_t>([](int value) { return value; }).sum(), 22);
+
+    // The previous streams are unchanged.
+    EXPECT_EQ(streamA.size(), 6);
+    EXPECT_EQ(streamB.size(), 4);
+
+    // Predicates which return other truthy values than 1.
+    std::vector<int> upTo20(20);
+    std::iota(upTo20.begin(), upTo20.end(), 0);
+    const auto notMultipleOf3 = [](int value) { return value % 3; };
+    EXPECT_EQ(
+        BatchStreams::fromCollection(upTo20).filter(notMultipleOf3).size(),
+        FusedStreams::fromCollection(upTo20).filter(notMultipleOf3).size());
+    EXPECT_EQ(
+        BatchStreams::fromCollection(upTo20)
+            .filter(notMultipleOf3)
+            .filter([](int value) { return value % 4; })
+            .collectToVector(),
+        (std::vector<int>{1, 2, 5, 7, 10, 11, 13, 14, 17, 19}));
+    std::vector<int> highBit(20);
+    std::iota(highBit.begin(), highBit.end(), 0xF8);
+    const auto hasBit8 = [](int value) { return value & 0x100; };
+    EXPECT_EQ(BatchStreams::fromCollection(highBit).filter(hasBit8).size(), 12);
+
+    std::vector<double> browsed{};
+    streamD.browse([&browsed](double value) { browsed.push_back(value); });
+    EXPECT_EQ(browsed, streamD.collectToVector());
+}
+
+TEST(BatchStreams, it_processes_many_blocks) {
+    // Partial last block, blocks where all or no value is selected, and chained selections.
+    for (const std::size_t count : {0, 1, 1023, 1024, 1025, 5000}) {
+        const auto values = makeValues(count);
+        const auto isPositive = [](int value) { return value > 0; };
+        const auto isOdd = [](int value) { return value % 2 != 0; };
+        const auto square = [](int value) { return static_cast<std::int64_t>(value) * value; };
+
+        const auto batch = BatchStreams::fromCollection(values).filter(isPositive).filter(isOdd);
+        const auto fused = FusedStreams::fromCollection(values).filter(isPositive).filter(isOdd);
+        EXPECT_EQ(batch.collectToVector(), fused.collectToVector()) << count;
+        EXPECT_EQ(batch.size(), fused.size()) << count;
+        EXPECT_EQ(batch.map(square).sum(), fused.map(square).reduce(0, std::plus<>())) << count;
+        EXPECT_EQ(
+            batch.reduce(0, [](int a, int b) { return a ^ b; }),
+            fused.reduce(0, [](int a, int b) { return a ^ b; }))
+            << count;
+
+        const auto remapped = BatchStreams::fromArray(values.data(), values.size())
+                                  .map(square)
+                                  .filter([](std::int64_t value) { return value < 10000; })
+                                  .map([](std::int64_t value) { return value % 7; });
+        const auto expected = FusedStreams::fromCollection(values)
+                                  .map(square)
+                                  .filter([](std::int64_t value) { return value < 10000; })
+                                  .map([](std::int64_t value) { return value % 7; });
+        EXPECT_EQ(remapped.collectToVector(), expected.collectToVector()) << count;
+    }
+
+    std::size_t blocksCount = 0;
+    std::size_t maxBlockSize = 0;
+    BatchStreams::fromCollection(makeValues(3000))
+        .browseBlocks([&](const BatchStreams::Block<int>& block) {
+            blocksCount++;
+            maxBlockSize = std::max(maxBlockSize, block.size);
+            EXPECT_TRUE(block.isDense());
+            EXPECT_EQ(block.selectedCount, block.size);
+        });
+    EXPECT_EQ(blocksCount, 3);
+    EXPECT_EQ(maxBlockSize, BatchStreams::BLOCK_SIZE);
+
+    // The empty blocks are skipped.
+    blocksCount = 0;
+    BatchStreams::fromCollection(makeValues(3000))
+        .filter([](int value) { return value > 1000; })
+        .browseBlocks([&blocksCount](const BatchStreams::Block<int>&) { blocksCount++; });
+    EXPECT_EQ(blocksCount, 0);
+}
+
+TEST(BatchStreams, it_sums_floating_points) {
+    std::vector<double> values{};
+    for (int i = 0; i < 3000; i++) {
+        values.push_back(i * 0.5);
+    }
+    // Exact: the partial sums are small integers and halves.
+    const auto stream = BatchStreams::fromCollection(std::move(values));
+    EXPECT_EQ(stream.sum(), 0.5 * 2999 * 3000 / 2);
+    EXPECT_EQ(stream.filter([](double value) { return value >= 1000; }).size(), 1000);
+
+    const std::array<float, 4> floats{1.5f, -2.f, 4.f, 0.25f};
+    const auto doubled = BatchStreams::fromCollection(floats).map([](float value) {
+        return value * 2;
+    });
+    EXPECT_EQ(doubled.sum(), 7.5f);
+}
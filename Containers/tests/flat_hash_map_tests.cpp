@@ -0,0 +1,202 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "MF/FlatHashMap.hpp"
+#include "tests_data.hpp"
+
+using namespace MF::Containers;
+
+template <typename Map, typename Expected>
+static void expectSameContent(const Map& map, const Expected& expected) {
+    ASSERT_EQ(map.size(), expected.size());
+    std::size_t iterated = 0;
+    for (const auto& entry : map) {
+        iterated++;
+        const auto found = expected.find(entry.first);
+        ASSERT_NE(found, expected.end()) << entry.first;
+        EXPECT_EQ(entry.second, found->second) << entry.first;
+    }
+    EXPECT_EQ(iterated, expected.size());
+}
+
+/// Every key has the same hash: all the lookups go through the same probe sequence.
+struct CollidingHash {
+    std::size_t operator()(int) const {
+        return 42;
+    }
+};
+
+TEST(FlatHashMap, it_inserts_finds_and_erases_like_unordered_map) {
+    std::mt19937 generator(7);
+    FlatHashMap<int, int> map{};
+    std::unordered_map<int, int> expected{};
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.find(3), map.end());
+    EXPECT_EQ(map.erase(3), 0);
+
+    // Many erasures, so that the insertions reuse the deleted slots.
+    for (int operation = 0; operation < 100000; operation++) {
+        const int key = static_cast<int>(generator() % 5000) - 1000;
+        switch (generator() % 4) {
+            case 0:
+            case 1:
+                EXPECT_EQ(
+                    map.insert({key, operation}).second,
+                    expected.insert({key, operation}).second);
+                break;
+            case 2:
+                map[key] += operation;
+                expected[key] += operation;
+                break;
+            default:
+                EXPECT_EQ(map.erase(key), expected.erase(key));
+        }
+    }
+    expectSameContent(map, expected);
+    for (int key = -1000; key < 4000; key++) {
+        EXPECT_EQ(map.count(key), expected.count(key));
+    }
+    EXPECT_LE(map.load_factor(), map.max_load_factor());
+
+    // Erasing while iterating.
+    for (auto it = map.begin(); it != map.end();) {
+        it = it->first % 3 == 0 ? map.erase(it) : std::next(it);
+    }
+    for (auto it = expected.begin(); it != expected.end();) {
+        it = it->first % 3 == 0 ? expected.erase(it) : std::next(it);
+    }
+    expectSameContent(map, expected);
+
+    FlatHashMap<int, int, CollidingHash> colliding{};
+    for (int key = 0; key < 100; key++) {
+        colliding.try_emplace(key, key * 2);
+    }
+    for (int key = 0; key < 100; key += 2) {
+        colliding.erase(key);
+    }
+    EXPECT_EQ(colliding.size(), 50);
+    EXPECT_EQ(colliding.at(51), 102);
+    EXPECT_FALSE(colliding.contains(50));
+    EXPECT_THROW(colliding.at(50), std::out_of_range);
+}
+
+TEST(FlatHashMap, it_looks_up_heterogeneous_keys) {
+    FlatHashMap<std::string, int> map{{"one", 1}, {"two", 2}};
+    map["three"] = 3;
+    const char* const four = "four";
+    map.try_emplace(four, 4);
+    EXPECT_EQ(map.size(), 4);
+
+    // Hashed the same way, and compared without conversion.
+    EXPECT_EQ(FlatHash<std::string>()("three"), FlatHash<std::string>()(std::string("three")));
+    ASSERT_NE(map.find("two"), map.end());
+    EXPECT_EQ(map.find("two")->second, 2);
+    EXPECT_TRUE(map.contains(four));
+    EXPECT_EQ(map.at("one"), 1);
+    EXPECT_FALSE(map.contains("five"));
+    EXPECT_EQ(map.erase("one"), 1);
+    EXPECT_FALSE(map.contains(std::string("one")));
+
+    // Long keys, hashed 8 bytes at a time.
+    FlatHashSet<std::string> set{};
+    for (int i = 0; i < 1000; i++) {
+        set.insert(std::string(static_cast<std::size_t>(i % 40), 'x') + std::to_string(i));
+    }
+    EXPECT_EQ(set.size(), 1000);
+    EXPECT_TRUE(set.contains("xxxxxxxxx129"));
+    EXPECT_FALSE(set.contains("xxxxxxxxx130"));
+
+    // Without transparent hash, the keys are converted.
+    FlatHashMap<std::string, int, std::hash<std::string>, std::equal_to<std::string>> converting{
+        {"one", 1}};
+    EXPECT_TRUE(converting.contains("one"));
+    FlatHashMap<long, int> longs{{5L, 1}};
+    EXPECT_TRUE(longs.contains(5));
+    EXPECT_EQ(longs[5], 1);
+}
+
+TEST(FlatHashMap, it_reserves_and_rehashes) {
+    FlatHashMap<int, std::string> map{};
+    EXPECT_EQ(map.bucket_count(), 0);
+    map.reserve(1000);
+    const std::size_t reserved = map.bucket_count();
+    EXPECT_GE(reserved * map.max_load_factor(), 1000);
+
+    map.try_emplace(0, "zero");
+    const std::string* const zero = &map.at(0);
+    for (int key = 1; key < 1000; key++) {
+        map.try_emplace(key, std::to_string(key));
+    }
+    // No growth, so the references are still valid.
+    EXPECT_EQ(map.bucket_count(), reserved);
+    EXPECT_EQ(zero, &map.at(0));
+    for (int key = 1000; key < 2000; key++) {
+        map.insert({key, std::to_string(key)});
+    }
+    EXPECT_GT(map.bucket_count(), reserved);
+    EXPECT_EQ(map.at(0), "zero");
+
+    // Shrinks to fit, then frees the memory.
+    map.erase(map.find(1999));
+    for (int key = 10; key < 1999; key++) {
+        map.erase(key);
+    }
+    map.rehash(0);
+    EXPECT_LT(map.bucket_count(), 32);
+    EXPECT_EQ(map.at(9), "9");
+    map.clear();
+    map.rehash(0);
+    EXPECT_EQ(map.bucket_count(), 0);
+    EXPECT_FALSE(map.contains(9));
+    map[9] = "nine";
+    EXPECT_EQ(map.size(), 1);
+
+    FlatHashSet<int> sized(100);
+    EXPECT_GE(sized.bucket_count(), 100);
+    EXPECT_TRUE(sized.empty());
+}
+
+TEST(FlatHashMap, it_copies_and_moves_the_elements) {
+    FlatHashMap<int, std::unique_ptr<int>> owners{};
+    for (int key = 0; key < 100; key++) {
+        owners.try_emplace(key, std::make_unique<int>(key));
+    }
+    EXPECT_FALSE(owners.try_emplace(5, std::make_unique<int>(0)).second);
+    EXPECT_FALSE(owners.emplace(6, std::make_unique<int>(0)).second);
+    EXPECT_TRUE(owners.emplace(100, std::make_unique<int>(100)).second);
+    EXPECT_EQ(*owners.at(5), 5);
+
+    FlatHashMap<int, std::unique_ptr<int>> moved(std::move(owners));
+    EXPECT_EQ(moved.size(), 101);
+    EXPECT_EQ(*moved.at(100), 100);
+    EXPECT_TRUE(owners.empty());
+    owners = std::move(moved);
+    EXPECT_EQ(*owners.at(42), 42);
+
+    FlatHashMap<std::string, std::string> strings{{"a", "A"}, {"b", "B"}};
+    auto copy = strings;
+    copy["c"] = "C";
+    EXPECT_EQ(strings.size(), 2);
+    EXPECT_NE(copy, strings);
+    copy.erase("c");
+    EXPECT_EQ(copy, strings);
+    copy.insert_or_assign("a", "Z");
+    EXPECT_EQ(copy.at("a"), "Z");
+    swap(copy, strings);
+    EXPECT_EQ(strings.at("a"), "Z");
+
+    FlatHashSet<int> set{1, 2, 3, 2};
+    EXPECT_EQ(set.size(), 3);
+    const std::unordered_set<int> expected(set.begin(), set.end());
+    EXPECT_EQ(expected, (std::unordered_set<int>{1, 2, 3}));
+    set.erase(set.find(2));
+    EXPECT_EQ(set, (FlatHashSet<int>{3, 1}));
+}
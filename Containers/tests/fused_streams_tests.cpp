@@ -0,0 +1,599 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <memory>
+#include <string>
+
+#include "MF/FusedStreams.hpp"
+#include "tests_data.hpp"
+
+using namespace MF::Containers;
+
+static bool isIntEven(int input) {
+    return input % 2 == 0;
+}
+
+static double convertToDoubleAndInvert(int input) {
+    return 1. / double(input);
+}
+
+static auto makeStreamOfEvenSquares(std::size_t count) {
+    // The vector and the lambdas are temporaries: the stream owns them.
+    std::vector<int> values{};
+    for (std::size_t i = 0; i < count; i++) {
+        values.push_back(int(i));
+    }
+    return FusedStreams::fromCollection(std::move(values))
+        .filter([](int value) { return value % 2 == 0; })
+        .map([](int value) { return value * value; });
+}
+
+TEST(FusedStreams, it_filters_and_maps_like_streams) {
+    const std::vector<int> vecint{2, 22, 7, 987, -2, 0};
+
+    const auto streamA = FusedStreams::fromCollection(vecint);
+    EXPECT_EQ(streamA.collectToVector(), vecint);
+    EXPECT_EQ(streamA.size(), 6);
+
+    const auto streamB = streamA.filter(isIntEven);
+    EXPECT_EQ(streamB.collectToVector(), (std::vector<int>{2, 22, -2, 0}));
+
+    const auto streamC = streamB.filter([](int value) { return value != 0; });
+    EXPECT_EQ(streamC.collectToVector(), (std::vector<int>{2, 22, -2}));
+    EXPECT_EQ(streamC.size(), 3);
+
+    const auto streamD = streamC.map<double>(convertToDoubleAndInvert);
+    EXPECT_EQ(streamD.collectToVector(), (std::vector<double>{0.5, 1. / 22, -0.5}));
+
+    // The previous streams are unchanged.
+    EXPECT_EQ(streamA.size(), 6);
+    EXPECT_EQ(streamB.size(), 4);
+}
+
+TEST(FusedStreams, it_deduces_the_mapped_type) {
+    const std::vector<int> vecint{1, 2, 3};
+    const auto strings = FusedStreams::fromCollection(vecint)
+                             .map([](int value) { return std::to_string(value); })
+                             .map([](const std::string& value) { return value + value; })
+                             .collectToVector();
+    EXPECT_EQ(strings, (std::vector<std::string>{"11", "22", "33"}));
+
+    const auto narrowed =
+        FusedStreams::fromCollection(vecint).map<char>([](int value) { return value + '0'; });
+    static_assert(std::is_same<decltype(narrowed)::value_type, char>::value, "");
+    EXPECT_EQ(narrowed.collectToVector(), (std::vector<char>{'1', '2', '3'}));
+}
+
+TEST(FusedStreams, it_outlives_its_temporaries) {
+    const auto stream = makeStreamOfEvenSquares(7);
+    EXPECT_EQ(stream.collectToVector(), (std::vector<int>{0, 4, 16, 36}));
+
+    const auto copy = stream.filter([](int value) { return value > 10; });
+    EXPECT_EQ(copy.collectToVector(), (std::vector<int>{16, 36}));
+    EXPECT_EQ(stream.size(), 4);
+}
+
+TEST(FusedStreams, it_streams_other_collections_and_ranges) {
+    const std::list<int> theList{5, 6, 7, 8};
+    EXPECT_EQ(FusedStreams::fromCollection(theList).filter(isIntEven).size(), 2);
+
+    const int values[] = {1, 2, 3, 4, 5};
+    std::vector<int> browsed{};
+    FusedStreams::fromRange(std::begin(values) + 1, std::end(values))
+        .map([](int value) { return value * 10; })
+        .browse([&browsed](int value) { browsed.push_back(value); });
+    EXPECT_EQ(browsed, (std::vector<int>{20, 30, 40, 50}));
+
+    const std::vector<int> empty{};
+    EXPECT_EQ(FusedStreams::fromCollection(empty).map(convertToDoubleAndInvert).size(), 0);
+}
+
+TEST(FusedStreams, it_does_not_copy_the_elements_needlessly) {
+    struct CopyCounter {
+        int* copies;
+        CopyCounter(int* copies) : copies(copies) {
+        }
+        CopyCounter(const CopyCounter& other) : copies(other.copies) {
+            (*copies)++;
+        }
+        CopyCounter(CopyCounter&& other) noexcept : copies(other.copies) {
+        }
+        CopyCounter& operator=(const CopyCounter&) = default;
+        CopyCounter& operator=(CopyCounter&&) noexcept = default;
+    };
+
+    int copies = 0;
+    std::vector<CopyCounter> counters(10, CopyCounter(&copies));
+    copies = 0;
+
+    const auto stream = FusedStreams::fromCollection(counters);
+    EXPECT_EQ(stream.filter([](const CopyCounter&) { return true; }).size(), 10);
+    EXPECT_EQ(copies, 0);
+
+    // Only the collection copies, and the mapped elements are moved.
+    EXPECT_EQ(stream.filter([](const CopyCounter&) { return true; }).collectToVector().size(), 10);
+    EXPECT_EQ(copies, 10);
+    copies = 0;
+    const auto mapped = stream.map([](const CopyCounter& counter) {
+        return CopyCounter(counter.copies);
+    });
+    EXPECT_EQ(mapped.collectToVector().size(), 10);
+    EXPECT_EQ(copies, 0);
+}
+
+/// Counts the allocations made through its copies.
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    std::shared_ptr<int> allocations;
+
+    CountingAllocator() : allocations(std::make_shared<int>(0)) {
+    }
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other) : allocations(other.allocations) {
+    }
+
+    T* allocate(std::size_t count) {
+        (*allocations)++;
+        return std::allocator<T>().allocate(count);
+    }
+    void deallocate(T* pointer, std::size_t count) {
+        std::allocator<T>().deallocate(pointer, count);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>& other) const {
+        return allocations == other.allocations;
+    }
+    template <typename U>
+    bool operator!=(const CountingAllocator<U>& other) const {
+        return allocations != other.allocations;
+    }
+};
+
+TEST(FusedStreams, it_presizes_the_collected_vectors) {
+    std::vector<int> values(1000);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        values[i] = int(i);
+    }
+    const auto stream = FusedStreams::fromCollection(values);
+    const auto doubled = stream.map([](int value) { return 2 * value; });
+    EXPECT_EQ(doubled.skip(10).limit(500).collectToVector().capacity(), 500);
+    EXPECT_EQ(doubled.skip(990).limit(500).collectToVector().capacity(), 10);
+    EXPECT_EQ(FusedStreams::fromRange(values.begin(), values.end()).getKnownSize(), 1000);
+
+    // A single allocation when the size is known, else as many as std::vector needs.
+    CountingAllocator<int> allocator{};
+    const auto collected = doubled.collectToVector(allocator);
+    EXPECT_EQ(collected.size(), 1000);
+    EXPECT_EQ(collected[999], 1998);
+    EXPECT_EQ(*allocator.allocations, 1);
+    *allocator.allocations = 0;
+    const auto filtered = doubled.filter([](int value) { return value > 10; });
+    EXPECT_EQ(filtered.collectToVector(allocator).size(), 994);
+    EXPECT_GT(*allocator.allocations, 1);
+
+    // In parallel: one allocation per chunk, and one for the result.
+    *allocator.allocations = 0;
+    const auto inParallel = doubled.parallel(100).collectToVector(allocator);
+    EXPECT_EQ(inParallel, collected);
+    EXPECT_EQ(*allocator.allocations, 11);
+    // "limit" is evaluated sequentially, in a single chunk.
+    *allocator.allocations = 0;
+    const auto limited = doubled.parallel(100).limit(500).collectToVector(allocator);
+    EXPECT_EQ(limited.capacity(), 500);
+    EXPECT_EQ(*allocator.allocations, 1);
+
+    const std::list<int> list(10, 1);
+    EXPECT_EQ(FusedStreams::fromCollection(list).collectToVector().capacity(), 10);
+    EXPECT_EQ(FusedStreams::iterate(0, [](int value) { return value + 1; }).getKnownSize(),
+              FusedStreams::UNKNOWN_SIZE);
+}
+
+TEST(FusedStreams, it_collects_move_only_elements) {
+    std::vector<int> values{1, 2, 3, 4, 5, 6};
+    const auto pointers = FusedStreams::fromCollection(values)
+                              .map([](int value) { return std::make_unique<int>(value); })
+                              .filter([](const std::unique_ptr<int>& value) { return *value > 2; });
+    for (const std::size_t grainSize : {std::size_t(0), std::size_t(2)}) {
+        const auto collected = grainSize == 0 ? pointers.collectToVector()
+                                              : pointers.parallel(grainSize).collectToVector();
+        ASSERT_EQ(collected.size(), 4);
+        EXPECT_EQ(*collected[0], 3);
+        EXPECT_EQ(*collected[3], 6);
+    }
+
+    // Moved out of the source.
+    std::vector<std::unique_ptr<int>> owners{};
+    owners.push_back(std::make_unique<int>(7));
+    owners.push_back(std::make_unique<int>(8));
+    const auto moved = FusedStreams::fromRange(
+                           std::make_move_iterator(owners.begin()),
+                           std::make_move_iterator(owners.end()))
+                           .collectToVector();
+    ASSERT_EQ(moved.size(), 2);
+    EXPECT_EQ(*moved[1], 8);
+    EXPECT_EQ(owners[0], nullptr);
+}
+
+TEST(FusedStreams, it_runs_in_parallel_with_the_sequential_results) {
+    std::vector<int> values(100003);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        values[i] = int(i % 1000) - 500;
+    }
+    const auto sequential = FusedStreams::fromCollection(values)
+                                .filter(isIntEven)
+                                .map([](int value) { return std::to_string(value); });
+
+    const std::size_t grainSizes[] = {1000, 4096, FusedStreams::DEFAULT_GRAIN_SIZE};
+    for (const std::size_t grainSize : grainSizes) {
+        const auto parallel = sequential.parallel(grainSize);
+        EXPECT_TRUE(parallel.isParallel());
+        EXPECT_EQ(parallel.getGrainSize(), grainSize);
+        EXPECT_EQ(parallel.collectToVector(), sequential.collectToVector());
+        EXPECT_EQ(parallel.size(), sequential.size());
+
+        // The following stages are parallel too, and the reductions are merged in order.
+        const auto concatenate = [](std::string result, const std::string& value) {
+            return result + value;
+        };
+        const auto lengths = parallel.map([](const std::string& value) { return value.size(); });
+        EXPECT_TRUE(lengths.isParallel());
+        EXPECT_EQ(
+            lengths.reduce(0, std::plus<std::size_t>()),
+            sequential.map([](const std::string& value) { return value.size(); })
+                .reduce(0, std::plus<std::size_t>()));
+        EXPECT_EQ(
+            parallel.filter([](const std::string& value) { return value.size() == 4; })
+                .reduce("", concatenate),
+            sequential.filter([](const std::string& value) { return value.size() == 4; })
+                .reduce("", concatenate));
+
+        std::atomic<std::size_t> browsed(0);
+        parallel.browse([&browsed](const std::string&) { browsed++; });
+        EXPECT_EQ(browsed.load(), sequential.size());
+    }
+
+    EXPECT_FALSE(sequential.parallel().sequential().isParallel());
+    EXPECT_THROW(sequential.parallel(0), std::invalid_argument);
+
+    // Smaller than one chunk, or empty.
+    const std::vector<int> small{1, 2, 3};
+    EXPECT_EQ(FusedStreams::fromCollection(small).parallel(2).collectToVector(), small);
+    EXPECT_EQ(FusedStreams::fromCollection(std::vector<int>{}).parallel(2).size(), 0);
+}
+
+TEST(FusedStreams, it_propagates_the_exceptions_of_parallel_stages) {
+    const std::vector<int> values(10000, 1);
+    const auto stream = FusedStreams::fromCollection(values).parallel(100).map([](int value) {
+        if (value == 1) {
+            throw std::out_of_range("1");
+        }
+        return value;
+    });
+    EXPECT_THROW(stream.size(), std::out_of_range);
+}
+
+TEST(FusedStreams, it_stops_pulling_elements_early) {
+    std::vector<int> values(1000);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        values[i] = int(i);
+    }
+    int pulled = 0;
+    const auto counted = FusedStreams::fromCollection(values).map([&pulled](int value) {
+        pulled++;
+        return value;
+    });
+
+    EXPECT_EQ(counted.limit(3).collectToVector(), (std::vector<int>{0, 1, 2}));
+    EXPECT_EQ(pulled, 3);
+    pulled = 0;
+    EXPECT_EQ(counted.limit(0).size(), 0);
+    EXPECT_EQ(pulled, 0);
+
+    EXPECT_EQ(counted.findFirst()->get(), 0);
+    EXPECT_TRUE(counted.filter([](int value) { return value > 10; }).findFirst()->contains(11));
+    EXPECT_TRUE(counted.filter([](int value) { return value < 0; }).findFirst()->isEmpty());
+    pulled = 0;
+    EXPECT_TRUE(counted.anyMatch([](int value) { return value == 5; }));
+    EXPECT_EQ(pulled, 6);
+    EXPECT_FALSE(counted.anyMatch([](int value) { return value == -5; }));
+    EXPECT_TRUE(counted.allMatch([](int value) { return value >= 0; }));
+    pulled = 0;
+    EXPECT_FALSE(counted.allMatch([](int value) { return value < 3; }));
+    EXPECT_EQ(pulled, 4);
+    EXPECT_TRUE(counted.noneMatch([](int value) { return value > 1000; }));
+    EXPECT_FALSE(counted.noneMatch([](int value) { return value == 999; }));
+
+    const std::vector<int> empty{};
+    EXPECT_FALSE(FusedStreams::fromCollection(empty).anyMatch(isIntEven));
+    EXPECT_TRUE(FusedStreams::fromCollection(empty).allMatch(isIntEven));
+    EXPECT_TRUE(FusedStreams::fromCollection(empty).findFirst()->isEmpty());
+}
+
+TEST(FusedStreams, it_skips_takes_and_drops) {
+    const std::vector<int> values{1, 3, 5, 6, 7, 8};
+    const auto stream = FusedStreams::fromCollection(values);
+    const auto isOdd = [](int value) { return value % 2 != 0; };
+
+    EXPECT_EQ(stream.skip(4).collectToVector(), (std::vector<int>{7, 8}));
+    EXPECT_EQ(stream.skip(10).size(), 0);
+    EXPECT_EQ(stream.skip(1).limit(2).collectToVector(), (std::vector<int>{3, 5}));
+    EXPECT_EQ(stream.takeWhile(isOdd).collectToVector(), (std::vector<int>{1, 3, 5}));
+    EXPECT_EQ(stream.dropWhile(isOdd).collectToVector(), (std::vector<int>{6, 7, 8}));
+    EXPECT_EQ(stream.dropWhile(isOdd).takeWhile(isIntEven).size(), 1);
+    EXPECT_EQ(stream.takeWhile(isOdd).limit(2).collectToVector(), (std::vector<int>{1, 3}));
+    EXPECT_EQ(stream.limit(5).takeWhile(isOdd).findFirst()->get(), 1);
+}
+
+TEST(FusedStreams, it_queries_unbounded_streams) {
+    const auto naturals = FusedStreams::iterate(0, [](int value) { return value + 1; });
+    EXPECT_EQ(
+        naturals.filter(isIntEven).map([](int value) { return value * value; }).limit(4)
+            .collectToVector(),
+        (std::vector<int>{0, 4, 16, 36}));
+    EXPECT_EQ(naturals.skip(10).findFirst()->get(), 10);
+    EXPECT_TRUE(naturals.anyMatch([](int value) { return value == 1000000; }));
+    EXPECT_FALSE(naturals.allMatch([](int value) { return value < 10; }));
+    EXPECT_EQ(naturals.takeWhile([](int value) { return value < 100; }).size(), 100);
+
+    const auto powers = FusedStreams::iterate(std::string("a"), [](const std::string& value) {
+        return value + value;
+    });
+    EXPECT_EQ(powers.dropWhile([](const std::string& value) { return value.size() < 8; })
+                  .findFirst()
+                  ->get(),
+              "aaaaaaaa");
+}
+
+TEST(FusedStreams, it_short_circuits_in_parallel) {
+    std::vector<int> values(100000);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        values[i] = int(i);
+    }
+    std::atomic<int> pulled(0);
+    const auto stream = FusedStreams::fromCollection(values).parallel(1000).map(
+        [&pulled](int value) {
+            pulled++;
+            return value;
+        });
+
+    // The first match in the order of the source, even if a later chunk finds one first.
+    EXPECT_EQ(stream.filter([](int value) { return value % 3000 == 2999; }).findFirst()->get(),
+              2999);
+    EXPECT_TRUE(stream.anyMatch([](int value) { return value == 500; }));
+    EXPECT_FALSE(stream.allMatch([](int value) { return value != 99999; }));
+    EXPECT_TRUE(stream.noneMatch([](int value) { return value < 0; }));
+
+    // Stopping in the first chunk skips most of the others.
+    pulled = 0;
+    EXPECT_EQ(stream.findFirst()->get(), 0);
+    EXPECT_LT(pulled.load(), 50000);
+
+    // Order dependent stages run sequentially, even after parallel().
+    EXPECT_EQ(stream.skip(10).limit(2).collectToVector(), (std::vector<int>{10, 11}));
+}
+
+TEST(FusedStreams, it_aggregates_by_key) {
+    const std::vector<std::string> words{"pear", "apple", "fig", "plum", "kiwi", "avocado", "pear"};
+    const auto stream = FusedStreams::fromCollection(words);
+    const auto firstLetter = [](const std::string& word) { return word[0]; };
+
+    using Group_t = std::pair<char, std::vector<std::string>>;
+    EXPECT_EQ(
+        stream.groupBy(firstLetter),
+        (std::vector<Group_t>{
+            {'p', {"pear", "plum", "pear"}},
+            {'a', {"apple", "avocado"}},
+            {'f', {"fig"}},
+            {'k', {"kiwi"}}}));
+    EXPECT_EQ(
+        stream.countBy([](const std::string& word) { return word.size(); }),
+        (std::vector<std::pair<std::size_t, std::size_t>>{{4, 4}, {5, 1}, {3, 1}, {7, 1}}));
+    EXPECT_EQ(
+        stream.distinct(),
+        (std::vector<std::string>{"pear", "apple", "fig", "plum", "kiwi", "avocado"}));
+    EXPECT_EQ(
+        stream.map([](const std::string& word) { return word.size(); })
+            .reduceBy([](std::size_t size) { return size % 2; }, 0, std::plus<std::size_t>()),
+        (std::vector<std::pair<std::size_t, std::size_t>>{{0, 16}, {1, 15}}));
+
+    const auto lengths = stream.skip(1).toMap(
+        [](const std::string& word) { return word; },
+        [](const std::string& word) { return word.size(); });
+    EXPECT_EQ(lengths.size(), 6);
+    EXPECT_EQ(lengths.at("avocado"), 7);
+    EXPECT_THROW(
+        stream.toMap(
+            [](const std::string& word) { return word; },
+            [](const std::string& word) { return word.size(); }),
+        std::invalid_argument);
+    const auto concatenated = stream.toMap(
+        firstLetter,
+        [](const std::string& word) { return word; },
+        [](const std::string& word, const std::string& next) { return word + "," + next; });
+    EXPECT_EQ(concatenated.at('p'), "pear,plum,pear");
+    EXPECT_EQ(concatenated.at('f'), "fig");
+
+    // Custom hash and equality.
+    const auto caseInsensitiveHash = [](char letter) { return std::hash<int>()(letter | 0x20); };
+    const auto caseInsensitiveEqual = [](char lhs, char rhs) {
+        return (lhs | 0x20) == (rhs | 0x20);
+    };
+    const std::string letters = "aAbBcab";
+    EXPECT_EQ(
+        FusedStreams::fromCollection(letters).distinct(caseInsensitiveHash, caseInsensitiveEqual),
+        (std::vector<char>{'a', 'b', 'c'}));
+}
+
+TEST(FusedStreams, it_aggregates_many_keys_in_parallel) {
+    std::vector<int> values(200000);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        // Multiples of a power of 2, and negative ones.
+        values[i] = (int(i * 7919 % 50000) - 25000) * 1024;
+    }
+    const auto sequential = FusedStreams::fromCollection(values);
+    const auto parallel = sequential.parallel(3000);
+    const auto modulo = [](int value) { return value % 1000; };
+
+    const auto counts = sequential.countBy(modulo);
+    std::size_t total = 0;
+    for (const auto& count : counts) {
+        total += count.second;
+    }
+    EXPECT_EQ(total, values.size());
+    EXPECT_EQ(parallel.countBy(modulo), counts);
+    EXPECT_EQ(parallel.groupBy(modulo), sequential.groupBy(modulo));
+    EXPECT_EQ(sequential.distinct().size(), 50000);
+    EXPECT_EQ(parallel.distinct(), sequential.distinct());
+    // About 200 values of up to 25M per key: the sums overflow an int.
+    const auto widen = [](int value) { return static_cast<std::int64_t>(value); };
+    const auto wideModulo = [](std::int64_t value) { return value % 1000; };
+    const auto sums = sequential.map(widen).reduceBy(wideModulo, std::int64_t(0), std::plus<>());
+    EXPECT_EQ(parallel.map(widen).reduceBy(wideModulo, std::int64_t(0), std::plus<>()), sums);
+    EXPECT_EQ(
+        parallel.toMap(modulo, [](int) { return 1; }, std::plus<int>()),
+        sequential.toMap(modulo, [](int) { return 1; }, std::plus<int>()));
+}
+
+TEST(FusedStreams, it_sorts_stably) {
+    // Pairs of (key, position), sorted by key only.
+    std::vector<std::pair<int, int>> pairs{};
+    for (int i = 0; i < 5000; i++) {
+        pairs.emplace_back(i * 7919 % 100, i);
+    }
+    const auto byKey = [](const std::pair<int, int>& left, const std::pair<int, int>& right) {
+        return left.first < right.first;
+    };
+    auto expected = pairs;
+    std::stable_sort(expected.begin(), expected.end(), byKey);
+
+    const auto stream = FusedStreams::fromCollection(pairs);
+    EXPECT_EQ(stream.sorted(byKey).collectToVector(), expected);
+    // Runs of 300 elements, merged on the threads.
+    EXPECT_EQ(stream.parallel(300).sorted(byKey).collectToVector(), expected);
+    EXPECT_EQ(stream.sorted(byKey).getKnownSize(), 5000);
+    const auto zeros = stream.filter([](const std::pair<int, int>& pair) {
+        return pair.first == 0;
+    });
+    EXPECT_EQ(zeros.sorted(byKey).getKnownSize(), FusedStreams::UNKNOWN_SIZE);
+
+    // The next stages see the sorted elements, and may stop early.
+    EXPECT_EQ(
+        stream.sorted(byKey).limit(3).collectToVector(),
+        (std::vector<std::pair<int, int>>(expected.begin(), expected.begin() + 3)));
+    const auto empty = FusedStreams::fromCollection(std::vector<int>{});
+    EXPECT_TRUE(empty.sorted().collectToVector().empty());
+    EXPECT_TRUE(empty.topK(3).collectToVector().empty());
+    const auto strings = FusedStreams::fromCollection(std::vector<std::string>{"b", "c", "a"});
+    EXPECT_EQ(
+        strings.sorted(std::greater<>()).collectToVector(),
+        (std::vector<std::string>{"c", "b", "a"}));
+}
+
+template <typename T>
+static void expectRadixSorted(std::vector<T> values) {
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(FusedStreams::fromCollection(values).sorted().collectToVector(), expected);
+    EXPECT_EQ(
+        FusedStreams::fromCollection(values).parallel(1000).sorted().collectToVector(), expected);
+}
+
+TEST(FusedStreams, it_sorts_the_integers) {
+    std::vector<int> ints{};
+    std::vector<std::int64_t> longs{};
+    std::vector<std::uint16_t> shorts{};
+    for (std::uint32_t i = 0; i < 10000; i++) {
+        const std::uint32_t random = i * 2654435761u;
+        ints.push_back(static_cast<int>(random));
+        longs.push_back(static_cast<std::int64_t>(random) * (i % 2 == 0 ? -1000 : 1000));
+        shorts.push_back(static_cast<std::uint16_t>(random));
+    }
+    ints.push_back(std::numeric_limits<int>::min());
+    ints.push_back(std::numeric_limits<int>::max());
+    longs.push_back(std::numeric_limits<std::int64_t>::min());
+    expectRadixSorted(ints);
+    expectRadixSorted(longs);
+    expectRadixSorted(shorts);
+    // The passes are skipped when all the elements have the same byte.
+    expectRadixSorted(std::vector<char>(3000, 'x'));
+    expectRadixSorted(std::vector<unsigned>(3000, 0x12345678u));
+    expectRadixSorted(std::vector<int>{3, -1, 2});
+}
+
+TEST(FusedStreams, it_keeps_the_top_k_elements) {
+    std::vector<int> values{};
+    for (int i = 0; i < 20000; i++) {
+        values.push_back(i * 7919 % 10007 - 5000);
+    }
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    const auto sequential = FusedStreams::fromCollection(values);
+    const auto parallel = sequential.parallel(700);
+    for (const std::size_t count : {0, 1, 10, 20000, 30000}) {
+        const auto bottom = std::vector<int>(
+            expected.begin(), expected.begin() + std::min<std::size_t>(count, expected.size()));
+        const auto top = std::vector<int>(
+            expected.rbegin(), expected.rbegin() + std::min<std::size_t>(count, expected.size()));
+        EXPECT_EQ(sequential.bottomK(count).collectToVector(), bottom) << count;
+        EXPECT_EQ(parallel.bottomK(count).collectToVector(), bottom) << count;
+        EXPECT_EQ(sequential.topK(count).collectToVector(), top) << count;
+        EXPECT_EQ(parallel.topK(count).collectToVector(), top) << count;
+        EXPECT_EQ(sequential.topK(count).getKnownSize(), std::min<std::size_t>(count, 20000));
+    }
+
+    // The ties keep the order of the stream, also when the chunks are merged.
+    const auto byTens = [](int left, int right) { return left / 10 < right / 10; };
+    auto stable = values;
+    std::stable_sort(stable.begin(), stable.end(), byTens);
+    stable.resize(25);
+    EXPECT_EQ(sequential.bottomK(25, byTens).collectToVector(), stable);
+    EXPECT_EQ(parallel.bottomK(25, byTens).collectToVector(), stable);
+    EXPECT_EQ(parallel.sorted(byTens).limit(25).collectToVector(), stable);
+
+    // The K-th element is in a group of ties which spans several chunks.
+    using Pair_t = std::pair<int, int>;
+    const auto byFirst = [](const Pair_t& left, const Pair_t& right) {
+        return left.first < right.first;
+    };
+    const std::vector<Pair_t> ties{{5, 0}, {3, 1}, {3, 2}, {3, 3}};
+    EXPECT_EQ(
+        FusedStreams::fromCollection(ties).parallel(2).bottomK(2, byFirst).collectToVector(),
+        (std::vector<Pair_t>{{3, 1}, {3, 2}}));
+    std::vector<Pair_t> pairs{};
+    for (int i = 0; i < 5000; i++) {
+        pairs.emplace_back(i * 7919 % 5, i);
+    }
+    auto stablePairs = pairs;
+    std::stable_sort(stablePairs.begin(), stablePairs.end(), byFirst);
+    stablePairs.resize(1500);
+    const auto parallelPairs = FusedStreams::fromCollection(pairs).parallel(300);
+    EXPECT_EQ(parallelPairs.bottomK(1500, byFirst).collectToVector(), stablePairs);
+    auto topPairs = pairs;
+    std::stable_sort(topPairs.begin(), topPairs.end(), [&byFirst](auto& left, auto& right) {
+        return byFirst(right, left);
+    });
+    topPairs.resize(1500);
+    EXPECT_EQ(parallelPairs.topK(1500, byFirst).collectToVector(), topPairs);
+
+    const auto pointers = FusedStreams::fromCollection(values).map([](int value) {
+        return std::make_unique<int>(value);
+    });
+    const auto greatest = pointers.topK(2, [](const auto& left, const auto& right) {
+        return *left < *right;
+    });
+    const auto collected = greatest.collectToVector();
+    ASSERT_EQ(collected.size(), 2);
+    EXPECT_EQ(*collected[0], expected.back());
+    EXPECT_EQ(*collected[1], expected[expected.size() - 2]);
+}
@@ -0,0 +1,195 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "MF/SmallVector.hpp"
+#include "tests_data.hpp"
+
+using namespace MF::Containers;
+
+/// Counts its living instances, to find the leaks and the double destructions.
+struct Tracked {
+    static int aliveCount;
+
+    int value;
+
+    Tracked(int value = 0) : value(value) {
+        aliveCount++;
+    }
+
+    Tracked(const Tracked& other) : value(other.value) {
+        aliveCount++;
+    }
+
+    Tracked(Tracked&& other) noexcept : value(other.value) {
+        other.value = -1;
+        aliveCount++;
+    }
+
+    Tracked& operator=(const Tracked&) = default;
+
+    Tracked& operator=(Tracked&&) = default;
+
+    ~Tracked() {
+        aliveCount--;
+    }
+
+    bool operator==(const Tracked& other) const {
+        return value == other.value;
+    }
+};
+
+int Tracked::aliveCount = 0;
+
+TEST(SmallVector, it_keeps_the_small_vectors_inline) {
+    SmallVector<int, 4> vector{};
+    EXPECT_TRUE(vector.empty());
+    EXPECT_TRUE(vector.isInline());
+    EXPECT_EQ(vector.capacity(), 4);
+    for (int i = 0; i < 4; i++) {
+        vector.push_back(i);
+    }
+    EXPECT_TRUE(vector.isInline());
+    EXPECT_EQ(vector.capacity(), 4);
+
+    // Spills to the heap.
+    vector.push_back(4);
+    EXPECT_FALSE(vector.isInline());
+    EXPECT_GE(vector.capacity(), 5);
+    EXPECT_EQ(vector, (SmallVector<int, 4>{0, 1, 2, 3, 4}));
+
+    // Keeps the capacity, until shrink_to_fit.
+    vector.pop_back();
+    vector.clear();
+    EXPECT_FALSE(vector.isInline());
+    vector = {7, 8};
+    vector.shrink_to_fit();
+    EXPECT_TRUE(vector.isInline());
+    EXPECT_EQ(vector, (SmallVector<int, 4>{7, 8}));
+
+    vector.reserve(100);
+    EXPECT_EQ(vector.capacity(), 100);
+    vector.resize(10, 5);
+    vector.shrink_to_fit();
+    EXPECT_EQ(vector.capacity(), 10);
+    EXPECT_EQ(vector.back(), 5);
+    EXPECT_EQ(vector[1], 8);
+}
+
+TEST(SmallVector, it_has_the_interface_of_std_vector) {
+    std::mt19937 generator(5);
+    SmallVector<std::string, 3> vector{};
+    std::vector<std::string> expected{};
+    for (int operation = 0; operation < 5000; operation++) {
+        const std::string value = std::to_string(operation) + std::string(20, 'x');
+        const std::size_t position = expected.empty() ? 0 : generator() % expected.size();
+        switch (generator() % 8) {
+            case 0:
+                vector.push_back(value);
+                expected.push_back(value);
+                break;
+            case 1:
+                vector.insert(vector.begin() + position, value);
+                expected.insert(expected.begin() + position, value);
+                break;
+            case 2:
+                vector.insert(vector.begin() + position, 2, value);
+                expected.insert(expected.begin() + position, 2, value);
+                break;
+            case 3:
+                vector.insert(vector.end() - position, {value, "a", "b"});
+                expected.insert(expected.end() - position, {value, "a", "b"});
+                break;
+            case 4:
+                if (!expected.empty()) {
+                    vector.erase(vector.begin() + position);
+                    expected.erase(expected.begin() + position);
+                }
+                break;
+            case 5:
+                vector.erase(vector.begin() + position / 2, vector.begin() + position);
+                expected.erase(expected.begin() + position / 2, expected.begin() + position);
+                break;
+            case 6:
+                vector.resize(position);
+                expected.resize(position);
+                break;
+            default:
+                vector.emplace(vector.begin() + position, 3, 'y');
+                expected.emplace(expected.begin() + position, 3, 'y');
+        }
+        ASSERT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(), expected.end()))
+            << operation;
+    }
+
+    // The new elements may be copies of the old ones, also when the vector grows.
+    SmallVector<std::string, 2> aliasing{"first", "second"};
+    aliasing.push_back(aliasing[0]);
+    aliasing.emplace_back(aliasing.back());
+    aliasing.insert(aliasing.begin(), aliasing[3]);
+    aliasing.insert(aliasing.begin() + 1, 2, aliasing[1]);
+    aliasing.assign(2, aliasing[2]);
+    EXPECT_EQ(aliasing, (SmallVector<std::string, 2>{"first", "first"}));
+
+    const std::list<int> list{3, 1, 2};
+    const SmallVector<int, 2> fromList(list.begin(), list.end());
+    EXPECT_EQ(std::vector<int>(fromList.rbegin(), fromList.rend()), (std::vector<int>{2, 1, 3}));
+    EXPECT_EQ((SmallVector<int, 2>(3, 4)), (SmallVector<int, 2>{4, 4, 4}));
+    EXPECT_EQ((SmallVector<int, 2>(3)), (SmallVector<int, 2>{0, 0, 0}));
+    EXPECT_LT(fromList, (SmallVector<int, 2>{3, 2}));
+    EXPECT_GT(fromList, (SmallVector<int, 2>{3, 1}));
+    EXPECT_EQ(fromList.at(2), 2);
+    EXPECT_THROW(fromList.at(3), std::out_of_range);
+}
+
+TEST(SmallVector, it_moves_and_copies_the_elements) {
+    {
+        SmallVector<Tracked, 2> inlined{1, 2};
+        SmallVector<Tracked, 2> onHeap{1, 2, 3, 4};
+        const Tracked* const heapData = onHeap.data();
+
+        // The heap storage is taken, the inline elements are moved.
+        SmallVector<Tracked, 2> moved(std::move(onHeap));
+        EXPECT_EQ(moved.data(), heapData);
+        EXPECT_TRUE(onHeap.empty());
+        EXPECT_TRUE(onHeap.isInline());
+        SmallVector<Tracked, 2> movedInline(std::move(inlined));
+        EXPECT_EQ(movedInline, (SmallVector<Tracked, 2>{1, 2}));
+        EXPECT_TRUE(inlined.empty());
+
+        swap(moved, movedInline);
+        EXPECT_EQ(moved, (SmallVector<Tracked, 2>{1, 2}));
+        EXPECT_EQ(movedInline.size(), 4);
+        moved = movedInline;
+        EXPECT_EQ(moved, movedInline);
+        moved = std::move(inlined);
+        EXPECT_TRUE(moved.empty());
+        moved.resize(3);
+        moved.erase(moved.begin(), moved.end() - 1);
+        EXPECT_EQ(moved.size(), 1);
+        EXPECT_EQ(Tracked::aliveCount, 5);
+    }
+    EXPECT_EQ(Tracked::aliveCount, 0);
+
+    // Relocated with memcpy, without constructor.
+    static_assert(IsTriviallyRelocatable<std::unique_ptr<int>>::value, "");
+    SmallVector<std::unique_ptr<int>, 2> owners{};
+    for (int i = 0; i < 10; i++) {
+        owners.push_back(std::make_unique<int>(i));
+    }
+    owners.erase(owners.begin() + 2);
+    auto movedOwners = std::move(owners);
+    ASSERT_EQ(movedOwners.size(), 9);
+    EXPECT_EQ(*movedOwners[2], 3);
+    EXPECT_EQ(*movedOwners.back(), 9);
+    movedOwners.resize(2);
+    movedOwners.shrink_to_fit();
+    EXPECT_TRUE(movedOwners.isInline());
+    EXPECT_EQ(*movedOwners[1], 1);
+}
@@ -34,6 +34,7 @@ TEST(UnpolishedTest, FromAnotherRepo) {
 
     StreamPtr<int> streamA = Streams::fromCollection(vecint);
     ASSERT_EQ(streamA->collectToVector().size(), 6);
+    ASSERT_EQ(streamA->getKnownSize(), 6);
 
     StreamPtr<int> streamB = streamA->filter(isIntPair);
     auto bVector = streamB->collectToVector();
@@ -52,4 +53,10 @@ TEST(UnpolishedTest, FromAnotherRepo) {
 
     const StreamPtr<double> streamD = streamC->map<double>(convertToDoubleAndInvert);
     ASSERT_EQ(streamD->collectToVector().size(), 3);
+    ASSERT_EQ(streamD->getKnownSize(), Streams::UNKNOWN_SIZE);
+
+    // The maps keep the size, so the result is reserved up front.
+    const StreamPtr<double> streamE = streamA->map<double>(convertToDoubleAndInvert);
+    ASSERT_EQ(streamE->getKnownSize(), 6);
+    ASSERT_EQ(streamE->collectToVector().capacity(), 6);
 }
@@ -0,0 +1,84 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <stdexcept>
+
+#include "MF/WorkStealingPool.hpp"
+#include "tests_data.hpp"
+
+using MF::Containers::WorkStealingPool;
+
+TEST(WorkStealingPool, it_runs_each_chunk_once) {
+    for (const std::size_t workersCount : {0, 1, 3}) {
+        WorkStealingPool pool(workersCount);
+        EXPECT_EQ(pool.getWorkersCount(), workersCount);
+
+        for (const std::size_t chunksCount : {0, 1, 2, 7, 1000}) {
+            std::vector<std::atomic<int>> calls(chunksCount);
+            pool.parallelFor(chunksCount, [&calls](std::size_t chunk) { calls[chunk]++; });
+            for (const auto& call : calls) {
+                ASSERT_EQ(call.load(), 1) << workersCount << " " << chunksCount;
+            }
+        }
+    }
+}
+
+TEST(WorkStealingPool, it_balances_uneven_chunks) {
+    // The first chunks are slow: the other threads steal the rest of the range.
+    WorkStealingPool pool(3);
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::atomic<int> done(0);
+    pool.parallelFor(64, [&](std::size_t chunk) {
+        if (chunk < 4) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.insert(std::this_thread::get_id());
+        done++;
+    });
+    EXPECT_EQ(done.load(), 64);
+    EXPECT_GT(threads.size(), 1);
+}
+
+TEST(WorkStealingPool, it_runs_nested_and_concurrent_loops) {
+    WorkStealingPool pool(2);
+    std::atomic<int> total(0);
+    std::vector<std::thread> callers;
+    for (int caller = 0; caller < 3; caller++) {
+        callers.emplace_back([&pool, &total]() {
+            pool.parallelFor(8, [&pool, &total](std::size_t) {
+                pool.parallelFor(10, [&total](std::size_t) { total++; });
+            });
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    EXPECT_EQ(total.load(), 3 * 8 * 10);
+}
+
+TEST(WorkStealingPool, it_rethrows_the_first_exception) {
+    WorkStealingPool pool(2);
+    std::atomic<int> calls(0);
+    EXPECT_THROW(
+        pool.parallelFor(
+            1000,
+            [&calls](std::size_t chunk) {
+                calls++;
+                if (chunk == 10) {
+                    throw std::runtime_error("chunk 10");
+                }
+            }),
+        std::runtime_error);
+    EXPECT_LE(calls.load(), 1000);
+
+    // The pool is still usable.
+    calls = 0;
+    pool.parallelFor(100, [&calls](std::size_t) { calls++; });
+    EXPECT_EQ(calls.load(), 100);
+}
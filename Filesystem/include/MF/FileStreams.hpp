@@ -0,0 +1,198 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#ifndef MFRANCESCHI_CPPLIBRARIES_FILESTREAMS_HPP
+#define MFRANCESCHI_CPPLIBRARIES_FILESTREAMS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "MF/Filesystem.hpp"
+#include "MF/FusedStreams.hpp"
+
+namespace MF
+{
+    namespace Filesystem
+    {
+        /**
+         * Sources of FusedStreams which read files lazily: only the current element (or block of
+         * elements) is in memory, whatever the size of the file. Each terminal operation reads
+         * the file again, and the short-circuiting ones (limit, findFirst, anyMatch...) stop
+         * reading as soon as they have their result.
+         * The streams are sequential: parallel() is not available on them.
+         */
+
+        /// Characters of a line, without its end of line. Like a std::string_view.
+        struct LineView {
+            const char* data;
+            std::size_t size;
+
+            bool isEmpty() const {
+                return size == 0;
+            }
+
+            std::string toString() const {
+                return {data, size};
+            }
+
+            /// Compares the characters.
+            bool operator==(const LineView& other) const {
+                return size == other.size && std::equal(data, data + size, other.data);
+            }
+
+            bool operator==(const std::string& other) const {
+                return *this == LineView{other.data(), other.size()};
+            }
+
+            template <typename Other>
+            bool operator!=(const Other& other) const {
+                return !(*this == other);
+            }
+        };
+
+        constexpr std::size_t DEFAULT_RECORDS_BUFFER_SIZE = 64 * 1024;
+
+        namespace detail
+        {
+            struct LinesStage {
+                using value_type = LineView;
+                using IsRandomAccess_t = std::false_type;
+
+                /// nullptr for an empty file.
+                std::shared_ptr<const WholeFileData> fileData;
+
+                template <typename Sink>
+                bool forEach(Sink& sink) const {
+                    if (fileData == nullptr) {
+                        return true;
+                    }
+                    const char* current = fileData->getContent();
+                    const char* const end = current + fileData->getSize();
+                    while (current != end) {
+                        const auto lineEnd = static_cast<const char*>(
+                            std::memchr(current, '\n', static_cast<std::size_t>(end - current)));
+                        const char* const next = lineEnd == nullptr ? end : lineEnd + 1;
+                        std::size_t size = static_cast<std::size_t>(
+                            (lineEnd == nullptr ? end : lineEnd) - current);
+                        if (size != 0 && current[size - 1] == '\r') {
+                            size--;
+                        }
+                        if (!sink(LineView{current, size})) {
+                            return false;
+                        }
+                        current = next;
+                    }
+                    return true;
+                }
+
+                std::size_t getKnownSize() const {
+                    return Containers::FusedStreams::UNKNOWN_SIZE;
+                }
+            };
+
+            template <typename Record>
+            struct RecordsStage {
+                using value_type = Record;
+                using IsRandomAccess_t = std::false_type;
+
+                Filename_t filename;
+                std::size_t recordsPerRead;
+
+                template <typename Sink>
+                bool forEach(Sink& sink) const {
+                    const auto& theFilename = filename;
+                    return browseFileBlocks(
+                        filename,
+                        recordsPerRead * sizeof(Record),
+                        [&sink, &theFilename](const char* data, std::size_t size) {
+                            if (size % sizeof(Record) != 0) {
+                                throw std::runtime_error(
+                                    "The size of the file " + theFilename
+                                    + " is not a multiple of the size of the records.");
+                            }
+                            for (std::size_t offset = 0; offset < size; offset += sizeof(Record)) {
+                                Record record;
+                                std::memcpy(&record, data + offset, sizeof(Record));
+                                if (!sink(static_cast<const Record&>(record))) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        });
+                }
+
+                std::size_t getKnownSize() const {
+                    return Containers::FusedStreams::UNKNOWN_SIZE;
+                }
+            };
+
+            struct DirectoryStage {
+                using value_type = Filename_t;
+                using IsRandomAccess_t = std::false_type;
+
+                Filename_t folder;
+
+                template <typename Sink>
+                bool forEach(Sink& sink) const {
+                    return browseDirectory(
+                        folder, [&sink](const Filename_t& entry) { return sink(entry); });
+                }
+
+                std::size_t getKnownSize() const {
+                    return Containers::FusedStreams::UNKNOWN_SIZE;
+                }
+            };
+        } // namespace detail
+
+        /**
+         * Stream of the lines of the file, which stays mapped as long as the stream is alive.
+         * The LineView point into the mapping: they are valid as long as the stream is. The lines
+         * end with "\n" or "\r\n", and the last one may have no end of line.
+         */
+        inline Containers::FusedStreams::FusedStream<detail::LinesStage> streamLines(
+            std::shared_ptr<const WholeFileData> fileData) {
+            return Containers::FusedStreams::FusedStream<detail::LinesStage>(
+                detail::LinesStage{std::move(fileData)});
+        }
+
+        /// Maps the file with readWholeFile, except when it is empty.
+        inline Containers::FusedStreams::FusedStream<detail::LinesStage> streamLines(
+            const Filename_t& filename) {
+            if (getFileSize(filename) == 0) {
+                return streamLines(std::shared_ptr<const WholeFileData>());
+            }
+            return streamLines(std::shared_ptr<const WholeFileData>(readWholeFile(filename)));
+        }
+
+        /**
+         * Stream of the consecutive "Record" of the file, as in memory (no change of endianness).
+         * The file is read "bufferSize" bytes at a time (rounded down to whole records).
+         * @throws std::runtime_error when browsing, if the file does not hold whole records.
+         */
+        template <typename Record>
+        Containers::FusedStreams::FusedStream<detail::RecordsStage<Record>> streamRecords(
+            const Filename_t& filename, std::size_t bufferSize = DEFAULT_RECORDS_BUFFER_SIZE) {
+            static_assert(
+                std::is_trivially_copyable<Record>::value,
+                "The records are copied from the bytes of the file.");
+            return Containers::FusedStreams::FusedStream<detail::RecordsStage<Record>>(
+                detail::RecordsStage<Record>{
+                    filename, std::max<std::size_t>(bufferSize / sizeof(Record), 1)});
+        }
+
+        /// Stream of the entries of browseDirectory(folder), in the order of the system.
+        inline Containers::FusedStreams::FusedStream<detail::DirectoryStage> streamDirectory(
+            const Filename_t& folder) {
+            return Containers::FusedStreams::FusedStream<detail::DirectoryStage>(
+                detail::DirectoryStage{folder});
+        }
+    } // namespace Filesystem
+} // namespace MF
+
+#endif // MFRANCESCHI_CPPLIBRARIES_FILESTREAMS_HPP
@@ -11,10 +11,13 @@
 #define FILE_H
 
 #include <fstream>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "MF/Bytes.hpp"
+
 namespace MF
 {
     namespace Filesystem
@@ -60,6 +63,28 @@ namespace MF
          */
         std::vector<Filename_t> listFilesInDirectory(const Filename_t &folder);
 
+        /**
+         * Lazy version of listFilesInDirectory: calls "entryProcessor(name)" with each file and
+         * directory of "folder", in the order of the system, until it returns false. Only the
+         * current entry is in memory.
+         * @return false if "entryProcessor" stopped the browsing.
+         */
+        bool browseDirectory(
+            const Filename_t &folder,
+            const std::function<bool(const Filename_t &)> &entryProcessor);
+
+        /**
+         * Reads the file by blocks: calls "blockProcessor(data, size)" with each block of
+         * "blockSize" bytes, the last one possibly shorter, until it returns false. Only the
+         * current block is in memory.
+         * @throws std::invalid_argument if "blockSize" is 0.
+         * @return false if "blockProcessor" stopped the reading.
+         */
+        bool browseFileBlocks(
+            const Filename_t &filename,
+            std::size_t blockSize,
+            const std::function<bool(const char *, std::size_t)> &blockProcessor);
+
         /// Data structure used to store information about files opened with openFile.
         class WholeFileData {
            public:
@@ -94,6 +119,28 @@ namespace MF
          */
         std::unique_ptr<const WholeFileData> readWholeFile(const Filename_t &filename);
 
+        /**
+         * Wraps the contents of a read file into a Bytes::Buffer, without any copy.
+         * The buffer shares the ownership of "fileData": the file stays mapped as long as any
+         * buffer made from it is alive.
+         * The memory is read-only: writing through the buffer is undefined behaviour. A
+         * Bytes::CowBuffer on it clones the bytes before the first write.
+         */
+        std::shared_ptr<Bytes::Buffer> makeBufferFromWholeFile(
+            const std::shared_ptr<const WholeFileData> &fileData);
+
+        /**
+         * Same as above, but the buffer only views the range [offset, offset + size) of the file.
+         * @throws std::out_of_range if the range does not fit in the file.
+         */
+        std::shared_ptr<Bytes::Buffer> makeBufferFromWholeFile(
+            const std::shared_ptr<const WholeFileData> &fileData,
+            std::size_t offset,
+            std::size_t size);
+
+        /// Shortcut for "makeBufferFromWholeFile(readWholeFile(filename))".
+        std::shared_ptr<Bytes::Buffer> readWholeFileToBuffer(const Filename_t &filename);
+
 #if MF_WINDOWS
         using WideFilename_t = std::wstring;
 
@@ -121,6 +168,8 @@ namespace MF
         std::vector<WideFilename_t> listFilesInDirectory(const WideFilename_t &folder);
 
         std::unique_ptr<const WholeFileData> readWholeFile(const WideFilename_t &filename);
+
+        std::shared_ptr<Bytes::Buffer> readWholeFileToBuffer(const WideFilename_t &filename);
 #endif
     } // namespace Filesystem
 } // namespace MF
@@ -9,6 +9,7 @@
 
 #include "FilesystemOSHelper.hpp"
 #include "MF/Strings.hpp"
+#include "MF/SystemErrors.hpp"
 
 #if MF_WINDOWS
 #    if defined(_MSC_VER)
@@ -110,6 +111,38 @@ namespace MF
             return result;
         }
 
+        bool browseDirectory(
+            const Filename_t &folder,
+            const std::function<bool(const Filename_t &)> &entryProcessor) {
+            const bool addFileSeparatorAtTheEnd = !MF::Strings::endsWith(folder, FILE_SEPARATOR);
+            return osBrowseDirectory(
+                addFileSeparatorAtTheEnd ? folder + FILE_SEPARATOR : folder, entryProcessor);
+        }
+
+        bool browseFileBlocks(
+            const Filename_t &filename,
+            std::size_t blockSize,
+            const std::function<bool(const char *, std::size_t)> &blockProcessor) {
+            if (blockSize == 0) {
+                throw std::invalid_argument("Tried to read blocks of size 0.");
+            }
+            ifstream file(filename, ios_base::binary);
+            SystemErrors::Errno::throwCurrentSystemErrorIf(!file.is_open());
+
+            std::vector<char> block(blockSize);
+            while (file) {
+                file.read(block.data(), static_cast<std::streamsize>(blockSize));
+                const auto size = static_cast<std::size_t>(file.gcount());
+                if (file.bad()) {
+                    throw std::runtime_error("Failed to read the file " + filename + ".");
+                }
+                if (size != 0 && !blockProcessor(block.data(), size)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
 #if MF_WINDOWS
         std::unique_ptr<std::wifstream> openFile(const WideFilename_t &filename) {
             return internalOpenFile(filename, getFileEncoding(filename));
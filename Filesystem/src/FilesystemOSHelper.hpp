@@ -17,6 +17,11 @@ namespace MF
         void osGetDirectoryContents(
             const Filename_t &directoryName, std::vector<Filename_t> &result);
 
+        /// Stops as soon as "entryProcessor" returns false, and then returns false.
+        bool osBrowseDirectory(
+            const Filename_t &directoryName,
+            const std::function<bool(const Filename_t &)> &entryProcessor);
+
 #if MF_WINDOWS
         void osReadFileToBuffer(
             const WideFilename_t &filename, char *buffer, Filesize_t bufferSize);
@@ -39,6 +39,15 @@ namespace MF
 
         void osGetDirectoryContents(
             const Filename_t &directoryName, std::vector<Filename_t> &result) {
+            osBrowseDirectory(directoryName, [&result](const Filename_t &filename) {
+                result.push_back(filename);
+                return true;
+            });
+        }
+
+        bool osBrowseDirectory(
+            const Filename_t &directoryName,
+            const std::function<bool(const Filename_t &)> &entryProcessor) {
             static Filename_t CURRENT_FOLDER = ".";
             static Filename_t PARENT_FOLDER = "..";
             std::unique_ptr<DIR, decltype(&closedir)> dirStream(
@@ -60,7 +69,9 @@ namespace MF
                 } else if (dir_entry->d_type == DT_UNKNOWN && isDir(directoryName + tempFilename)) {
                     tempFilename.append(FILE_SEPARATOR);
                 }
-                result.emplace_back(tempFilename);
+                if (!entryProcessor(tempFilename)) {
+                    return false;
+                }
                 Errno::setCurrentErrorCode(0);
             }
 
@@ -68,6 +79,7 @@ namespace MF
             if (currentErrorCode != 0) {
                 throw Errno::getSystemErrorForErrorCode(currentErrorCode);
             }
+            return true;
         }
     } // namespace Filesystem
 } // namespace MF
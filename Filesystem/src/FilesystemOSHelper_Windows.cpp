@@ -68,6 +68,15 @@ namespace MF
 
         void osGetDirectoryContents(
             const Filename_t &directoryName, std::vector<Filename_t> &result) {
+            osBrowseDirectory(directoryName, [&result](const Filename_t &filename) {
+                result.push_back(filename);
+                return true;
+            });
+        }
+
+        bool osBrowseDirectory(
+            const Filename_t &directoryName,
+            const std::function<bool(const Filename_t &)> &entryProcessor) {
             Filename_t tempFolderName = directoryName + "*";
 
             WIN32_FIND_DATAA wfd;
@@ -77,7 +86,7 @@ namespace MF
             if (handle.isInvalid()) {
                 auto errorCode = SystemErrors::Win32::getCurrentErrorCode();
                 if (errorCode == ERROR_FILE_NOT_FOUND) {
-                    return;
+                    return true;
                 }
                 throw SystemErrors::Win32::getSystemErrorForErrorCode(errorCode);
             }
@@ -90,12 +99,13 @@ namespace MF
                     if (isCurrentOrParentDir(filename)) {
                         continue;
                     }
-
-                    result.push_back(filename + FILE_SEPARATOR);
-                } else {
-                    result.emplace_back(filename);
+                    filename.append(FILE_SEPARATOR);
+                }
+                if (!entryProcessor(filename)) {
+                    return false;
                 }
             } while (FindNextFileA(handle.get(), &wfd) != 0);
+            return true;
         }
 
         void osGetDirectoryContents(
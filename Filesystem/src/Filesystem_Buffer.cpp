@@ -0,0 +1,58 @@
+//
+// Created by MartinF on 18/10/2026.
+//
+
+#include <stdexcept>
+
+#include "MF/Filesystem.hpp"
+
+namespace MF
+{
+    namespace Filesystem
+    {
+        /// Buffer which points directly into the memory of a WholeFileData.
+        class BufferOnWholeFile : public Bytes::Buffer {
+           public:
+            explicit BufferOnWholeFile(std::shared_ptr<const WholeFileData> fileData)
+                : Buffer(), fileData(std::move(fileData)) {
+            }
+
+            void *get() const override {
+                // The mapping is read-only, but Buffer does not have a const interface.
+                return const_cast<char *>(fileData->getContent());
+            }
+
+            std::size_t getSize() const override {
+                return fileData->getSize();
+            }
+
+           private:
+            const std::shared_ptr<const WholeFileData> fileData;
+        };
+
+        std::shared_ptr<Bytes::Buffer> makeBufferFromWholeFile(
+            const std::shared_ptr<const WholeFileData> &fileData) {
+            if (fileData == nullptr) {
+                throw std::invalid_argument("The file data pointer is equal to nullptr.");
+            }
+            return std::make_shared<BufferOnWholeFile>(fileData);
+        }
+
+        std::shared_ptr<Bytes::Buffer> makeBufferFromWholeFile(
+            const std::shared_ptr<const WholeFileData> &fileData,
+            std::size_t offset,
+            std::size_t size) {
+            return makeBufferFromWholeFile(fileData)->slice(offset, size);
+        }
+
+        std::shared_ptr<Bytes::Buffer> readWholeFileToBuffer(const Filename_t &filename) {
+            return makeBufferFromWholeFile(readWholeFile(filename));
+        }
+
+#if MF_WINDOWS
+        std::shared_ptr<Bytes::Buffer> readWholeFileToBuffer(const WideFilename_t &filename) {
+            return makeBufferFromWholeFile(readWholeFile(filename));
+        }
+#endif
+    } // namespace Filesystem
+} // namespace MF
@@ -0,0 +1,102 @@
+//
+// Created by MartinF on 19/10/2026.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+
+#include "Filesystem_tests_commons.hpp"
+#include "MF/FileStreams.hpp"
+#include "MF/SystemErrors.hpp"
+
+using namespace MF::Filesystem;
+
+struct Record {
+    std::uint32_t id;
+    float value;
+};
+
+static void writeTempFile(const std::string &content) {
+    std::ofstream file(FILENAME_TEMP, std::ios_base::binary);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+static void writeTempRecords(std::uint32_t count, std::size_t extraBytes) {
+    std::string content{};
+    for (std::uint32_t id = 0; id < count; id++) {
+        const Record record{id, float(id) / 2};
+        content.append(reinterpret_cast<const char *>(&record), sizeof(Record));
+    }
+    writeTempFile(content + std::string(extraBytes, 'x'));
+}
+
+TEST(FileStreams, it_streams_the_lines) {
+    writeTempFile("first\nsecond\r\n\nfourth");
+    const auto lines = streamLines(FILENAME_TEMP);
+    const auto strings = lines.map([](LineView line) { return line.toString(); });
+    EXPECT_EQ(
+        strings.collectToVector(), (std::vector<std::string>{"first", "second", "", "fourth"}));
+    EXPECT_EQ(lines.filter([](LineView line) { return line.isEmpty(); }).size(), 1);
+
+    // Short-circuits.
+    const auto found = lines.filter([](LineView line) { return line.size > 5; }).findFirst();
+    ASSERT_FALSE(found->isEmpty());
+    EXPECT_EQ(found->get(), std::string("second"));
+    EXPECT_EQ(lines.limit(2).size(), 2);
+
+    writeTempFile("single\n");
+    EXPECT_EQ(streamLines(FILENAME_TEMP).size(), 1);
+    writeTempFile("");
+    EXPECT_EQ(streamLines(FILENAME_TEMP).size(), 0);
+
+    // The stream keeps the file mapped.
+    std::shared_ptr<const WholeFileData> fileData = readWholeFile(fid_middle_size.name);
+    const auto linesCount = std::count(
+        fileData->getContent(), fileData->getContent() + fileData->getSize(), '\n');
+    const auto mediumLines = streamLines(std::move(fileData));
+    EXPECT_GE(mediumLines.size(), linesCount);
+    EXPECT_LE(mediumLines.size(), linesCount + 1);
+
+    deleteFile(FILENAME_TEMP);
+    EXPECT_THROW(streamLines(FILENAME_NOT_EXISTING), MF::SystemErrors::SystemError);
+}
+
+TEST(FileStreams, it_streams_the_records) {
+    writeTempRecords(1000, 0);
+    const auto records = streamRecords<Record>(FILENAME_TEMP, 3 * sizeof(Record) + 1);
+    EXPECT_EQ(records.size(), 1000);
+    const auto ids = records.map([](const Record &record) { return record.id; });
+    EXPECT_EQ(ids.reduce(std::uint32_t(0), std::plus<>()), 999 * 1000 / 2);
+    EXPECT_TRUE(records.anyMatch([](const Record &record) { return record.value == 10.5f; }));
+
+    const auto firsts = records.skip(1).limit(3).collectToVector();
+    ASSERT_EQ(firsts.size(), 3);
+    EXPECT_EQ(firsts[0].id, 1);
+    EXPECT_EQ(firsts[2].value, 1.5f);
+
+    // The end of the file is not read when the stream stops before.
+    writeTempRecords(1000, 2);
+    EXPECT_EQ(records.limit(10).size(), 10);
+    EXPECT_THROW(records.size(), std::runtime_error);
+
+    deleteFile(FILENAME_TEMP);
+    EXPECT_THROW(records.size(), MF::SystemErrors::SystemError);
+}
+
+TEST(FileStreams, it_streams_the_directory_entries) {
+    auto entries = streamDirectory(MF_FILESYSTEM_TESTS_FILES_DIR).collectToVector();
+    std::sort(entries.begin(), entries.end());
+    EXPECT_EQ(entries, listFilesInDirectory(MF_FILESYSTEM_TESTS_FILES_DIR));
+
+    std::size_t browsed = 0;
+    EXPECT_FALSE(browseDirectory(MF_FILESYSTEM_TESTS_FILES_DIR, [&browsed](const Filename_t &) {
+        browsed++;
+        return false;
+    }));
+    EXPECT_EQ(browsed, 1);
+    EXPECT_EQ(streamDirectory(MF_FILESYSTEM_TESTS_FILES_DIR).limit(2).size(), 2);
+    EXPECT_EQ(streamDirectory(MF_FILESYSTEM_TESTS_EMPTY_FOLDER).size(), 0);
+
+    EXPECT_THROW(streamDirectory(FILENAME_NOT_EXISTING).size(), MF::SystemErrors::SystemError);
+}
@@ -3,6 +3,7 @@
 //
 
 #include "Filesystem_tests_commons.hpp"
+#include "MF/CowBuffer.hpp"
 
 using namespace MF::Filesystem;
 
@@ -19,3 +20,55 @@ TEST(readWholeFile, ManyReads) {
         ASSERT_NO_THROW(fileData->getContent()[position2]);
     }
 }
+
+TEST(readWholeFileToBuffer, it_views_the_file_without_copy) {
+    std::shared_ptr<const WholeFileData> fileData = readWholeFile(fid_middle_size.name);
+    auto buffer = makeBufferFromWholeFile(fileData);
+
+    EXPECT_EQ(buffer->get(), static_cast<const void *>(fileData->getContent()));
+    EXPECT_EQ(buffer->getSize(), fid_middle_size.size);
+    EXPECT_EQ(buffer->getAt<char>(0), fid_middle_size.firstByte);
+    EXPECT_EQ(buffer->getAt<char>(fid_middle_size.size - 1), fid_middle_size.lastByte);
+}
+
+TEST(readWholeFileToBuffer, it_keeps_the_file_alive) {
+    auto buffer = readWholeFileToBuffer(fid_middle_size.name);
+
+    ASSERT_EQ(buffer->getSize(), fid_middle_size.size);
+    EXPECT_EQ(buffer->getAt<char>(0), fid_middle_size.firstByte);
+    EXPECT_EQ(*(buffer->cend() - 1), static_cast<MF::Bytes::byte>(fid_middle_size.lastByte));
+}
+
+TEST(readWholeFileToBuffer, it_is_cloned_by_a_cow_buffer_before_a_write) {
+    // The mapping is read-only: writing into it would crash.
+    MF::Bytes::CowBuffer buffer(readWholeFileToBuffer(fid_middle_size.name));
+    const void *const mapped = buffer.get();
+    EXPECT_FALSE(buffer.isShared());
+
+    buffer.getWritableAt<char>(0) = static_cast<char>(fid_middle_size.firstByte + 1);
+    EXPECT_NE(static_cast<const void *>(buffer.get()), mapped);
+    ASSERT_EQ(buffer.getSize(), fid_middle_size.size);
+    EXPECT_EQ(buffer.getAt<char>(fid_middle_size.size - 1), fid_middle_size.lastByte);
+}
+
+TEST(readWholeFileToBuffer, it_views_a_sub_range) {
+    std::shared_ptr<const WholeFileData> fileData = readWholeFile(fid_middle_size.name);
+    const std::size_t size = fid_middle_size.size;
+
+    auto tail = makeBufferFromWholeFile(fileData, size - 1, 1);
+    fileData.reset();
+    ASSERT_EQ(tail->getSize(), 1);
+    EXPECT_EQ(tail->getAt<char>(0), fid_middle_size.lastByte);
+    EXPECT_THROW(tail->getAt<char>(1), std::out_of_range);
+}
+
+TEST(readWholeFileToBuffer, it_rejects_invalid_ranges) {
+    std::shared_ptr<const WholeFileData> fileData = readWholeFile(fid_middle_size.name);
+    const std::size_t size = fid_middle_size.size;
+
+    EXPECT_NO_THROW(makeBufferFromWholeFile(fileData, size, 0));
+    EXPECT_THROW(makeBufferFromWholeFile(fileData, size, 1), std::out_of_range);
+    EXPECT_THROW(makeBufferFromWholeFile(fileData, 1, size), std::out_of_range);
+    EXPECT_THROW(makeBufferFromWholeFile(fileData, (std::size_t)-1, 2), std::out_of_range);
+    EXPECT_THROW(makeBufferFromWholeFile(nullptr), std::invalid_argument);
+}